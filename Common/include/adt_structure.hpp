@@ -43,6 +43,7 @@
 #include <algorithm>
 
 #include "./mpi_structure.hpp"
+#include "./omp_structure.hpp"
 #include "./option_structure.hpp"
 
 using namespace std;
@@ -221,11 +222,14 @@ public:
    * \param[in] nPoints Number of local points to be stored in the ADT.
    * \param[in] coor    Coordinates of the local points.
    * \param[in] pointID Local point IDs of the local points. 
+   * \param[in] globalTree Whether the points of all ranks are gathered in the ADT (default),
+   *                       or only the given points are stored (e.g. when they were gathered already).
    */
   su2_adtPointsOnlyClass(unsigned short      nDim,
                          unsigned long       nPoints,
                          const su2double     *coor,
-                         const unsigned long *pointID);
+                         const unsigned long *pointID,
+                         const bool          globalTree = true);
 
   /*!
    * \brief Destructor of the class. Nothing to be done.
@@ -261,4 +265,129 @@ private:
   su2_adtPointsOnlyClass& operator=(const su2_adtPointsOnlyClass &);
 };
 
+/*! 
+ * \class su2_adtElemClass
+ * \brief  Class for storing an ADT of surface elements (lines in 2D, triangles and
+ *         quadrilaterals in 3D), which is used to compute the distance to the
+ *         nearest element. The ADT is built over the bounding boxes of the elements,
+ *         i.e. points in 2*nDim dimensions.
+ * \version 5.0.0 "Raven"
+ */
+class su2_adtElemClass : public su2_adtBaseClass {
+private:
+  unsigned short nDim;  /*!< \brief Number of spatial dimensions of the elements. */
+
+  vector<vector<unsigned long> > frontLeaves;    /*!< \brief Vectors used in the tree traversal (one per thread). */
+  vector<vector<unsigned long> > frontLeavesNew; /*!< \brief Vectors used in the tree traversal (one per thread). */
+  vector<vector<pair<su2double, unsigned long> > > BBoxTargets; /*!< \brief Candidate elements of the search and
+                                                                            the minimum distance squared to their
+                                                                            bounding boxes (one per thread). */
+  vector<unsigned long> lastElem; /*!< \brief Element found by the previous search of each thread, used
+                                              as the initial guess of the next search. */
+
+  vector<unsigned short> nNodesElem;    /*!< \brief Number of nodes of the elements in the ADT. */
+  vector<su2double>      coorElem;      /*!< \brief Coordinates of the nodes of the elements, N_POINTS_QUADRILATERAL
+                                                    nodes are stored for each element. */
+  vector<su2double>      BBoxCoor;      /*!< \brief Bounding boxes of the elements (minimum and maximum coordinates). */
+  vector<unsigned long>  localElemIDs;  /*!< \brief Local element ID's of the elements in the ADT. */
+  vector<int>            ranksOfElems;  /*!< \brief Ranks of the elements in the ADT. */
+
+public:
+  /*!
+   * \brief Constructor of the class. The elements of all the ranks are gathered.
+   * \param[in] val_nDim   Number of spatial dimensions of the problem.
+   * \param[in] nElem      Number of local elements to be stored in the ADT.
+   * \param[in] nNodes     Number of nodes of the local elements.
+   * \param[in] coor       Coordinates of the nodes of the local elements (N_POINTS_QUADRILATERAL nodes per element).
+   * \param[in] elemID     Local element IDs of the local elements.
+   */
+  su2_adtElemClass(unsigned short       val_nDim,
+                   unsigned long        nElem,
+                   const unsigned short *nNodes,
+                   const su2double      *coor,
+                   const unsigned long  *elemID);
+
+  /*!
+   * \brief Destructor of the class. Nothing to be done.
+   */
+  ~su2_adtElemClass();
+
+  /*!
+   * \brief Function, which determines the nearest element in the ADT for the
+   *        given coordinate, the distance is the true distance to the element
+   *        (not to its nodes). It can be called by several threads at the same time.
+   * \param[in]  coor    Coordinate for which the nearest element in the ADT must be determined.
+   * \param[out] dist    Distance to the nearest element in the ADT.
+   * \param[out] elemID  Local element ID of the nearest element in the ADT.
+   * \param[out] rankID  Rank on which the nearest element in the ADT is stored.
+   */
+  void DetermineNearestElement(const su2double *coor,
+                               su2double       &dist,
+                               unsigned long   &elemID,
+                               int             &rankID);
+private:
+  /*!
+   * \brief Function, which computes the distance squared between a point and an element.
+   * \param[in] val_elem  Index of the element in the ADT.
+   * \param[in] coor      Coordinates of the point.
+   * \return Distance squared to the element.
+   */
+  su2double DistanceSquaredToElement(unsigned long   val_elem,
+                                     const su2double *coor);
+
+  /*!
+   * \brief Function, which computes the distance squared between a point and a segment.
+   * \param[in] a     Coordinates of the first node of the segment.
+   * \param[in] b     Coordinates of the second node of the segment.
+   * \param[in] coor  Coordinates of the point.
+   * \return Distance squared to the segment.
+   */
+  su2double DistanceSquaredToSegment(const su2double *a,
+                                     const su2double *b,
+                                     const su2double *coor);
+
+  /*!
+   * \brief Function, which computes the distance squared between a point and a triangle (3D).
+   * \param[in] a     Coordinates of the first node of the triangle.
+   * \param[in] b     Coordinates of the second node of the triangle.
+   * \param[in] c     Coordinates of the third node of the triangle.
+   * \param[in] coor  Coordinates of the point.
+   * \return Distance squared to the triangle.
+   */
+  su2double DistanceSquaredToTriangle(const su2double *a,
+                                      const su2double *b,
+                                      const su2double *c,
+                                      const su2double *coor);
+
+  /*!
+   * \brief Function, which computes the minimum and maximum possible distance squared
+   *        between a point and the elements inside a bounding box.
+   * \param[in]  xMin     Minimum coordinates of the bounding box.
+   * \param[in]  xMax     Maximum coordinates of the bounding box.
+   * \param[in]  coor     Coordinates of the point.
+   * \param[out] distMin  Minimum possible distance squared.
+   * \param[out] distMax  Maximum possible distance squared.
+   */
+  void BBoxDistanceSquared(const su2double *xMin,
+                           const su2double *xMax,
+                           const su2double *coor,
+                           su2double       &distMin,
+                           su2double       &distMax);
+
+  /*!
+   * \brief Default constructor of the class, disabled.
+   */
+  su2_adtElemClass();
+
+  /*!
+   * \brief Copy constructor of the class, disabled.
+   */
+  su2_adtElemClass(const su2_adtElemClass &);
+
+  /*!
+   * \brief Assignment operator, disabled.
+   */
+  su2_adtElemClass& operator=(const su2_adtElemClass &);
+};
+
 #include "adt_structure.inl"
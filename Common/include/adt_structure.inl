@@ -55,3 +55,5 @@ inline su2_adtBaseClass::~su2_adtBaseClass() {}
 inline bool su2_adtBaseClass::IsEmpty(void) const { return isEmpty;}
 
 inline su2_adtPointsOnlyClass::~su2_adtPointsOnlyClass() {}
+
+inline su2_adtElemClass::~su2_adtElemClass() {}
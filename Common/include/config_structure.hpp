@@ -105,6 +105,7 @@ private:
   su2double FFD_Tol;  	/*!< \brief Tolerance in the point inversion problem. */
   su2double FFD_Scale;  	/*!< \brief Scale factor between the design variable value and the control point movement. */
   bool Viscous_Limiter_Flow, Viscous_Limiter_Turb;			/*!< \brief Viscous limiters. */
+  bool Contiguous_Storage;   /*!< \brief Store the flow variables of all the points in contiguous blocks. */
   bool Write_Conv_FSI;			/*!< \brief Write convergence file for FSI problems. */
   bool ContinuousAdjoint,			/*!< \brief Flag to know if the code is solving an adjoint problem. */
   Viscous,                /*!< \brief Flag to know if the code is solving a viscous problem. */
@@ -391,6 +392,7 @@ private:
   su2double *LocationStations;   /*!< \brief Airfoil sections in wing slicing subroutine. */
   unsigned short Kind_Solver,	/*!< \brief Kind of solver Euler, NS, Continuous adjoint, etc.  */
   Kind_FluidModel,			/*!< \brief Kind of the Fluid Model: Ideal or Van der Walls, ... . */
+  Kind_LUT_FluidModel,			/*!< \brief Kind of the Fluid Model that is tabulated by the look-up table model. */
   Kind_ViscosityModel,			/*!< \brief Kind of the Viscosity Model*/
   Kind_ConductivityModel,			/*!< \brief Kind of the Thermal Conductivity Model*/
   Kind_FreeStreamOption,			/*!< \brief Kind of free stream option to choose if initializing with density or temperature  */
@@ -464,6 +466,12 @@ private:
   unsigned long Linear_Solver_Iter;		/*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Iter_FSI_Struc;		/*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
   unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  bool Linear_Solver_Prec_Float;   /*!< \brief Store the ILU and Jacobi preconditioners in single precision. */
+  unsigned short Linear_Solver_AMG_Levels;   /*!< \brief Maximum number of coarse levels of the algebraic multigrid preconditioner. */
+  unsigned short Linear_Solver_AMG_Smoother; /*!< \brief Smoother of the levels of the algebraic multigrid preconditioner. */
+  unsigned short Linear_Solver_AMG_Sweeps;   /*!< \brief Number of pre and post smoothing sweeps of the algebraic multigrid preconditioner. */
+  bool Newton_Krylov;   /*!< \brief Jacobian free Newton-Krylov method for the implicit flow equations. */
+  su2double Newton_Krylov_Eps;   /*!< \brief Relative step of the finite differences of the Newton-Krylov method. */
   su2double SemiSpan;		/*!< \brief Wing Semi span. */
   su2double Roe_Kappa;		/*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Flow;		/*!< \brief Relaxation coefficient of the linear solver mean flow. */
@@ -518,6 +526,7 @@ private:
   unsigned long Iter_Fixed_CM;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Iter_Fixed_NetThrust;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Update_Alpha;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
+  unsigned long LUT_MaxPoints;			/*!< \brief Maximum number of points per direction of the look-up tables. */
   unsigned long Update_iH;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Update_BCThrust;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   su2double dNetThrust_dBCThrust;        /*!< \brief value of dCl/dAlpha. */
@@ -580,6 +589,7 @@ private:
   unsigned short Analytical_Surface;	/*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Axis_Stations;	/*!< \brief Axis orientation. */
   unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat;	/*!< \brief Mesh output format. */
   unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
@@ -594,12 +604,17 @@ private:
   *CFL_AdaptParam,      /*!< \brief Information about the CFL ramp. */
   *CFL,
   *HTP_Axis,      /*!< \brief Location of the HTP axis. */
+  *Partition_Weights,      /*!< \brief Cost of a point, of each neighbor and of each boundary vertex in the partitioning. */
+  *LUT_Pressure_Limits,      /*!< \brief Pressure range of the look-up table fluid model. */
+  *LUT_Temperature_Limits,      /*!< \brief Temperature range of the look-up table fluid model. */
+  LUT_Tolerance,      /*!< \brief Relative error bound of the look-up table fluid model. */
   DomainVolume;		/*!< \brief Volume of the computational grid. */
   unsigned short nRefOriginMoment_X,    /*!< \brief Number of X-coordinate moment computation origins. */
   nRefOriginMoment_Y,           /*!< \brief Number of Y-coordinate moment computation origins. */
   nRefOriginMoment_Z;           /*!< \brief Number of Z-coordinate moment computation origins. */
   string Mesh_FileName,			/*!< \brief Mesh input file. */
   Mesh_Out_FileName,				/*!< \brief Mesh output file. */
+  Partition_Profile_FileName,			/*!< \brief Partition profile file. */
   Solution_FlowFileName,			/*!< \brief Flow solution input file. */
   Solution_LinFileName,			/*!< \brief Linearized flow solution input file. */
   Solution_AdjFileName,			/*!< \brief Adjoint solution input file for drag functional. */
@@ -637,9 +652,15 @@ private:
   Wrt_Limiters,              /*!< \brief Write residuals to solution file */
   Wrt_SharpEdges,              /*!< \brief Write residuals to solution file */
   Wrt_Halo,                   /*!< \brief Write rind layers in solution files */
+  Wrt_Binary_Restart,         /*!< \brief Write the restart files in binary format */
+  Read_Binary_Restart,        /*!< \brief Read the restart files in binary format */
+  Weighted_Partitioning,      /*!< \brief Weight the vertices of the graph in the partitioning */
+  Read_Partition_Profile,     /*!< \brief Scale the weights of the partitioning with a partition profile */
   Plot_Section_Forces,       /*!< \brief Write sectional forces for specified markers. */
   Wrt_1D_Output;                /*!< \brief Write average stagnation pressure specified markers. */
   unsigned short Console_Output_Verb;  /*!< \brief Level of verbosity for console output */
+  unsigned long Partition_Profile_Iter;  /*!< \brief Iteration at which the partition profile is written */
+  unsigned short Kind_Point_Ordering;  /*!< \brief Renumbering of the points of the grid */
   su2double Gamma,			/*!< \brief Ratio of specific heats of the gas. */
   Bulk_Modulus,			/*!< \brief Value of the bulk modulus for incompressible flows. */
   ArtComp_Factor,			/*!< \brief Value of the artificial compresibility factor for incompressible flows. */
@@ -802,6 +823,7 @@ private:
   su2double Static_Time;			/*!< \brief Time while the structure is not loaded in FSI applications. */
   unsigned short Pred_Order;  /*!< \brief Order of the predictor for FSI applications. */
   unsigned short Kind_Interpolation; /*!\brief type of interpolation to use for FSI applications. */
+  bool Incremental_InterfaceSearch; /*!< \brief Update the interface donors by a local search around the previous donors. */
   bool Prestretch;            /*!< Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;         /*!< \brief File name for reference geometry. */
   unsigned long Nonphys_Points, /*!< \brief Current number of non-physical points in the solution. */
@@ -821,6 +843,9 @@ private:
   *default_ea_lim,            /*!< \brief Default equivalent area limit array for the COption class. */
   *default_grid_fix,          /*!< \brief Default fixed grid (non-deforming region) array for the COption class. */
   *default_htp_axis,          /*!< \brief Default HTP axis for the COption class. */
+  *default_part_weight,       /*!< \brief Default partition weights for the COption class. */
+  *default_lut_pressure,      /*!< \brief Default pressure range of the look-up table for the COption class. */
+  *default_lut_temperature,   /*!< \brief Default temperature range of the look-up table for the COption class. */
   *default_ffd_axis,          /*!< \brief Default FFD axis for the COption class. */
   *default_inc_crit;          /*!< \brief Default incremental criteria array for the COption class. */
   
@@ -2555,6 +2580,63 @@ public:
    */
   bool GetWrt_Halo(void);
   
+  /*!
+   * \brief Get information about writing the restart files in binary format.
+   * \return <code>TRUE</code> means that the restart files are written in the binary SU2 format.
+   */
+  bool GetWrt_Binary_Restart(void);
+  
+  /*!
+   * \brief Get information about reading the restart files in binary format.
+   * \return <code>TRUE</code> means that the restart files are read in the binary SU2 format.
+   */
+  bool GetRead_Binary_Restart(void);
+  
+  /*!
+   * \brief Get information about the weighting of the vertices in the partitioning.
+   * \return <code>TRUE</code> means that the vertices of the graph are weighted with the estimated cost of each point.
+   */
+  bool GetWeighted_Partitioning(void);
+  
+  /*!
+   * \brief Get the cost of a point, of each of its neighbors or of each of its boundary vertices.
+   * \param[in] val_index - Index of the weight (0 point, 1 neighbor, 2 boundary vertex).
+   * \return Weight used in the partitioning.
+   */
+  su2double GetPartition_Weights(unsigned short val_index);
+  
+  /*!
+   * \brief Get the cost of a boundary vertex of a marker in the partitioning, the
+   *        boundary conditions with a non-local or iterative treatment cost twice.
+   * \param[in] val_marker - Index of the marker in which we are interested.
+   * \return Weight of a vertex of the marker <i>val_marker</i>.
+   */
+  su2double GetMarker_PartitionWeight(unsigned short val_marker);
+  
+  /*!
+   * \brief Get the iteration at which the measured cost of each rank is written to the partition profile.
+   * \return Iteration of the partition profile (0 means that no profile is written).
+   */
+  unsigned long GetPartition_Profile_Iter(void);
+  
+  /*!
+   * \brief Get information about reading the partition profile of a previous run.
+   * \return <code>TRUE</code> means that the weights of the partitioning are scaled with the partition profile.
+   */
+  bool GetRead_Partition_Profile(void);
+  
+  /*!
+   * \brief Get the name of the partition profile file.
+   * \return Name of the partition profile file.
+   */
+  string GetPartition_Profile_FileName(void);
+  
+  /*!
+   * \brief Get the kind of renumbering of the points of the grid.
+   * \return Kind of renumbering (none, reverse Cuthill-McKee or Hilbert curve).
+   */
+  unsigned short GetKind_Point_Ordering(void);
+  
   /*!
    * \brief Get information about writing sectional force files.
    * \return <code>TRUE</code> means that sectional force files will be written for specified markers.
@@ -2967,6 +3049,38 @@ public:
    */
   su2double GetAcentric_Factor(void);
   
+  /*!
+   * \brief Fluid model that is tabulated by the look-up table fluid model (LUT_GAS).
+   * \return Kind of the tabulated fluid model.
+   */
+  unsigned short GetKind_LUT_FluidModel(void);
+  
+  /*!
+   * \brief Get the pressure range of the look-up table fluid model.
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   * \return Dimensional pressure limit.
+   */
+  su2double GetLUT_Pressure_Limits(unsigned short val_index);
+  
+  /*!
+   * \brief Get the temperature range of the look-up table fluid model.
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   * \return Dimensional temperature limit.
+   */
+  su2double GetLUT_Temperature_Limits(unsigned short val_index);
+  
+  /*!
+   * \brief Get the relative error bound of the look-up table fluid model.
+   * \return Relative error bound of the interpolated thermodynamic state.
+   */
+  su2double GetLUT_Tolerance(void);
+  
+  /*!
+   * \brief Get the maximum number of points per direction of the look-up tables.
+   * \return Maximum number of points per direction.
+   */
+  unsigned long GetLUT_MaxPoints(void);
+  
   /*!
    * \brief Get the value of the critical temperature.
    * \return Critical temperature.
@@ -3093,6 +3207,30 @@ public:
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void);
   
+  /*!
+   * \brief Get if the ILU and Jacobi preconditioners are stored in single precision.
+   * \return <code>TRUE</code> if the preconditioners are stored in single precision; otherwise <code>FALSE</code>.
+   */
+  bool GetLinear_Solver_Prec_Float(void);
+  
+  /*!
+   * \brief Get the maximum number of coarse levels of the algebraic multigrid preconditioner.
+   * \return Maximum number of coarse levels.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void);
+  
+  /*!
+   * \brief Get the smoother of the levels of the algebraic multigrid preconditioner.
+   * \return Kind of preconditioner used as smoother (ILU, JACOBI or LU_SGS).
+   */
+  unsigned short GetLinear_Solver_AMG_Smoother(void);
+  
+  /*!
+   * \brief Get the number of pre and post smoothing sweeps of the algebraic multigrid preconditioner.
+   * \return Number of smoothing sweeps.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void);
+  
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -3365,6 +3503,26 @@ public:
    */
   unsigned short GetKind_TimeIntScheme_Flow(void);
   
+  /*!
+   * \brief Set the kind of integration scheme (explicit or implicit) for the flow equations.
+   * \note The Newton-Krylov method evaluates the residual as explicit, so that the Jacobian
+   *       (its preconditioner) is not modified.
+   * \param[in] val_kind_timeintscheme_flow - Kind of integration scheme for the flow equations.
+   */
+  void SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme_flow);
+  
+  /*!
+   * \brief Get whether the flow equations are solved with the Jacobian free Newton-Krylov method.
+   * \return <code>TRUE</code> if the Newton-Krylov method is used; otherwise <code>FALSE</code>.
+   */
+  bool GetNewton_Krylov(void);
+  
+  /*!
+   * \brief Get the relative step of the finite differences of the Newton-Krylov method.
+   * \return Relative step of the finite differences.
+   */
+  su2double GetNewton_Krylov_Eps(void);
+  
   /*!
    * \brief Get the kind of integration scheme (explicit or implicit)
    *        for the flow equations.
@@ -3657,6 +3815,13 @@ public:
    */
   bool GetViscous_Limiter_Turb(void);
   
+  /*!
+   * \brief Storage of the flow variables.
+   * \return <code>TRUE</code> if the solution, primitive variables, gradients and limiters of
+   *         all the points are stored in contiguous blocks; otherwise <code>FALSE</code>.
+   */
+  bool GetContiguous_Storage(void);
+  
   /*!
    * \brief Write convergence file for FSI problems
    * \return <code>FALSE</code> means no file is written.
@@ -4070,6 +4235,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void);
   
+  /*!
+   * \brief Get the format of the output grid (converted, scaled or deformed).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void);
+  
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -6773,6 +6944,12 @@ public:
    * \brief Get the interpolation method used for matching between zones.
    */
   inline unsigned short GetKindInterpolation(void);
+
+  /*!
+   * \brief Get whether the interface donors of unsteady problems are updated incrementally.
+   * \return <code>TRUE</code> if the donors are searched around the donors of the previous time step.
+   */
+  inline bool GetIncremental_InterfaceSearch(void);
   
   /*!
    * \brief Get the AD support.
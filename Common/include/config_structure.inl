@@ -673,6 +673,16 @@ inline su2double CConfig::GetTemperature_Critical(void) { return Temperature_Cri
 
 inline su2double CConfig::GetAcentric_Factor(void) { return Acentric_Factor; }
 
+inline unsigned short CConfig::GetKind_LUT_FluidModel(void) { return Kind_LUT_FluidModel; }
+
+inline su2double CConfig::GetLUT_Pressure_Limits(unsigned short val_index) { return LUT_Pressure_Limits[val_index]; }
+
+inline su2double CConfig::GetLUT_Temperature_Limits(unsigned short val_index) { return LUT_Temperature_Limits[val_index]; }
+
+inline su2double CConfig::GetLUT_Tolerance(void) { return LUT_Tolerance; }
+
+inline unsigned long CConfig::GetLUT_MaxPoints(void) { return LUT_MaxPoints; }
+
 inline unsigned short CConfig::GetKind_ViscosityModel(void) { return Kind_ViscosityModel; }
 
 inline unsigned short CConfig::GetKind_ConductivityModel(void) { return Kind_ConductivityModel; }
@@ -783,6 +793,14 @@ inline unsigned long CConfig::GetLinear_Solver_Iter(void) { return Linear_Solver
 
 inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return Linear_Solver_Restart_Frequency; }
 
+inline bool CConfig::GetLinear_Solver_Prec_Float(void) { return Linear_Solver_Prec_Float; }
+
+inline unsigned short CConfig::GetLinear_Solver_AMG_Levels(void) { return Linear_Solver_AMG_Levels; }
+
+inline unsigned short CConfig::GetLinear_Solver_AMG_Smoother(void) { return Linear_Solver_AMG_Smoother; }
+
+inline unsigned short CConfig::GetLinear_Solver_AMG_Sweeps(void) { return Linear_Solver_AMG_Sweeps; }
+
 inline su2double CConfig::GetRelaxation_Factor_Flow(void) { return Relaxation_Factor_Flow; }
 
 inline su2double CConfig::GetRelaxation_Factor_AdjFlow(void) { return Relaxation_Factor_AdjFlow; }
@@ -855,6 +873,12 @@ inline unsigned short CConfig::GetSpatialOrder_AdjFlow(void) { return SpatialOrd
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Flow(void) { return Kind_TimeIntScheme_Flow; }
 
+inline void CConfig::SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme_flow) { Kind_TimeIntScheme_Flow = val_kind_timeintscheme_flow; }
+
+inline bool CConfig::GetNewton_Krylov(void) { return Newton_Krylov; }
+
+inline su2double CConfig::GetNewton_Krylov_Eps(void) { return Newton_Krylov_Eps; }
+
 inline unsigned short CConfig::GetKind_TimeIntScheme_Wave(void) { return Kind_TimeIntScheme_Wave; }
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Heat(void) { return Kind_TimeIntScheme_Heat; }
@@ -1088,6 +1112,8 @@ inline string CConfig::GetMesh_Out_FileName(void) { return Mesh_Out_FileName; }
 
 inline unsigned short CConfig::GetMesh_FileFormat(void) { return Mesh_FileFormat; }
 
+inline unsigned short CConfig::GetMesh_Out_FileFormat(void) { return Mesh_Out_FileFormat; }
+
 inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFormat; }
 
 inline unsigned short CConfig::GetActDisk_Jump(void) { return ActDisk_Jump; }
@@ -1248,6 +1274,8 @@ inline bool CConfig::GetViscous_Limiter_Flow(void) { return Viscous_Limiter_Flow
 
 inline bool CConfig::GetViscous_Limiter_Turb(void) { return Viscous_Limiter_Turb; }
 
+inline bool CConfig::GetContiguous_Storage(void) { return Contiguous_Storage; }
+
 inline bool CConfig::GetWrite_Conv_FSI(void) { return Write_Conv_FSI; }
 
 inline bool CConfig::GetHold_GridFixed(void) { return Hold_GridFixed; }
@@ -1294,6 +1322,22 @@ inline bool CConfig::GetWrt_SharpEdges(void) { return Wrt_SharpEdges; }
 
 inline bool CConfig::GetWrt_Halo(void) { return Wrt_Halo; }
 
+inline bool CConfig::GetWrt_Binary_Restart(void) { return Wrt_Binary_Restart; }
+
+inline bool CConfig::GetRead_Binary_Restart(void) { return Read_Binary_Restart; }
+
+inline bool CConfig::GetWeighted_Partitioning(void) { return Weighted_Partitioning; }
+
+inline su2double CConfig::GetPartition_Weights(unsigned short val_index) { return Partition_Weights[val_index]; }
+
+inline unsigned long CConfig::GetPartition_Profile_Iter(void) { return Partition_Profile_Iter; }
+
+inline bool CConfig::GetRead_Partition_Profile(void) { return Read_Partition_Profile; }
+
+inline string CConfig::GetPartition_Profile_FileName(void) { return Partition_Profile_FileName; }
+
+inline unsigned short CConfig::GetKind_Point_Ordering(void) { return Kind_Point_Ordering; }
+
 inline bool CConfig::GetPlot_Section_Forces(void) { return Plot_Section_Forces; }
 
 inline bool CConfig::GetWrt_1D_Output(void) { return Wrt_1D_Output; }
@@ -1460,6 +1504,8 @@ inline bool CConfig::GetFSI_Simulation(void) { return FSI_Problem; }
 
 inline unsigned short CConfig::GetKindInterpolation(void) { return Kind_Interpolation; }
 
+inline bool CConfig::GetIncremental_InterfaceSearch(void) { return Incremental_InterfaceSearch; }
+
 inline unsigned short CConfig::GetRelaxation_Method_FSI(void) { return Kind_BGS_RelaxMethod; }
 
 inline su2double CConfig::GetOrderMagResidualFSI(void) { return OrderMagResidualFSI; }
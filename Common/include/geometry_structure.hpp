@@ -35,6 +35,7 @@
 #pragma once
 
 #include "./mpi_structure.hpp"
+#include "./omp_structure.hpp"
 
 #ifdef HAVE_METIS
   #include "metis.h"
@@ -59,6 +60,7 @@ extern "C" {
 #include "primal_grid_structure.hpp"
 #include "dual_grid_structure.hpp"
 #include "config_structure.hpp"
+#include "halo_structure.hpp"
 
 using namespace std;
 
@@ -106,6 +108,12 @@ protected:
 	nZone,								/*!< \brief Number of zones in the problem. */
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
+  unsigned long nEdgeDomain;      /*!< \brief Number of edges without halo points, they are numbered before the other edges. */
+  unsigned long nEdgeColor;       /*!< \brief Number of edge colors (groups of edges without common points). */
+  unsigned long nEdgeColorDomain; /*!< \brief Number of edge colors without halo points, they come before the other colors. */
+  unsigned long *EdgeColorPtr;    /*!< \brief Position of the first edge of each color in EdgeColorIdx (size nEdgeColor+1). */
+  unsigned long *EdgeColorIdx;    /*!< \brief Edge indices sorted by color. */
+  CHaloExchange *Halo;            /*!< \brief Exchange of the halo points of the grid level (built on first use). */
 
 public:
 	unsigned long *nElem_Bound;			/*!< \brief Number of elements of the boundary. */
@@ -205,6 +213,12 @@ public:
 	 */
 	unsigned long GetnEdge(void);
 
+	/*!
+	 * \brief Get number of edges without halo points (edges 0 to nEdgeDomain-1).
+	 * \return Number of edges without halo points.
+	 */
+	unsigned long GetnEdgeDomain(void);
+
 	/*! 
 	 * \brief Get number of markers.
 	 * \return Number of markers.
@@ -342,7 +356,7 @@ public:
 	 * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
 	 */
-	virtual void SetRCM_Ordering(CConfig *config);
+	virtual void SetPoint_Ordering(CConfig *config);
   
 	/*!
 	 * \brief A virtual member.
@@ -354,6 +368,55 @@ public:
 	 */
 	void SetEdges(void);
 
+  /*!
+	 * \brief Group the blocks of EDGE_BLOCK_SIZE consecutive edges in colors such that no two blocks
+	 *        of the same color share a point, this allows the edge loops to be shared among threads
+	 *        (in chunks of one block) without data races.
+	 */
+	void SetEdgeColoring(void);
+
+  /*!
+	 * \brief Get the number of edge colors.
+	 * \return Number of edge colors (0 if the coloring has not been computed).
+	 */
+	unsigned long GetnEdgeColor(void);
+
+  /*!
+	 * \brief Get the number of edge colors without halo points, the edges of the colors
+	 *        0 to nEdgeColorDomain-1 only have points of the domain.
+	 * \return Number of edge colors without halo points.
+	 */
+	unsigned long GetnEdgeColorDomain(void);
+
+  /*!
+	 * \brief Get the position of the first edge of a color.
+	 * \param[in] val_color - Edge color.
+	 * \return Position in the sorted edge list of the first edge of the color.
+	 */
+	unsigned long GetEdgeColorBegin(unsigned long val_color);
+
+  /*!
+	 * \brief Get the position after the last edge of a color.
+	 * \param[in] val_color - Edge color.
+	 * \return Position in the sorted edge list after the last edge of the color.
+	 */
+	unsigned long GetEdgeColorEnd(unsigned long val_color);
+
+  /*!
+	 * \brief Get an edge from the list of edges sorted by color.
+	 * \param[in] val_pos - Position in the sorted edge list.
+	 * \return Index of the edge.
+	 */
+	unsigned long GetEdgeColorIdx(unsigned long val_pos);
+
+  /*!
+	 * \brief Get the halo exchange of the grid level. It is built from the SEND_RECEIVE
+	 *        markers the first time it is requested, i.e. after the points have been renumbered.
+	 * \param[in] config - Definition of the particular problem.
+	 * \return Halo exchange of the grid level.
+	 */
+	CHaloExchange *GetHaloExchange(CConfig *config);
+
 	/*! 
 	 * \brief A virtual member.
 	 */
@@ -475,6 +538,13 @@ public:
    */
   virtual void SetColorGrid_Parallel(CConfig *config);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_ComputeTime - Time spent by this rank in the iterations, without the waits for the other ranks.
+   */
+  virtual void SetPartition_Profile(CConfig *config, su2double val_ComputeTime);
+  
   /*!
 	 * \brief A virtual member.
 	 * \param[in] config - Definition of the particular problem.
@@ -1026,6 +1096,16 @@ public:
    * \param[in] val_nZone - Total number of domains in the grid file.
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+  
+  /*!
+   * \brief Reads the geometry of the grid in the binary SU2 format, each rank reads only
+   *        its block of points and the indexed blocks of elements that touch it.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
     
 
   /*!
@@ -1068,10 +1148,23 @@ public:
 	void SetPoint_Connectivity(void);
   
   /*!
-	 * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm
+	 * \brief Renumber the points of the domain (RCM or Hilbert curve, see POINT_ORDERING),
+	 *        the halo points keep their order at the end of the list.
    * \param[in] config - Definition of the particular problem.
 	 */
-	void SetRCM_Ordering(CConfig *config);
+	void SetPoint_Ordering(CConfig *config);
+  
+  /*!
+	 * \brief Compute a renumbering of the points of the domain using a Reverse Cuthill-McKee Algorithm.
+   * \param[out] Result - Old index of the point at each position of the new numbering.
+	 */
+	void ComputeRCM_Ordering(vector<unsigned long> &Result);
+  
+  /*!
+	 * \brief Compute a renumbering of the points of the domain along a Hilbert space-filling curve.
+   * \param[out] Result - Old index of the point at each position of the new numbering.
+	 */
+	void ComputeHilbert_Ordering(vector<unsigned long> &Result);
   
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
@@ -1198,6 +1291,24 @@ public:
    */
   void SetColorGrid_Parallel(CConfig *config);
   
+#ifdef HAVE_PARMETIS
+  /*!
+   * \brief Set the weights of the vertices of the graph given to ParMETIS with the
+   *        estimated cost of the points of the linear partition of this rank.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] vwgt - Integer weights of the points, scaled for ParMETIS.
+   */
+  void SetPartition_Weights(CConfig *config, idx_t *vwgt);
+#endif
+  
+  /*!
+   * \brief Write the partition profile, the ratio between the measured and the
+   *        estimated cost of the points of each rank, used to weight the next partitioning.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_ComputeTime - Time spent by this rank in the iterations, without the waits for the other ranks.
+   */
+  void SetPartition_Profile(CConfig *config, su2double val_ComputeTime);
+  
 	/*!
 	 * \brief Set the rotational velocity at each node.
 	 * \param[in] config - Definition of the particular problem.
@@ -81,6 +81,8 @@ inline void CGeometry::SetColorGrid(CConfig *config) { }
 
 inline void CGeometry::SetColorGrid_Parallel(CConfig *config) { }
 
+inline void CGeometry::SetPartition_Profile(CConfig *config, su2double val_ComputeTime) { }
+
 inline void CGeometry::DivideConnectivity(CConfig *config, unsigned short Elem_Type) { }
 
 inline void CGeometry::SetRotationalVelocity(CConfig *config, unsigned short val_iZone) { }
@@ -111,7 +113,7 @@ inline void CGeometry::SetPositive_ZArea(CConfig *config) { }
 
 inline void CGeometry::SetPoint_Connectivity(void) { }
 
-inline void CGeometry::SetRCM_Ordering(CConfig *config) { }
+inline void CGeometry::SetPoint_Ordering(CConfig *config) { }
 
 inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) { }
 
@@ -157,6 +159,18 @@ inline unsigned long CGeometry::GetnVertex(unsigned short val_marker) { return n
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned long CGeometry::GetnEdgeDomain(void) { return nEdgeDomain; }
+
+inline unsigned long CGeometry::GetnEdgeColor(void) { return nEdgeColor; }
+
+inline unsigned long CGeometry::GetnEdgeColorDomain(void) { return nEdgeColorDomain; }
+
+inline unsigned long CGeometry::GetEdgeColorBegin(unsigned long val_color) { return EdgeColorPtr[val_color]; }
+
+inline unsigned long CGeometry::GetEdgeColorEnd(unsigned long val_color) { return EdgeColorPtr[val_color+1]; }
+
+inline unsigned long CGeometry::GetEdgeColorIdx(unsigned long val_pos) { return EdgeColorIdx[val_pos]; }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -0,0 +1,195 @@
+/*!
+ * \file halo_structure.hpp
+ * \brief Headers of the class for the exchange of the halo (ghost) points
+ *        between ranks. The implementation is in the <i>halo_structure.cpp</i> file.
+ * \author SU2 Developers
+ * \version 5.0.0 "Raven"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *                 Prof. Edwin van der Weide's group at the University of Twente.
+ *                 Prof. Vincent Terrapon's group at the University of Liege.
+ *
+ * Copyright (C) 2012-2017 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+#include "./vector_structure.hpp"
+
+/*--- Persistent requests (MPI_Send_init/MPI_Recv_init) are only used with the
+ plain double datatype, the AD and complex types need the SU2_MPI wrappers,
+ which only provide the regular non-blocking calls. ---*/
+
+#if defined HAVE_MPI && \
+    !defined COMPLEX_TYPE && \
+    !defined ADOLC_FORWARD_TYPE && \
+    !defined ADOLC_REVERSE_TYPE && \
+    !defined CODI_FORWARD_TYPE && \
+    !defined CODI_REVERSE_TYPE
+#define HAVE_PERSISTENT_COMMS
+#endif
+
+using namespace std;
+
+class CGeometry;
+class CConfig;
+
+/*!
+ * \class CHaloExchange
+ * \brief Exchange of the values of the halo points of a grid level.
+ *
+ * The send and receive lists of all the SEND_RECEIVE markers are merged per
+ * neighbour rank, so each rank exchanges a single packed message with each
+ * neighbour. Each number of values per point (a "channel") owns preallocated
+ * buffers and, with the plain double type, persistent requests. All the
+ * messages of a channel are posted at once by InitiateComms and completed by
+ * CompleteComms, so that work can be done while the messages are in flight.
+ * \author SU2 Developers
+ * \version 5.0.0 "Raven"
+ */
+class CHaloExchange {
+protected:
+
+  int nNeighbor_Send,               /*!< \brief Number of ranks that receive values from this rank. */
+  nNeighbor_Recv,                   /*!< \brief Number of ranks that send values to this rank. */
+  *Neighbor_Send,                   /*!< \brief Ranks that receive values from this rank. */
+  *Neighbor_Recv;                   /*!< \brief Ranks that send values to this rank. */
+  unsigned long *Offset_Send,       /*!< \brief Position of the first send point of each neighbour (size nNeighbor_Send+1). */
+  *Offset_Recv,                     /*!< \brief Position of the first receive point of each neighbour (size nNeighbor_Recv+1). */
+  *Point_Send,                      /*!< \brief Local index of the send points, in packing order. */
+  *Point_Recv;                      /*!< \brief Local index of the receive (halo) points, in unpacking order. */
+  unsigned short *Rotation_Recv;    /*!< \brief Periodic transformation of each receive point. */
+
+  unsigned short nChannel;          /*!< \brief Number of channels (different number of values per point). */
+  unsigned short *Channel_nVar;     /*!< \brief Number of values per point of each channel. */
+  bool *Channel_Active;             /*!< \brief Communication of the channel in progress. */
+  su2double **Buffer_Send,          /*!< \brief Packed send buffer of each channel. */
+  **Buffer_Recv;                    /*!< \brief Packed receive buffer of each channel. */
+#ifdef HAVE_MPI
+  MPI_Request **Request;            /*!< \brief Requests of each channel, receives first, then sends. */
+  MPI_Status *Status;               /*!< \brief Auxiliary status array for the completion of the requests. */
+#endif
+
+  /*!
+   * \brief Get the channel for a number of values per point, it is created the first time.
+   * \param[in] val_nVar - Number of values per point.
+   * \return Index of the channel.
+   */
+  unsigned short GetChannel(unsigned short val_nVar);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, the send and receive lists are built from the SEND_RECEIVE markers.
+   * \param[in] geometry - Geometrical definition of the grid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CHaloExchange(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CHaloExchange(void);
+
+  /*!
+   * \brief Get the number of points that are sent by this rank.
+   * \return Number of send points.
+   */
+  unsigned long GetnPoint_Send(void);
+
+  /*!
+   * \brief Get the local index of a send point.
+   * \param[in] val_pos - Position of the point in the send buffer.
+   * \return Local index of the point.
+   */
+  unsigned long GetPoint_Send(unsigned long val_pos);
+
+  /*!
+   * \brief Get the number of points that are received by this rank.
+   * \return Number of receive (halo) points.
+   */
+  unsigned long GetnPoint_Recv(void);
+
+  /*!
+   * \brief Get the local index of a receive point.
+   * \param[in] val_pos - Position of the point in the receive buffer.
+   * \return Local index of the point.
+   */
+  unsigned long GetPoint_Recv(unsigned long val_pos);
+
+  /*!
+   * \brief Get the periodic transformation of a receive point.
+   * \param[in] val_pos - Position of the point in the receive buffer.
+   * \return Index of the periodic rotation (0 if there is none).
+   */
+  unsigned short GetRotation_Type_Recv(unsigned long val_pos);
+
+  /*!
+   * \brief Get the send buffer of a channel, the values of the send point <i>val_pos</i>
+   *        are packed at positions val_pos*val_nVar, ..., val_pos*val_nVar+val_nVar-1.
+   * \param[in] val_nVar - Number of values per point.
+   * \return Send buffer.
+   */
+  su2double *GetBuffer_Send(unsigned short val_nVar);
+
+  /*!
+   * \brief Get the receive buffer of a channel, packed as the send buffer.
+   * \param[in] val_nVar - Number of values per point.
+   * \return Receive buffer.
+   */
+  su2double *GetBuffer_Recv(unsigned short val_nVar);
+
+  /*!
+   * \brief Post all the receives and sends of a channel, the send buffer must be packed.
+   * \param[in] val_nVar - Number of values per point.
+   */
+  void InitiateComms(unsigned short val_nVar);
+
+  /*!
+   * \brief Wait for the messages of a channel, afterwards the receive buffer can be read.
+   * \param[in] val_nVar - Number of values per point.
+   */
+  void CompleteComms(unsigned short val_nVar);
+
+  /*!
+   * \brief Pack the values of the send points of a vector and post the messages.
+   * \param[in] x - Vector with the values of all the points.
+   */
+  void InitiateComms(CSysVector & x);
+
+  /*!
+   * \brief Wait for the messages and copy the received values to the halo points of a vector.
+   * \param[in,out] x - Vector with the values of all the points.
+   */
+  void CompleteComms(CSysVector & x);
+
+  /*!
+   * \brief Update the values of the halo points of a vector (no periodic transformation).
+   * \param[in,out] x - Vector with the values of all the points.
+   */
+  void SendReceive(CSysVector & x);
+
+};
+
+#include "halo_structure.inl"
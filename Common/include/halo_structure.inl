@@ -0,0 +1,56 @@
+/*!
+ * \file halo_structure.inl
+ * \brief In-Line subroutines of the <i>halo_structure.hpp</i> file.
+ * \author SU2 Developers
+ * \version 5.0.0 "Raven"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *                 Prof. Edwin van der Weide's group at the University of Twente.
+ *                 Prof. Vincent Terrapon's group at the University of Liege.
+ *
+ * Copyright (C) 2012-2017 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+inline unsigned long CHaloExchange::GetnPoint_Send(void) { return Offset_Send[nNeighbor_Send]; }
+
+inline unsigned long CHaloExchange::GetPoint_Send(unsigned long val_pos) { return Point_Send[val_pos]; }
+
+inline unsigned long CHaloExchange::GetnPoint_Recv(void) { return Offset_Recv[nNeighbor_Recv]; }
+
+inline unsigned long CHaloExchange::GetPoint_Recv(unsigned long val_pos) { return Point_Recv[val_pos]; }
+
+inline unsigned short CHaloExchange::GetRotation_Type_Recv(unsigned long val_pos) { return Rotation_Recv[val_pos]; }
+
+inline su2double *CHaloExchange::GetBuffer_Send(unsigned short val_nVar) {
+  unsigned short iChannel = GetChannel(val_nVar);
+  return Buffer_Send[iChannel];
+}
+
+inline su2double *CHaloExchange::GetBuffer_Recv(unsigned short val_nVar) {
+  unsigned short iChannel = GetChannel(val_nVar);
+  return Buffer_Recv[iChannel];
+}
+
+inline void CHaloExchange::SendReceive(CSysVector & x) { InitiateComms(x); CompleteComms(x); }
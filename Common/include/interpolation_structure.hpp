@@ -151,6 +151,12 @@ public:
  * \brief Nearest Neighbor interpolation
  */
 class CNearestNeighbor : public CInterpolator {
+protected:
+  vector<vector<unsigned long> > Previous_Donor;     /*!< \brief Donor of each target vertex at the previous update (position in the receive buffers), for each interface. */
+  vector<vector<unsigned long> > Donor_Neighbor_Ptr; /*!< \brief Start of the neighbors of each donor vertex in Donor_Neighbor, for each interface. */
+  vector<vector<unsigned long> > Donor_Neighbor;     /*!< \brief Donor vertices connected to each donor vertex on the interface, for each interface. */
+  vector<unsigned long> Previous_MaxLocalVertex;     /*!< \brief Maximum number of donor vertices per processor at the previous update, for each interface. */
+
 public:
 
   /*!
@@ -178,6 +184,15 @@ public:
    */
   void Set_TransferCoeff(CConfig **config);
 
+  /*!
+   * \brief Gather the connectivity of the donor vertices of an interface, which is used to search
+   * the donors around the donors of the previous update.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] iMarkerInt - Index of the interface.
+   * \param[in] nVertexDonor - Number of vertices on the donor boundary.
+   */
+  void Set_DonorNeighbors(int markDonor, unsigned short iMarkerInt, unsigned long nVertexDonor);
+
 };
 
 /*!
@@ -51,6 +51,18 @@
 #include "config_structure.hpp"
 #include "geometry_structure.hpp"
 
+/*--- The single reduction of the pipelined solvers is non-blocking only with the
+ plain double datatype and MPI-3, the AD and complex types use the blocking SU2_MPI wrappers. ---*/
+
+#if defined HAVE_MPI && (MPI_VERSION >= 3) && \
+    !defined COMPLEX_TYPE && \
+    !defined ADOLC_FORWARD_TYPE && \
+    !defined ADOLC_REVERSE_TYPE && \
+    !defined CODI_FORWARD_TYPE && \
+    !defined CODI_REVERSE_TYPE
+#define HAVE_NONBLOCKING_REDUCTION
+#endif
+
 using namespace std;
 
 /*!
@@ -154,6 +166,30 @@ private:
    */
   void WriteHistory(const int & iter, const su2double & res, const su2double & resinit);
   
+#ifdef HAVE_NONBLOCKING_REDUCTION
+  MPI_Request Reduction_Request; /*!< \brief Request of the non-blocking reduction of the pipelined solvers. */
+#endif
+  
+  /*!
+   * \brief starts the global sum of several local dot products (pipelined solvers)
+   * \param[in] nVal - number of values to be reduced
+   * \param[in] loc_val - local values (products over the points of this processor)
+   * \param[out] val - global values, only available after CompleteReduction
+   *
+   * In plain double parallel builds the reduction is non-blocking, so that it can be
+   * overlapped with the preconditioner and the matrix-vector product, the buffers
+   * must not be used until the reduction is completed.
+   */
+  void StartReduction(unsigned short nVal, su2double *loc_val, su2double *val);
+  
+  /*!
+   * \brief waits for the global sum started with StartReduction
+   * \param[in] nVal - number of values to be reduced
+   * \param[in] loc_val - local values (products over the points of this processor)
+   * \param[out] val - global values
+   */
+  void CompleteReduction(unsigned short nVal, su2double *loc_val, su2double *val);
+  
 public:
   
   /*! \brief Conjugate Gradient method
@@ -199,6 +235,45 @@ public:
                         CPreconditioner & precond, su2double tol,
                         unsigned long m, su2double *residual, bool monitoring);
   
+  /*! \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose)
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * The three dot products of an iteration are summed in a single reduction, which
+   * is overlapped with the preconditioner and the matrix-vector product.
+   */
+  unsigned long CG_Pipelined_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                       CPreconditioner & precond, su2double tol,
+                                       unsigned long m, su2double *residual, bool monitoring);
+  
+  /*!
+   * \brief Pipelined Generalized Minimal Residual method (right preconditioned)
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * The Gram-Schmidt products of an iteration (classical instead of modified) and the
+   * norm of the new vector are summed in a single reduction, which is overlapped with
+   * the preconditioner and the matrix-vector product of the next direction. The
+   * preconditioned and the multiplied bases are built by recurrence, which requires a
+   * fixed (linear) preconditioner, and the method is restarted from the true residual
+   * every 50 iterations to bound the rounding errors of the recurrences.
+   */
+  unsigned long FGMRES_Pipelined_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                           CPreconditioner & precond, su2double tol,
+                                           unsigned long m, su2double *residual, bool monitoring);
+  
   /*!
    * \brief Solve the linear system using a Krylov subspace method
    * \param[in] Jacobian - Jacobian Matrix for the linear system
@@ -209,6 +284,19 @@ public:
    */
   unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Solve the linear system using a Krylov subspace method with a given matrix-vector product,
+   *        the matrix is only used to build the preconditioner (e.g. Jacobian free Newton-Krylov).
+   * \param[in] Jacobian - Jacobian Matrix for the preconditioner of the linear system
+   * \param[in] mat_vec - Matrix-vector product of the linear system
+   * \param[in] LinSysRes - Linear system residual
+   * \param[in] LinSysSol - Linear system solution
+   * \param[in] geometry -  Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long Solve(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes, CSysVector & LinSysSol,
+                      CGeometry *geometry, CConfig *config);
+  
 
   /*!
    * \brief Prepare the linear solve during the reverse interpretation of the AD tape.
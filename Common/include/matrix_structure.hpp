@@ -35,6 +35,7 @@
 #pragma once
 
 #include "./mpi_structure.hpp"
+#include "./omp_structure.hpp"
 #include <limits>
 #include <iostream>
 #include <cmath>
@@ -48,6 +49,49 @@ using namespace std;
 
 const su2double eps = numeric_limits<su2double>::epsilon(); /*!< \brief machine epsilon */
 
+/*!
+ * \class CSysMatrixPattern
+ * \brief Sparse pattern (compressed row format) of the matrices of a grid, shared by all the
+ *        matrices built on the same grid and connectivity (flow, turbulence, adjoint, ...).
+ * \version 5.0.0 "Raven"
+ */
+class CSysMatrixPattern {
+public:
+  CGeometry *geometry;          /*!< \brief Grid of the pattern. */
+  bool EdgeConnect;             /*!< \brief Connectivity of the pattern, edges (true) or elements (false). */
+  unsigned long nPoint,         /*!< \brief Number of points in the grid. */
+  nPointDomain,                 /*!< \brief Number of points of the domain in the grid. */
+  nnz,                          /*!< \brief Number of possible nonzero blocks. */
+  *row_ptr,                     /*!< \brief Pointers to the first element in each row. */
+  *col_ind;                     /*!< \brief Column index of each block. */
+  bool ILU_Levels;              /*!< \brief The levels of the ILU are computed. */
+  unsigned long nLevel_Lower,   /*!< \brief Number of levels of the ILU factorization and forward substitution. */
+  nLevel_Upper,                 /*!< \brief Number of levels of the ILU backward substitution. */
+  *Level_Lower_Ptr,             /*!< \brief Position of the first row of each level in Level_Lower_Row. */
+  *Level_Lower_Row,             /*!< \brief Rows of the ILU factorization and forward substitution sorted by level. */
+  *Level_Upper_Ptr,             /*!< \brief Position of the first row of each level in Level_Upper_Row. */
+  *Level_Upper_Row;             /*!< \brief Rows of the ILU backward substitution sorted by level. */
+  unsigned short nRef;          /*!< \brief Number of matrices that use the pattern. */
+  
+  /*!
+   * \brief Constructor of the class, the pattern takes ownership of the index arrays.
+   * \param[in] val_geometry - Grid of the pattern.
+   * \param[in] val_EdgeConnect - Connectivity of the pattern, edges (true) or elements (false).
+   * \param[in] val_nPoint - Number of points in the grid.
+   * \param[in] val_nPointDomain - Number of points of the domain in the grid.
+   * \param[in] val_row_ptr - Pointers to the first element in each row.
+   * \param[in] val_col_ind - Column index of each block.
+   * \param[in] val_nnz - Number of possible nonzero blocks.
+   */
+  CSysMatrixPattern(CGeometry *val_geometry, bool val_EdgeConnect, unsigned long val_nPoint, unsigned long val_nPointDomain,
+                    unsigned long *val_row_ptr, unsigned long *val_col_ind, unsigned long val_nnz);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSysMatrixPattern(void);
+};
+
 
 /*!
  * \class CSysMatrix
@@ -75,6 +119,32 @@ private:
 	su2double *aux_vector;         /*!< \brief Auxiliary array to store intermediate results. */
   su2double *sum_vector;         /*!< \brief Auxiliary array to store intermediate results. */
 	su2double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
+  bool prec_float;              /*!< \brief Store the ILU and Jacobi preconditioners in single precision. */
+  float *ILU_matrix_float;      /*!< \brief Entries of the ILU sparse matrix in single precision. */
+  float *invM_float;            /*!< \brief Inverse of (Jacobi) preconditioner in single precision. */
+  su2double *block_load;        /*!< \brief Internal array to load two blocks of the single precision preconditioners. */
+
+  unsigned long nLevel_Lower,   /*!< \brief Number of levels of the ILU factorization and forward substitution. */
+  nLevel_Upper,                 /*!< \brief Number of levels of the ILU backward substitution. */
+  *Level_Lower_Ptr,             /*!< \brief Position of the first row of each level in Level_Lower_Row. */
+  *Level_Lower_Row,             /*!< \brief Rows of the ILU factorization and forward substitution sorted by level. */
+  *Level_Upper_Ptr,             /*!< \brief Position of the first row of each level in Level_Upper_Row. */
+  *Level_Upper_Row;             /*!< \brief Rows of the ILU backward substitution sorted by level. */
+  CSysMatrixPattern *pattern;   /*!< \brief Shared sparse pattern and ILU levels (NULL if the matrix owns them). */
+  static vector<CSysMatrixPattern*> Pattern_List; /*!< \brief Sparse patterns in use. */
+  unsigned long nWork_ILU;      /*!< \brief Size of the work arrays of each thread for the ILU. */
+  su2double *ILU_work;          /*!< \brief Work arrays of the threads for the ILU. */
+
+  bool AMG_Built;               /*!< \brief The levels of the algebraic multigrid below this matrix are built. */
+  unsigned short AMG_Smoother,  /*!< \brief Preconditioner used as smoother of the algebraic multigrid. */
+  AMG_Sweeps;                   /*!< \brief Number of pre and post smoothing sweeps of the algebraic multigrid. */
+  CSysMatrix *AMG_Coarse;       /*!< \brief Matrix of the next coarser level of the algebraic multigrid. */
+  unsigned long *AMG_Aggregate; /*!< \brief Aggregate (point of the coarse level) of each point of the domain. */
+  unsigned long *AMG_Index;     /*!< \brief Position in the coarse matrix of each block of the matrix. */
+  CSysVector AMG_Res,           /*!< \brief Residual of the level. */
+  AMG_Aux,                      /*!< \brief Correction of a smoothing sweep of the level. */
+  AMG_CoarseRhs,                /*!< \brief Restricted residual, right hand side of the coarse level. */
+  AMG_CoarseSol;                /*!< \brief Solution of the coarse level. */
 
 	bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
 	vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
@@ -83,7 +153,236 @@ private:
   **yVector, **zVector, **rVector, *LFBlock,
   *LyVector, *FzVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
   unsigned long max_nElem;
-  
+
+  /*--- Kernels of the small dense block operations, specialized at compile time
+   for the usual block sizes and selected once the size of the blocks is known. ---*/
+
+  void (*BlockVector_Kernel)(const su2double *, const su2double *, su2double *, unsigned short);     /*!< \brief c = a*b, block by vector. */
+  void (*BlockVectorAdd_Kernel)(const su2double *, const su2double *, su2double *, unsigned short);  /*!< \brief c += a*b, block by vector. */
+  void (*BlockVectorSub_Kernel)(const su2double *, const su2double *, su2double *, unsigned short);  /*!< \brief c -= a*b, block by vector. */
+  void (*BlockBlock_Kernel)(const su2double *, const su2double *, su2double *, unsigned short);      /*!< \brief c = a*b, block by block. */
+  void (*BlockSolve_Kernel)(const su2double *, su2double *, su2double *, bool, unsigned short);      /*!< \brief Gauss elimination of a block system. */
+  void (*BlockInverse_Kernel)(const su2double *, su2double *, su2double *, bool, unsigned short);    /*!< \brief Inverse of a block. */
+
+  /*!
+   * \brief Select the block kernels that match the size of the blocks (generic kernels for the other sizes).
+   */
+  void SetBlockKernels(void);
+
+  /*!
+   * \brief Product of a block by a vector, c = a*b.
+   * \param[in] a - Block (row major).
+   * \param[in] b - Vector.
+   * \param[out] c - Result of the product.
+   * \param[in] val_nVar - Size of the block, only used by the generic kernel (BS = 0).
+   */
+  template<unsigned short BS>
+  static void BlockVector(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar);
+
+  /*!
+   * \brief Add the product of a block by a vector, c += a*b.
+   * \param[in] a - Block (row major).
+   * \param[in] b - Vector.
+   * \param[in,out] c - Vector to which the product is added.
+   * \param[in] val_nVar - Size of the block, only used by the generic kernel (BS = 0).
+   */
+  template<unsigned short BS>
+  static void BlockVectorAdd(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar);
+
+  /*!
+   * \brief Subtract the product of a block by a vector, c -= a*b.
+   * \param[in] a - Block (row major).
+   * \param[in] b - Vector.
+   * \param[in,out] c - Vector from which the product is subtracted.
+   * \param[in] val_nVar - Size of the block, only used by the generic kernel (BS = 0).
+   */
+  template<unsigned short BS>
+  static void BlockVectorSub(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar);
+
+  /*!
+   * \brief Product of two blocks, c = a*b.
+   * \param[in] a - First block (row major).
+   * \param[in] b - Second block (row major).
+   * \param[out] c - Result of the product.
+   * \param[in] val_nVar - Size of the blocks, only used by the generic kernel (BS = 0).
+   */
+  template<unsigned short BS>
+  static void BlockBlock(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar);
+
+  /*!
+   * \brief Solve a block system by Gauss elimination (without pivoting).
+   * \param[in] Block - Block of the system, it is not modified.
+   * \param[in,out] rhs - Right hand side on input, solution on output.
+   * \param[in] work - Auxiliary block for the elimination.
+   * \param[in] transposed - Solve the system of the transposed block.
+   * \param[in] val_nVar - Size of the block, only used by the generic kernel (BS = 0).
+   */
+  template<unsigned short BS>
+  static void BlockSolve(const su2double *Block, su2double *rhs, su2double *work, bool transposed, unsigned short val_nVar);
+
+  /*!
+   * \brief Inverse of a block by Gauss elimination (without pivoting), all the columns are eliminated at once.
+   * \param[in] Block - Block to invert, it is not modified.
+   * \param[out] invBlock - Inverse of the block.
+   * \param[in] work - Auxiliary block for the elimination.
+   * \param[in] transposed - Invert the transposed block.
+   * \param[in] val_nVar - Size of the block, only used by the generic kernel (BS = 0).
+   */
+  template<unsigned short BS>
+  static void BlockInverse(const su2double *Block, su2double *invBlock, su2double *work, bool transposed, unsigned short val_nVar);
+
+  /*!
+   * \brief Get the position of the block (i, j) in the sparse structure.
+   * \param[in] block_i - Row of the block.
+   * \param[in] block_j - Column of the block.
+   * \return Position of the block, nnz if it is not in the sparse pattern.
+   */
+  unsigned long GetIndex(unsigned long block_i, unsigned long block_j);
+
+  /*!
+   * \brief Get a block of a preconditioner in double precision, the double precision blocks are used in place.
+   * \param[in] val_block - Block of the preconditioner.
+   * \param[in] val_work - Array where the single precision blocks are converted.
+   * \return Block in double precision.
+   */
+  const su2double *LoadBlock(const su2double *val_block, su2double *val_work);
+
+  /*!
+   * \overload
+   */
+  const su2double *LoadBlock(const float *val_block, su2double *val_work);
+
+  /*!
+   * \brief Store a block in a preconditioner.
+   * \param[out] val_dest - Block of the preconditioner.
+   * \param[in] val_block - Values of the block.
+   * \param[in] transposed - Store the transposed block.
+   */
+  void StoreBlock(su2double *val_dest, const su2double *val_block, bool transposed = false);
+
+  /*!
+   * \overload
+   */
+  void StoreBlock(float *val_dest, const su2double *val_block, bool transposed = false);
+
+  /*!
+   * \brief Subtract a block from a block of a preconditioner.
+   * \param[in,out] val_dest - Block of the preconditioner.
+   * \param[in] val_block - Block to subtract.
+   */
+  void SubtractFromBlock(su2double *val_dest, const su2double *val_block);
+
+  /*!
+   * \overload
+   */
+  void SubtractFromBlock(float *val_dest, const su2double *val_block);
+
+  /*!
+   * \brief Get the inverse of a diagonal block of the Jacobi preconditioner.
+   * \param[in] block_i - Index of the point.
+   * \param[in] val_work - Array where the single precision blocks are converted.
+   * \return Inverse of the diagonal block in double precision.
+   */
+  const su2double *GetBlock_InvM(unsigned long block_i, su2double *val_work);
+
+  /*!
+   * \brief Incomplete LU factorization, for the double or single precision storage.
+   * \param[in,out] ilu - Entries of the ILU sparse matrix.
+   * \param[in] transposed - Factorize the transposed matrix.
+   */
+  template<class ScalarType>
+  void BuildILU(ScalarType *ilu, bool transposed);
+
+  /*!
+   * \brief Forward and backward substitution with the ILU factorization, for the double or single precision storage.
+   * \param[in] ilu - Entries of the ILU sparse matrix.
+   * \param[in,out] vec - Right hand side on input, solution on output.
+   */
+  template<class ScalarType>
+  void SolveILU(const ScalarType *ilu, CSysVector & vec);
+
+  /*!
+   * \brief Sort the rows of the domain in levels for the ILU, the rows of a level only depend on
+   *        rows of the previous levels, so they can be processed in parallel.
+   * \param[in] upper - Levels of the backward substitution (upper part) instead of the forward one (lower part).
+   * \param[out] val_nLevel - Number of levels.
+   * \param[out] val_Level_Ptr - Position of the first row of each level.
+   * \param[out] val_Level_Row - Rows sorted by level.
+   */
+  void SetILU_Levels(bool upper, unsigned long &val_nLevel, unsigned long *&val_Level_Ptr, unsigned long *&val_Level_Row);
+
+  /*!
+   * \brief Find the sparse pattern of a grid and connectivity among the patterns in use.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] EdgeConnect - Connectivity of the pattern, edges (true) or elements (false).
+   * \param[in] val_nPoint - Number of points in the grid.
+   * \param[in] val_nPointDomain - Number of points of the domain in the grid.
+   * \return Pattern of the grid, NULL if it has not been built.
+   */
+  static CSysMatrixPattern *GetPattern(CGeometry *geometry, bool EdgeConnect, unsigned long val_nPoint, unsigned long val_nPointDomain);
+
+  /*!
+   * \brief Release a sparse pattern, it is deleted when no matrix uses it.
+   * \param[in] val_pattern - Pattern that is released.
+   */
+  static void ReleasePattern(CSysMatrixPattern *val_pattern);
+
+  /*!
+   * \brief Build a level of the algebraic multigrid and the levels below it.
+   * \param[in] val_nLevel - Maximum number of coarse levels below this one.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMG_Level(unsigned short val_nLevel, CConfig *config);
+
+  /*!
+   * \brief Group the points of the domain in aggregates of strongly coupled points.
+   * \param[out] val_aggregate - Aggregate of each point of the domain.
+   * \return Number of aggregates.
+   */
+  unsigned long SetAMG_Aggregates(unsigned long *val_aggregate);
+
+  /*!
+   * \brief Build the pattern of the matrix of the coarse level from the aggregates.
+   * \param[in] val_nAggregate - Number of aggregates.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetAMG_CoarseMatrix(unsigned long val_nAggregate, CConfig *config);
+
+  /*!
+   * \brief Compute the values of the matrix of the coarse level (Galerkin product).
+   */
+  void SetAMG_CoarseValues(void);
+
+  /*!
+   * \brief Apply one V cycle of the algebraic multigrid from this level, starting from a zero solution.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Approximate solution.
+   * \param[in] geometry - Geometrical definition of the problem (NULL for the coarse levels).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AMG_Cycle(const CSysVector & b, CSysVector & x, CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Apply the smoother of a level of the algebraic multigrid.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution.
+   * \param[in] zero_guess - The initial solution is zero (x is not read).
+   * \param[in] val_nSweep - Number of smoothing sweeps.
+   * \param[in] geometry - Geometrical definition of the problem (NULL for the coarse levels).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AMG_Smooth(const CSysVector & b, CSysVector & x, bool zero_guess, unsigned short val_nSweep,
+                  CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Multiply a vector by the preconditioner used as smoother of the algebraic multigrid.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem (NULL for the coarse levels).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AMG_Precondition(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+
 public:
   
 	/*!
@@ -173,6 +472,7 @@ public:
 	 * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
 	 * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
+	 * \note Only with the double precision storage of the preconditioner (NULL otherwise).
 	 */
 	su2double *GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
   
@@ -507,6 +807,23 @@ public:
 	 */
 	void ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner. The levels are built
+   *        the first time (aggregation of the points of the domain), afterwards
+   *        only the values of the coarse matrices and of the smoothers are updated.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(CConfig *config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V cycle of the algebraic multigrid).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+
   /*!
 	 * \brief Compute the residual Ax-b
 	 * \param[in] sol - CSysVector to be multiplied by the preconditioner.
@@ -748,4 +1065,37 @@ public:
 	void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+
+public:
+
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "matrix_structure.inl"
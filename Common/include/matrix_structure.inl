@@ -38,6 +38,44 @@ inline void CSysMatrix::SetValZero(void) {
 		matrix[index] = 0.0;
 }
 
+inline unsigned long CSysMatrix::GetIndex(unsigned long block_i, unsigned long block_j) {
+  for (unsigned long index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
+    if (col_ind[index] == block_j) return index;
+  return nnz;
+}
+
+inline const su2double *CSysMatrix::LoadBlock(const su2double *val_block, su2double *val_work) { return val_block; }
+
+inline const su2double *CSysMatrix::LoadBlock(const float *val_block, su2double *val_work) {
+  for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++) val_work[iVar] = val_block[iVar];
+  return val_work;
+}
+
+inline void CSysMatrix::StoreBlock(su2double *val_dest, const su2double *val_block, bool transposed) {
+  for (unsigned long iVar = 0; iVar < nVar; iVar++)
+    for (unsigned long jVar = 0; jVar < nEqn; jVar++)
+      val_dest[iVar*nEqn+jVar] = (transposed ? val_block[jVar*nVar+iVar] : val_block[iVar*nVar+jVar]);
+}
+
+inline void CSysMatrix::StoreBlock(float *val_dest, const su2double *val_block, bool transposed) {
+  for (unsigned long iVar = 0; iVar < nVar; iVar++)
+    for (unsigned long jVar = 0; jVar < nEqn; jVar++)
+      val_dest[iVar*nEqn+jVar] = SU2_TYPE::GetValue(transposed ? val_block[jVar*nVar+iVar] : val_block[iVar*nVar+jVar]);
+}
+
+inline void CSysMatrix::SubtractFromBlock(su2double *val_dest, const su2double *val_block) {
+  for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++) val_dest[iVar] -= val_block[iVar];
+}
+
+inline void CSysMatrix::SubtractFromBlock(float *val_dest, const su2double *val_block) {
+  for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++) val_dest[iVar] -= SU2_TYPE::GetValue(val_block[iVar]);
+}
+
+inline const su2double *CSysMatrix::GetBlock_InvM(unsigned long block_i, su2double *val_work) {
+  if (prec_float) return LoadBlock(&invM_float[block_i*nVar*nEqn], val_work);
+  return &invM[block_i*nVar*nEqn];
+}
+
 inline CSysMatrixVectorProduct::CSysMatrixVectorProduct(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
   geometry = geometry_ref;
@@ -128,3 +166,18 @@ inline void CLineletPreconditioner::operator()(const CSysVector & u, CSysVector
   }
   sparse_matrix->ComputeLineletPreconditioner(u, v, geometry, config);
 }
+
+inline CAMGPreconditioner::CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CAMGPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CAMGPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeAMGPreconditioner(u, v, geometry, config);
+}
@@ -118,8 +118,21 @@ public:
                        MPI_Datatype recvtype,int source, int recvtag,
                        MPI_Comm comm, MPI_Status *status);
 
+  /*!
+   * \brief Get the time spent in the blocking communications since the start of the computation.
+   * \return Wall clock time (s) spent waiting for the other ranks.
+   */
+  static double GetWait_Time(void);
+
+  /*!
+   * \brief Add the time spent in a blocking communication which is not done through the wrapper.
+   * \param[in] val_time - Wall clock time (s) of the communication.
+   */
+  static void AddWait_Time(double val_time);
+
 protected:
   static char* buff;
+  static double Wait_Time; /*!< \brief Time spent in the blocking communications. */
 
 };
 /*!
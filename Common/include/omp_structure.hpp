@@ -0,0 +1,83 @@
+/*!
+ * \file omp_structure.hpp
+ * \brief Headers of the shared-memory (OpenMP) interface used for the hybrid
+ *        MPI+threads mode. All the functions are inline.
+ * \author SU2 Developers
+ * \version 5.0.0 "Raven"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *                 Prof. Edwin van der Weide's group at the University of Twente.
+ *                 Prof. Vincent Terrapon's group at the University of Liege.
+ *
+ * Copyright (C) 2012-2017 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*--- Threads are enabled when the code is compiled with OpenMP support
+ (e.g. configure with CXXFLAGS="-fopenmp"). They are only used with the
+ plain double datatype, the AD tapes and the complex type are not thread safe. ---*/
+
+#if defined _OPENMP && \
+    !defined COMPLEX_TYPE && \
+    !defined ADOLC_FORWARD_TYPE && \
+    !defined ADOLC_REVERSE_TYPE && \
+    !defined CODI_FORWARD_TYPE && \
+    !defined CODI_REVERSE_TYPE
+#define HAVE_OMP
+#include <omp.h>
+#endif
+
+/*--- Wrapper of the OpenMP directives, e.g. SU2_OMP(parallel for), which
+ expands to nothing when the threads are not enabled. ---*/
+
+#ifdef HAVE_OMP
+#define SU2_OMP_STR(ARGS) #ARGS
+#define SU2_OMP(ARGS) _Pragma(SU2_OMP_STR(omp ARGS))
+#else
+#define SU2_OMP(ARGS)
+#endif
+
+/*!
+ * \brief Maximum number of threads available to each MPI rank.
+ * \return Number of threads (1 if the code is compiled without OpenMP).
+ */
+inline unsigned short SU2_OMP_GetMaxThreads(void) {
+#ifdef HAVE_OMP
+  return (unsigned short)(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+/*!
+ * \brief Index of the calling thread inside a parallel region.
+ * \return Thread index (0 if the code is compiled without OpenMP).
+ */
+inline unsigned short SU2_OMP_GetThreadNum(void) {
+#ifdef HAVE_OMP
+  return (unsigned short)(omp_get_thread_num());
+#else
+  return 0;
+#endif
+}
@@ -415,14 +415,16 @@ enum ENUM_FLUIDMODEL {
 	STANDARD_AIR = 0,
 	IDEAL_GAS = 1, /*!< \brief _____. */
 	VW_GAS = 2,
-	PR_GAS = 3
+	PR_GAS = 3,
+	LUT_GAS = 4 /*!< \brief Look-up table of one of the other models. */
 };
 
 static const map<string, ENUM_FLUIDMODEL> FluidModel_Map = CCreateMap<string, ENUM_FLUIDMODEL>
 ("STANDARD_AIR", STANDARD_AIR)
 ("IDEAL_GAS", IDEAL_GAS)
 ("VW_GAS", VW_GAS)
-("PR_GAS", PR_GAS);
+("PR_GAS", PR_GAS)
+("LUT_GAS", LUT_GAS);
 
 /*!
  * \brief types of initialization option
@@ -1058,14 +1060,26 @@ static const map<string, ENUM_ADAPT> Adapt_Map = CCreateMap<string, ENUM_ADAPT>
  */
 enum ENUM_INPUT {
   SU2 = 1,                       /*!< \brief SU2 input format. */
-  CGNS = 2                     /*!< \brief CGNS input format for the computational grid. */
+  CGNS = 2,                    /*!< \brief CGNS input format for the computational grid. */
+  SU2_BINARY = 3               /*!< \brief SU2 binary input format, with an index of the sections. */
 };
 static const map<string, ENUM_INPUT> Input_Map = CCreateMap<string, ENUM_INPUT>
 ("SU2", SU2)
-("CGNS", CGNS);
+("CGNS", CGNS)
+("SU2_BINARY", SU2_BINARY);
 
 const int CGNS_STRING_SIZE = 33;/*!< \brief Length of strings used in the CGNS format. */
 
+const char SU2_BINARY_MAGIC[] = "SU2_BINARY_MESH";  /*!< \brief Identifier at the beginning of a binary SU2 mesh. */
+const int SU2_BINARY_MAGIC_SIZE = 16;               /*!< \brief Length of the identifier of the binary SU2 mesh (with the null character). */
+const int SU2_BINARY_VERSION = 1;                   /*!< \brief Version of the binary SU2 mesh format. */
+const int SU2_BINARY_HEADER_SIZE = 14;              /*!< \brief Number of entries of the header (sizes and offsets of the sections). */
+const int SU2_BINARY_TAG_SIZE = 64;                 /*!< \brief Length of the marker tags in the binary SU2 mesh. */
+const int SU2_BINARY_BOUND_RECORD = 5;              /*!< \brief Entries of a boundary element record (VTK type and up to four nodes). */
+const int SU2_BINARY_CHUNK_SIZE = 4096;             /*!< \brief Number of elements of the indexed blocks of the connectivity. */
+const char SU2_RESTART_MAGIC[] = "SU2_RESTART_BIN";  /*!< \brief Identifier at the beginning of a binary restart file. */
+const int SU2_RESTART_META_SIZE = 8;                /*!< \brief Number of values of the flow conditions at the end of a binary restart file. */
+
 /*!
  * \brief type of solution output file formats
  */
@@ -1076,7 +1090,8 @@ enum ENUM_OUTPUT {
   FIELDVIEW_BINARY = 4,  /*!< \brief FieldView binary format for the solution output. */
   CSV = 5,			         /*!< \brief Comma-separated values format for the solution output. */
   CGNS_SOL = 6,  	     	 /*!< \brief CGNS format for the solution output. */
-  PARAVIEW = 7  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW = 7,  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW_XML = 8       /*!< \brief Paraview XML binary format, one piece per rank, for the solution output. */
 };
 static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPUT>
 ("TECPLOT", TECPLOT)
@@ -1085,7 +1100,8 @@ static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPU
 ("FIELDVIEW_BINARY", FIELDVIEW_BINARY)
 ("CSV", CSV)
 ("CGNS", CGNS_SOL)
-("PARAVIEW", PARAVIEW);
+("PARAVIEW", PARAVIEW)
+("PARAVIEW_XML", PARAVIEW_XML);
 
 /*!
  * \brief type of jump definition
@@ -1098,6 +1114,22 @@ static const map<string, JUMP_DEFINITION> Jump_Map = CCreateMap<string, JUMP_DEF
 ("DIFFERENCE", DIFFERENCE)
 ("RATIO", RATIO);
 
+/*!
+ * \brief types of renumbering of the points of the grid
+ */
+enum ENUM_POINT_ORDERING {
+  NO_ORDERING = 0,       /*!< \brief Points kept in the order of the grid file. */
+  RCM_ORDERING = 1,      /*!< \brief Reverse Cuthill-McKee ordering (bandwidth reduction). */
+  HILBERT_ORDERING = 2   /*!< \brief Ordering along a Hilbert space-filling curve. */
+};
+static const map<string, ENUM_POINT_ORDERING> Point_Ordering_Map = CCreateMap<string, ENUM_POINT_ORDERING>
+("NONE", NO_ORDERING)
+("RCM", RCM_ORDERING)
+("HILBERT", HILBERT_ORDERING);
+
+const unsigned long EDGE_BLOCK_SIZE = 128;  /*!< \brief Number of consecutive edges of a block of the edge coloring (the points of a block fit in cache). */
+const unsigned short EDGE_BATCH_SIZE = 8;   /*!< \brief Number of edges whose convective fluxes are computed at once by the batched (SIMD) kernels, it divides EDGE_BLOCK_SIZE. */
+
 /*!
  * \brief type of multigrid cycle
  */
@@ -1225,7 +1257,9 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER_LUSGS = 8,  /*!< \brief LU_SGS smoother. */
   SMOOTHER_JACOBI = 9,  /*!< \brief Jacobi smoother. */
   SMOOTHER_ILU = 10,  /*!< \brief ILU smoother. */
-  SMOOTHER_LINELET = 11  /*!< \brief Linelet smoother. */
+  SMOOTHER_LINELET = 11,  /*!< \brief Linelet smoother. */
+  PIPELINED_FGMRES = 12,  /*!< \brief Flexible Generalized Minimal Residual method with a single (non-blocking) reduction per iteration. */
+  PIPELINED_CG = 13  /*!< \brief Preconditionated conjugate gradient method with a single (non-blocking) reduction per iteration. */
 };
 static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<string, ENUM_LINEAR_SOLVER>
 ("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1235,6 +1269,8 @@ static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<stri
 ("BCGSTAB", BCGSTAB)
 ("FGMRES", FGMRES)
 ("RESTARTED_FGMRES", RESTARTED_FGMRES)
+("PIPELINED_FGMRES", PIPELINED_FGMRES)
+("PIPELINED_CG", PIPELINED_CG)
 ("SMOOTHER_LUSGS", SMOOTHER_LUSGS)
 ("SMOOTHER_JACOBI", SMOOTHER_JACOBI)
 ("SMOOTHER_LINELET", SMOOTHER_LINELET)
@@ -1288,13 +1324,15 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  AMG = 5       /*!< \brief Algebraic multigrid preconditioner (aggregation). */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU0", ILU);
+("ILU0", ILU)
+("AMG", AMG);
 
 /*!
  * \brief types of analytic definitions for various geometries
@@ -341,6 +341,16 @@ public:
    */
   friend su2double dotProd(const CSysVector & u, const CSysVector & v);
   
+  /*!
+   * \brief dot-product between two CSysVectors restricted to the points of this processor
+   * \param[in] u - first CSysVector in dot product
+   * \param[in] v - second CSysVector in dot product
+   *
+   * The sum over all the processors is not done, so that several products can be
+   * gathered in a single reduction (see the pipelined Krylov solvers).
+   */
+  friend su2double dotProdLocal(const CSysVector & u, const CSysVector & v);
+  
 };
 
 /*!
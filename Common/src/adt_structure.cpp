@@ -241,97 +241,112 @@ void su2_adtBaseClass::BuildADT(unsigned short  nDim,
 su2_adtPointsOnlyClass::su2_adtPointsOnlyClass(unsigned short      nDim,
                                                unsigned long       nPoints,
                                                const su2double     *coor,
-                                               const unsigned long *pointID) {
+                                               const unsigned long *pointID,
+                                               const bool          globalTree) {
 
   /*--- Make a distinction between parallel and sequential mode. ---*/
 
 #ifdef HAVE_MPI
 
-  /*--- Parallel mode. All points are gathered on all ranks. First determine the
-        number of points per rank and store them in such a way that the info can
-        be used directly in Allgatherv. For now, we will use the regular 
-        Allgather until we add Allgatherv to the SU2_MPI wrapper. ---*/
-  
-  int rank, iProcessor, nProcessor;
-  unsigned long  iVertex, nBuffer;
-  unsigned short iDim;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-  
-  unsigned long nLocalVertex = nPoints, nGlobalVertex = 0, MaxLocalVertex = 0;
-  
-  unsigned long *Buffer_Send_nVertex    = new unsigned long [1];
-  unsigned long *Buffer_Receive_nVertex = new unsigned long [nProcessor];
-
-  Buffer_Send_nVertex[0] = nLocalVertex;
-  
-  SU2_MPI::Allreduce(&nLocalVertex, &nGlobalVertex, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-  /*--- Gather the local pointID's and the ranks of the nodes on all ranks. ---*/
-  
-  unsigned long *Buffer_Send = new unsigned long[MaxLocalVertex];
-  unsigned long *Buffer_Recv = new unsigned long[nProcessor*MaxLocalVertex];
-  
-  for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
-    Buffer_Send[iVertex] = pointID[iVertex];
-  }
-  
-  SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-  
-  /*--- Unpack the buffer into the local point ID vector. ---*/
-  
-  localPointIDs.resize(nGlobalVertex);
-  
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-    for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-      localPointIDs.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
+  if( globalTree ) {
+
+    /*--- Parallel mode. All points are gathered on all ranks. First determine the
+          number of points per rank and store them in such a way that the info can
+          be used directly in Allgatherv. For now, we will use the regular 
+          Allgather until we add Allgatherv to the SU2_MPI wrapper. ---*/
+
+    int rank, iProcessor, nProcessor;
+    unsigned long  iVertex, nBuffer;
+    unsigned short iDim;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+
+    unsigned long nLocalVertex = nPoints, nGlobalVertex = 0, MaxLocalVertex = 0;
+
+    unsigned long *Buffer_Send_nVertex    = new unsigned long [1];
+    unsigned long *Buffer_Receive_nVertex = new unsigned long [nProcessor];
+
+    Buffer_Send_nVertex[0] = nLocalVertex;
+
+    SU2_MPI::Allreduce(&nLocalVertex, &nGlobalVertex, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    /*--- Gather the local pointID's and the ranks of the nodes on all ranks. ---*/
+
+    unsigned long *Buffer_Send = new unsigned long[MaxLocalVertex];
+    unsigned long *Buffer_Recv = new unsigned long[nProcessor*MaxLocalVertex];
+
+    for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
+      Buffer_Send[iVertex] = pointID[iVertex];
+    }
+
+    SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    /*--- Unpack the buffer into the local point ID vector. ---*/
+
+    localPointIDs.reserve(nGlobalVertex);
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
+        localPointIDs.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
+
+    /*--- Now gather the ranks for all points ---*/
+
+    for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
+      Buffer_Send[iVertex] = (unsigned long) rank;
+    }
 
-  /*--- Now gather the ranks for all points ---*/
-  
-  for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
-    Buffer_Send[iVertex] = (unsigned long) rank;
+    SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    /*--- Unpack the ranks into the vector and delete buffer memory. ---*/
+
+    ranksOfPoints.reserve(nGlobalVertex);
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
+        ranksOfPoints.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
+
+    delete [] Buffer_Send;  delete [] Buffer_Recv;
+
+    /*--- Gather the coordinates of the points on all ranks. ---*/
+
+    su2double *Buffer_Send_Coord = new su2double [MaxLocalVertex*nDim];
+    su2double *Buffer_Recv_Coord = new su2double [nProcessor*MaxLocalVertex*nDim];
+
+    nBuffer = MaxLocalVertex*nDim;
+
+    for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
+      for (iDim = 0; iDim < nDim; iDim++)
+      Buffer_Send_Coord[iVertex*nDim + iDim] = coor[iVertex*nDim + iDim];
+    }
+
+    SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Recv_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    /*--- Unpack the coordinates into the vector and delete buffer memory. ---*/
+
+    coorPoints.reserve(nDim*nGlobalVertex);
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
+        for (iDim = 0; iDim < nDim; iDim++)
+        coorPoints.push_back( Buffer_Recv_Coord[iProcessor*MaxLocalVertex*nDim + iVertex*nDim + iDim] );
+
+    delete [] Buffer_Send_Coord;   delete [] Buffer_Recv_Coord;
+    delete [] Buffer_Send_nVertex; delete [] Buffer_Receive_nVertex;
   }
-  
-  SU2_MPI::Allgather(Buffer_Send, MaxLocalVertex, MPI_UNSIGNED_LONG, Buffer_Recv, MaxLocalVertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-  
-  /*--- Unpack the ranks into the vector and delete buffer memory. ---*/
-  
-  ranksOfPoints.resize(nGlobalVertex);
+  else {
 
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-    for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-      ranksOfPoints.push_back( Buffer_Recv[iProcessor*MaxLocalVertex + iVertex] );
-  
-  delete [] Buffer_Send;  delete [] Buffer_Recv;
-  
-  /*--- Gather the coordinates of the points on all ranks. ---*/
-  
-  su2double *Buffer_Send_Coord = new su2double [MaxLocalVertex*nDim];
-  su2double *Buffer_Recv_Coord = new su2double [nProcessor*MaxLocalVertex*nDim];
-  
-  nBuffer = MaxLocalVertex*nDim;
-  
-  for (iVertex = 0; iVertex < nLocalVertex; iVertex++) {
-    for (iDim = 0; iDim < nDim; iDim++)
-    Buffer_Send_Coord[iVertex*nDim + iDim] = coor[iVertex*nDim + iDim];
+    /*--- Local tree. Copy the coordinates and point IDs and set the
+          ranks to the current rank. ---*/
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    coorPoints.assign(coor, coor + nDim*nPoints);
+    localPointIDs.assign(pointID, pointID + nPoints);
+    ranksOfPoints.assign(nPoints, rank);
   }
-  
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Recv_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
-  
-  /*--- Unpack the coordinates into the vector and delete buffer memory. ---*/
-  
-  coorPoints.resize(nDim*nGlobalVertex);
-  
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-    for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-      for (iDim = 0; iDim < nDim; iDim++)
-      coorPoints.push_back( Buffer_Recv_Coord[iProcessor*MaxLocalVertex*nDim + iVertex*nDim + iDim] );
-  
-  delete [] Buffer_Send_Coord;   delete [] Buffer_Recv_Coord;
-  delete [] Buffer_Send_nVertex; delete [] Buffer_Receive_nVertex;
-  
+
 #else
 
   /*--- Sequential mode. Copy the coordinates and point IDs and
@@ -488,3 +503,352 @@ void su2_adtPointsOnlyClass::DetermineNearestNode(const su2double *coor,
   dist = sqrt(dist);
 
 }
+
+su2_adtElemClass::su2_adtElemClass(unsigned short       val_nDim,
+                                   unsigned long        nElem,
+                                   const unsigned short *nNodes,
+                                   const su2double      *coor,
+                                   const unsigned long  *elemID) {
+
+  nDim = val_nDim;
+  const unsigned short nCoorElem = N_POINTS_QUADRILATERAL*nDim;
+
+  /*--- Make a distinction between parallel and sequential mode. ---*/
+
+#ifdef HAVE_MPI
+
+  /*--- Parallel mode. All elements are gathered on all ranks, as the nearest
+        wall element can belong to any rank. The regular Allgather is used
+        with the maximum number of local elements. ---*/
+
+  int rank, iProcessor, nProcessor;
+  unsigned long iElem, jElem, nLocalElem = nElem, nGlobalElem = 0, MaxLocalElem = 0;
+  unsigned short iCoor;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+
+  unsigned long *Buffer_Receive_nElem = new unsigned long [nProcessor];
+
+  SU2_MPI::Allreduce(&nLocalElem, &nGlobalElem, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nLocalElem, &MaxLocalElem, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&nLocalElem, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nElem, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Gather the number of nodes and the local element ID's. ---*/
+
+  unsigned long *Buffer_Send = new unsigned long[2*MaxLocalElem];
+  unsigned long *Buffer_Recv = new unsigned long[2*nProcessor*MaxLocalElem];
+
+  for (iElem = 0; iElem < nLocalElem; iElem++) {
+    Buffer_Send[2*iElem]   = nNodes[iElem];
+    Buffer_Send[2*iElem+1] = elemID[iElem];
+  }
+
+  SU2_MPI::Allgather(Buffer_Send, 2*MaxLocalElem, MPI_UNSIGNED_LONG, Buffer_Recv, 2*MaxLocalElem, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  nNodesElem.reserve(nGlobalElem);
+  localElemIDs.reserve(nGlobalElem);
+  ranksOfElems.reserve(nGlobalElem);
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    for (iElem = 0; iElem < Buffer_Receive_nElem[iProcessor]; iElem++) {
+      jElem = iProcessor*MaxLocalElem + iElem;
+      nNodesElem.push_back( (unsigned short)Buffer_Recv[2*jElem] );
+      localElemIDs.push_back( Buffer_Recv[2*jElem+1] );
+      ranksOfElems.push_back( iProcessor );
+    }
+
+  delete [] Buffer_Send;  delete [] Buffer_Recv;
+
+  /*--- Gather the coordinates of the nodes of the elements. ---*/
+
+  su2double *Buffer_Send_Coord = new su2double [MaxLocalElem*nCoorElem];
+  su2double *Buffer_Recv_Coord = new su2double [nProcessor*MaxLocalElem*nCoorElem];
+
+  for (iElem = 0; iElem < nLocalElem*nCoorElem; iElem++)
+    Buffer_Send_Coord[iElem] = coor[iElem];
+
+  SU2_MPI::Allgather(Buffer_Send_Coord, MaxLocalElem*nCoorElem, MPI_DOUBLE, Buffer_Recv_Coord, MaxLocalElem*nCoorElem, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  coorElem.reserve(nCoorElem*nGlobalElem);
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    for (iElem = 0; iElem < Buffer_Receive_nElem[iProcessor]; iElem++)
+      for (iCoor = 0; iCoor < nCoorElem; iCoor++)
+        coorElem.push_back( Buffer_Recv_Coord[(iProcessor*MaxLocalElem + iElem)*nCoorElem + iCoor] );
+
+  delete [] Buffer_Send_Coord;  delete [] Buffer_Recv_Coord;
+  delete [] Buffer_Receive_nElem;
+
+#else
+
+  /*--- Sequential mode. Copy the data and set the ranks to MASTER_NODE. ---*/
+  nNodesElem.assign(nNodes, nNodes + nElem);
+  coorElem.assign(coor, coor + nCoorElem*nElem);
+  localElemIDs.assign(elemID, elemID + nElem);
+  ranksOfElems.assign(nElem, MASTER_NODE);
+
+#endif
+
+  /*--- Bounding boxes of the elements, the minimum coordinates followed by
+        the maximum coordinates. ---*/
+  const unsigned long nElemADT = nNodesElem.size();
+  BBoxCoor.resize(2*nDim*nElemADT);
+
+  for(unsigned long i=0; i<nElemADT; ++i) {
+    su2double *xMin = BBoxCoor.data() + 2*nDim*i, *xMax = xMin + nDim;
+    const su2double *coorNodes = coorElem.data() + nCoorElem*i;
+
+    for(unsigned short l=0; l<nDim; ++l) xMin[l] = xMax[l] = coorNodes[l];
+    for(unsigned short j=1; j<nNodesElem[i]; ++j)
+      for(unsigned short l=0; l<nDim; ++l) {
+        xMin[l] = min(xMin[l], coorNodes[j*nDim+l]);
+        xMax[l] = max(xMax[l], coorNodes[j*nDim+l]);
+      }
+  }
+
+  /*--- Build the tree of the bounding boxes. ---*/
+  BuildADT(2*nDim, nElemADT, BBoxCoor.data());
+
+  /*--- Work vectors of the tree search for each thread. ---*/
+  const unsigned short nThread = SU2_OMP_GetMaxThreads();
+  frontLeaves.resize(nThread);
+  frontLeavesNew.resize(nThread);
+  BBoxTargets.resize(nThread);
+  lastElem.assign(nThread, 0);
+
+  for(unsigned short i=0; i<nThread; ++i) {
+    frontLeaves[i].reserve(200);
+    frontLeavesNew[i].reserve(200);
+    BBoxTargets[i].reserve(200);
+  }
+}
+
+void su2_adtElemClass::DetermineNearestElement(const su2double *coor,
+                                               su2double       &dist,
+                                               unsigned long   &elemID,
+                                               int             &rankID) {
+
+  AD_BEGIN_PASSIVE
+
+  const unsigned short iThread = SU2_OMP_GetThreadNum();
+  vector<unsigned long> &front    = frontLeaves[iThread];
+  vector<unsigned long> &frontNew = frontLeavesNew[iThread];
+  vector<pair<su2double, unsigned long> > &targets = BBoxTargets[iThread];
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Initialize the upper bound of the distance squared with    ---*/
+  /*---         the element found by the previous search of this thread,   ---*/
+  /*---         the points are usually searched in an order such that      ---*/
+  /*---         consecutive points are close to each other.                ---*/
+  /*--------------------------------------------------------------------------*/
+
+  unsigned long minElem = lastElem[iThread];
+  su2double distMin, distMax, distUpper = DistanceSquaredToElement(minElem, coor);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Traverse the tree. The leaves and the elements whose       ---*/
+  /*---         bounding box can contain a closer element are kept, the    ---*/
+  /*---         farthest point of a bounding box reduces the upper bound.  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  front.clear();
+  front.push_back(0);
+  targets.clear();
+
+  for(;;) {
+
+    frontNew.clear();
+
+    for(unsigned long i=0; i<front.size(); ++i) {
+
+      const unsigned long ll = front[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+
+          /*--- Child is an element, it is a candidate if its bounding box
+                is closer than the upper bound. ---*/
+          const su2double *xMin = BBoxCoor.data() + 2*nDim*kk;
+          BBoxDistanceSquared(xMin, xMin+nDim, coor, distMin, distMax);
+
+          if(distMin <= distUpper) {
+            targets.push_back(make_pair(distMin, kk));
+            distUpper = min(distUpper, distMax);
+          }
+        }
+        else {
+
+          /*--- Child is a leaf, its bounding box is given by the minimum of
+                the lower corners and the maximum of the upper corners. ---*/
+          BBoxDistanceSquared(leaves[kk].xMin, leaves[kk].xMax+nDim, coor, distMin, distMax);
+
+          if(distMin <= distUpper) {
+            frontNew.push_back(kk);
+
+            const su2double *xMin = BBoxCoor.data() + 2*nDim*leaves[kk].centralNodeID;
+            BBoxDistanceSquared(xMin, xMin+nDim, coor, distMin, distMax);
+            distUpper = min(distUpper, distMax);
+          }
+        }
+      }
+    }
+
+    front.swap(frontNew);
+    if(front.size() == 0) break;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Compute the distance to the candidates in increasing order ---*/
+  /*---         of the distance to their bounding box, until the bounding  ---*/
+  /*---         box is farther than the nearest element found.             ---*/
+  /*--------------------------------------------------------------------------*/
+
+  sort(targets.begin(), targets.end());
+
+  su2double distElem = DistanceSquaredToElement(minElem, coor);
+  for(unsigned long i=0; i<targets.size(); ++i) {
+    if(targets[i].first > distElem) break;
+
+    const su2double distTarget = DistanceSquaredToElement(targets[i].second, coor);
+    if(distTarget < distElem) {
+      distElem = distTarget;
+      minElem  = targets[i].second;
+    }
+  }
+
+  lastElem[iThread] = minElem;
+
+  AD_END_PASSIVE
+
+  /* Recompute the distance to get the correct dependency if we use AD and
+     take the sqrt to obtain the correct value. */
+  dist   = sqrt(DistanceSquaredToElement(minElem, coor));
+  elemID = localElemIDs[minElem];
+  rankID = ranksOfElems[minElem];
+}
+
+su2double su2_adtElemClass::DistanceSquaredToElement(unsigned long   val_elem,
+                                                     const su2double *coor) {
+
+  const su2double *coorNodes = coorElem.data() + N_POINTS_QUADRILATERAL*nDim*val_elem;
+  const su2double *n0 = coorNodes,        *n1 = coorNodes + nDim,
+                  *n2 = coorNodes+2*nDim, *n3 = coorNodes + 3*nDim;
+
+  switch( nNodesElem[val_elem] ) {
+    case N_POINTS_LINE:
+      return DistanceSquaredToSegment(n0, n1, coor);
+
+    case N_POINTS_TRIANGLE:
+      return DistanceSquaredToTriangle(n0, n1, n2, coor);
+
+    case N_POINTS_QUADRILATERAL:
+      /* The quadrilateral is split in two triangles. */
+      return min(DistanceSquaredToTriangle(n0, n1, n2, coor),
+                 DistanceSquaredToTriangle(n0, n2, n3, coor));
+
+    default: {
+      su2double ds, dist = 0.0;
+      for(unsigned short l=0; l<nDim; ++l) {ds = coor[l] - n0[l]; dist += ds*ds;}
+      return dist;
+    }
+  }
+}
+
+su2double su2_adtElemClass::DistanceSquaredToSegment(const su2double *a,
+                                                     const su2double *b,
+                                                     const su2double *coor) {
+
+  /*--- Projection of the point on the line, limited to the segment. ---*/
+  su2double ab2 = 0.0, abap = 0.0, t = 0.0, ds, dist = 0.0;
+  for(unsigned short l=0; l<nDim; ++l) {
+    ab2  += (b[l]-a[l])*(b[l]-a[l]);
+    abap += (b[l]-a[l])*(coor[l]-a[l]);
+  }
+  if(ab2 > 0.0) {
+    t = abap/ab2;
+    if(     t < 0.0) t = 0.0;
+    else if(t > 1.0) t = 1.0;
+  }
+
+  for(unsigned short l=0; l<nDim; ++l) {
+    ds = coor[l] - (a[l] + t*(b[l]-a[l]));
+    dist += ds*ds;
+  }
+  return dist;
+}
+
+su2double su2_adtElemClass::DistanceSquaredToTriangle(const su2double *a,
+                                                      const su2double *b,
+                                                      const su2double *c,
+                                                      const su2double *coor) {
+
+  /*--- Closest point of the triangle, found from the Voronoi region of the
+        point with respect to the vertices, edges and face of the triangle
+        (C. Ericson, Real-Time Collision Detection, 2005). ---*/
+  su2double ab[3], ac[3], ap[3], bp[3], cp[3], closest[3];
+  su2double d1 = 0.0, d2 = 0.0, d3 = 0.0, d4 = 0.0, d5 = 0.0, d6 = 0.0, ds, dist = 0.0;
+  unsigned short l;
+
+  for(l=0; l<3; ++l) {
+    ab[l] = b[l] - a[l]; ac[l] = c[l] - a[l];
+    ap[l] = coor[l] - a[l]; bp[l] = coor[l] - b[l]; cp[l] = coor[l] - c[l];
+    d1 += ab[l]*ap[l]; d2 += ac[l]*ap[l];
+    d3 += ab[l]*bp[l]; d4 += ac[l]*bp[l];
+    d5 += ab[l]*cp[l]; d6 += ac[l]*cp[l];
+  }
+
+  const su2double va = d3*d6 - d5*d4, vb = d5*d2 - d1*d6, vc = d1*d4 - d3*d2;
+
+  if((d1 <= 0.0) && (d2 <= 0.0)) {
+    for(l=0; l<3; ++l) closest[l] = a[l];
+  }
+  else if((d3 >= 0.0) && (d4 <= d3)) {
+    for(l=0; l<3; ++l) closest[l] = b[l];
+  }
+  else if((d6 >= 0.0) && (d5 <= d6)) {
+    for(l=0; l<3; ++l) closest[l] = c[l];
+  }
+  else if((vc <= 0.0) && (d1 >= 0.0) && (d3 <= 0.0)) {
+    return DistanceSquaredToSegment(a, b, coor);
+  }
+  else if((vb <= 0.0) && (d2 >= 0.0) && (d6 <= 0.0)) {
+    return DistanceSquaredToSegment(a, c, coor);
+  }
+  else if((va <= 0.0) && (d4 >= d3) && (d5 >= d6)) {
+    return DistanceSquaredToSegment(b, c, coor);
+  }
+  else if(va + vb + vc > 0.0) {
+    const su2double v = vb/(va + vb + vc), w = vc/(va + vb + vc);
+    for(l=0; l<3; ++l) closest[l] = a[l] + v*ab[l] + w*ac[l];
+  }
+  else {
+    /* Degenerate triangle, the distance to its edges is used. */
+    return min(DistanceSquaredToSegment(a, b, coor),
+               min(DistanceSquaredToSegment(b, c, coor),
+                   DistanceSquaredToSegment(a, c, coor)));
+  }
+
+  for(l=0; l<3; ++l) {ds = coor[l] - closest[l]; dist += ds*ds;}
+  return dist;
+}
+
+void su2_adtElemClass::BBoxDistanceSquared(const su2double *xMin,
+                                           const su2double *xMax,
+                                           const su2double *coor,
+                                           su2double       &distMin,
+                                           su2double       &distMax) {
+
+  /*--- The minimum distance is the distance to the box (zero inside), the
+        maximum distance is the distance to its farthest corner. ---*/
+  distMin = distMax = 0.0;
+  for(unsigned short l=0; l<nDim; ++l) {
+    su2double ds = 0.0;
+    if(     coor[l] < xMin[l]) ds = xMin[l] - coor[l];
+    else if(coor[l] > xMax[l]) ds = coor[l] - xMax[l];
+    distMin += ds*ds;
+
+    ds = max(fabs(coor[l] - xMin[l]), fabs(coor[l] - xMax[l]));
+    distMax += ds*ds;
+  }
+}
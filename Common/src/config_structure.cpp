@@ -188,6 +188,7 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
   ifstream mesh_file;
   short nDim = 3;
   unsigned short iLine, nLine = 10;
+  unsigned long Header_nDim = 3;
   char cstr[200];
   string::size_type position;
 
@@ -214,6 +215,17 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
     }
     break;
 
+  case SU2_BINARY:
+
+    /*--- The dimension is the second entry of the header, after the identifier ---*/
+
+    mesh_file.close();
+    mesh_file.open(cstr, ios::in | ios::binary);
+    mesh_file.seekg(SU2_BINARY_MAGIC_SIZE + sizeof(unsigned long));
+    mesh_file.read((char *)&Header_nDim, sizeof(unsigned long));
+    if (!mesh_file.fail()) nDim = Header_nDim;
+    break;
+
   case CGNS:
 
 #ifdef HAVE_CGNS
@@ -394,6 +406,9 @@ void CConfig::SetPointersNull(void) {
   CFL_AdaptParam      = NULL;            
   CFL                 = NULL;
   HTP_Axis = NULL;
+  Partition_Weights = NULL;
+  LUT_Pressure_Limits = NULL;
+  LUT_Temperature_Limits = NULL;
   PlaneTag            = NULL;
   Kappa_Flow	      = NULL;    
   Kappa_AdjFlow       = NULL;
@@ -451,6 +466,9 @@ void CConfig::SetPointersNull(void) {
   default_grid_fix      = NULL;
   default_inc_crit      = NULL;
   default_htp_axis      = NULL;
+  default_part_weight   = NULL;
+  default_lut_pressure  = NULL;
+  default_lut_temperature = NULL;
 
   Riemann_FlowDir= NULL;
   NRBC_FlowDir = NULL;
@@ -518,6 +536,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_grid_fix      = new su2double[6];
   default_inc_crit      = new su2double[3];
   default_htp_axis      = new su2double[2];
+  default_part_weight   = new su2double[3];
+  default_lut_pressure  = new su2double[2];
+  default_lut_temperature = new su2double[2];
 
   // This config file is parsed by a number of programs to make it easy to write SU2
   // wrapper scripts (in python, go, etc.) so please do
@@ -581,6 +602,21 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the LOOK-UP TABLE model ---*/
+
+  /*!\brief LUT_FLUID_MODEL \n DESCRIPTION: Fluid model tabulated by the look-up table model (FLUID_MODEL= LUT_GAS) \n OPTIONS: See \link FluidModel_Map \endlink \n DEFAULT: PR_GAS \ingroup Config*/
+  addEnumOption("LUT_FLUID_MODEL", Kind_LUT_FluidModel, FluidModel_Map, PR_GAS);
+  /*!\brief LUT_PRESSURE_LIMITS \n DESCRIPTION: Pressure range (min, max) of the look-up tables \ingroup Config*/
+  default_lut_pressure[0] = 1.0E4; default_lut_pressure[1] = 1.0E7;
+  addDoubleArrayOption("LUT_PRESSURE_LIMITS", 2, LUT_Pressure_Limits, default_lut_pressure);
+  /*!\brief LUT_TEMPERATURE_LIMITS \n DESCRIPTION: Temperature range (min, max) of the look-up tables \ingroup Config*/
+  default_lut_temperature[0] = 250.0; default_lut_temperature[1] = 750.0;
+  addDoubleArrayOption("LUT_TEMPERATURE_LIMITS", 2, LUT_Temperature_Limits, default_lut_temperature);
+  /* DESCRIPTION: Relative error bound of the look-up tables, the cells that do not meet it use the tabulated model */
+  addDoubleOption("LUT_TOLERANCE", LUT_Tolerance, 1.0E-5);
+  /* DESCRIPTION: Maximum number of points per direction of the look-up tables */
+  addUnsignedLongOption("LUT_MAX_POINTS", LUT_MaxPoints, 257);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -916,6 +952,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addLongOption("DYN_RESTART_ITER", Dyn_RestartIter, 0);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_FLOW", Kind_TimeIntScheme_Flow, Time_Int_Map, EULER_IMPLICIT);
+  /* DESCRIPTION: Jacobian free Newton-Krylov method for the implicit flow equations, the Jacobian is the preconditioner */
+  addBoolOption("NEWTON_KRYLOV", Newton_Krylov, false);
+  /* DESCRIPTION: Relative step of the finite differences of the Newton-Krylov method */
+  addDoubleOption("NEWTON_KRYLOV_EPS", Newton_Krylov_Eps, 1E-7);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_ADJFLOW", Kind_TimeIntScheme_AdjFlow, Time_Int_Map, EULER_IMPLICIT);
   /* DESCRIPTION: Time discretization */
@@ -946,6 +986,14 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Store the ILU and Jacobi preconditioners in single precision, the Krylov solver still iterates in double precision */
+  addBoolOption("LINEAR_SOLVER_PREC_FLOAT", Linear_Solver_Prec_Float, false);
+  /* DESCRIPTION: Maximum number of coarse levels of the algebraic multigrid preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Smoother of the levels of the algebraic multigrid preconditioner (ILU0, JACOBI, LU_SGS) */
+  addEnumOption("LINEAR_SOLVER_AMG_SMOOTHER", Linear_Solver_AMG_Smoother, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Number of pre and post smoothing sweeps of the algebraic multigrid preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 1);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
   addDoubleOption("RELAXATION_FACTOR_FLOW", Relaxation_Factor_Flow, 1.0);
   /* DESCRIPTION: Relaxation of the turb equations solver for the implicit formulation */
@@ -1099,6 +1147,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("VISCOUS_LIMITER_FLOW", Viscous_Limiter_Flow, false);
   /* DESCRIPTION: Viscous limiter turbulent equations */
   addBoolOption("VISCOUS_LIMITER_TURB", Viscous_Limiter_Turb, false);
+  /* DESCRIPTION: Store the flow variables of all the points in contiguous (point-major) blocks */
+  addBoolOption("CONTIGUOUS_STORAGE", Contiguous_Storage, true);
   
   /*!\par CONFIG_CATEGORY: Adjoint and Gradient \ingroup Config*/
   /*--- Options related to the adjoint and gradient ---*/
@@ -1162,10 +1212,25 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addEnumOption("ACTDISK_JUMP", ActDisk_Jump, Jump_Map, DIFFERENCE);
   /*!\brief MESH_FORMAT \n DESCRIPTION: Mesh input file format \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
   addEnumOption("MESH_FORMAT", Mesh_FileFormat, Input_Map, SU2);
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format (SU2, SU2_BINARY). Used when converting, scaling, or deforming a mesh. \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
   /* DESCRIPTION:  Mesh input file */
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief WEIGHTED_PARTITIONING \n DESCRIPTION: Weight the vertices of the graph given to ParMETIS with the estimated cost of each point \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("WEIGHTED_PARTITIONING", Weighted_Partitioning, false);
+  /*!\brief PARTITION_WEIGHTS \n DESCRIPTION: Cost of a point, of each of its neighbors, and of each of its boundary vertices \n DEFAULT: (1.0, 1.0, 4.0) \ingroup Config*/
+  default_part_weight[0] = 1.0; default_part_weight[1] = 1.0; default_part_weight[2] = 4.0;
+  addDoubleArrayOption("PARTITION_WEIGHTS", 3, Partition_Weights, default_part_weight);
+  /*!\brief PARTITION_PROFILE_ITER \n DESCRIPTION: Iteration at which the measured cost of each rank is written to the partition profile (0 disables it) \n DEFAULT: 0 \ingroup Config*/
+  addUnsignedLongOption("PARTITION_PROFILE_ITER", Partition_Profile_Iter, 0);
+  /*!\brief READ_PARTITION_PROFILE \n DESCRIPTION: Scale the weights of the partitioning with a partition profile of a previous run \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("READ_PARTITION_PROFILE", Read_Partition_Profile, false);
+  /*!\brief PARTITION_PROFILE_FILENAME \n DESCRIPTION: Partition profile file name \n DEFAULT: partition_profile.dat \ingroup Config*/
+  addStringOption("PARTITION_PROFILE_FILENAME", Partition_Profile_FileName, string("partition_profile.dat"));
+  /*!\brief POINT_ORDERING \n DESCRIPTION: Renumbering of the points of each rank, the edges follow the order of the points \n OPTIONS: see \link Point_Ordering_Map \endlink \n DEFAULT: RCM \ingroup Config*/
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_ORDERING);
 
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
@@ -1268,6 +1333,12 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("WRT_SHARPEDGES", Wrt_SharpEdges, false);
   /* DESCRIPTION: Output the rind layers in the solution files  \ingroup Config*/
   addBoolOption("WRT_HALO", Wrt_Halo, false);
+  /*!\brief WRT_BINARY_RESTART
+   *  \n DESCRIPTION: Write the restart files in the binary SU2 format, with collective MPI-IO  \ingroup Config*/
+  addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, false);
+  /*!\brief READ_BINARY_RESTART
+   *  \n DESCRIPTION: Read the restart files in the binary SU2 format, with collective MPI-IO  \ingroup Config*/
+  addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, false);
   /*!\brief ONE_D_OUTPUT
    *  \n DESCRIPTION: Output averaged outlet flow values on specified exit marker. \n Use with MARKER_OUT_1D. \ingroup Config*/
   addBoolOption("ONE_D_OUTPUT", Wrt_1D_Output, false);
@@ -1600,6 +1671,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
    */
   addEnumOption("KIND_INTERPOLATION", Kind_Interpolation, Interpolator_Map, NEAREST_NEIGHBOR);
 
+  /*!\brief INCREMENTAL_INTERFACE_SEARCH \n DESCRIPTION: Update the nearest neighbor donors of the interfaces of unsteady
+   problems by a local search around the donors of the previous time step (rigidly sliding interfaces) \ingroup Config*/
+  addBoolOption("INCREMENTAL_INTERFACE_SEARCH", Incremental_InterfaceSearch, false);
+
   /* DESCRIPTION: Maximum number of FSI iterations */
   addUnsignedShortOption("FSI_ITER", nIterFSI, 1);
   /* DESCRIPTION: Aitken's static relaxation factor */
@@ -2114,7 +2189,19 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     cout << "Harmonic Balance not yet implemented for the incompressible solver." << endl;
     exit(EXIT_FAILURE);
   }
-  
+
+  if (Mesh_Out_FileFormat == CGNS) {
+    cout << "The output mesh can only be written in the SU2 or SU2_BINARY formats." << endl;
+    exit(EXIT_FAILURE);
+  }
+
+  if ((Wrt_Binary_Restart || Read_Binary_Restart) &&
+      ((Kind_Regime != COMPRESSIBLE) || ContinuousAdjoint ||
+       ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)))) {
+    cout << "Binary restart files are only available for the compressible flow and discrete adjoint solvers." << endl;
+    exit(EXIT_FAILURE);
+  }
+
   /*--- Check for Fluid model consistency ---*/
 
   if (standard_air) {
@@ -2123,6 +2210,21 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
 		Gas_Constant = 287.058;
         }
   }
+  /*--- Check for the look-up table fluid model ---*/
+  
+  if (Kind_FluidModel == LUT_GAS) {
+    if (Kind_LUT_FluidModel == LUT_GAS) {
+      cout << "LUT_FLUID_MODEL must be one of the other fluid models" << endl;
+      exit(EXIT_FAILURE);
+    }
+    if (LUT_Pressure_Limits[0] <= 0.0 || LUT_Pressure_Limits[1] <= LUT_Pressure_Limits[0] ||
+        LUT_Temperature_Limits[0] <= 0.0 || LUT_Temperature_Limits[1] <= LUT_Temperature_Limits[0]) {
+      cout << "LUT_PRESSURE_LIMITS and LUT_TEMPERATURE_LIMITS must be positive and in increasing order" << endl;
+      exit(EXIT_FAILURE);
+    }
+    if (LUT_MaxPoints < 9) LUT_MaxPoints = 9;
+  }
+  
   /*--- Check for Measurement System ---*/
   
   if (SystemMeasurements == US && !standard_air) {
@@ -3042,6 +3144,47 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  /*--- The single precision preconditioners would drop the derivative
+   information of the AD and complex types. ---*/
+
+#if defined COMPLEX_TYPE || defined ADOLC_FORWARD_TYPE || defined ADOLC_REVERSE_TYPE || defined CODI_FORWARD_TYPE || defined CODI_REVERSE_TYPE
+  Linear_Solver_Prec_Float = false;
+#endif
+
+  /*--- The levels of the algebraic multigrid are smoothed with one of the
+   preconditioners that are built from the matrix alone. ---*/
+
+  if ((Linear_Solver_AMG_Smoother != ILU) && (Linear_Solver_AMG_Smoother != JACOBI) &&
+      (Linear_Solver_AMG_Smoother != LU_SGS)) {
+    cout << "LINEAR_SOLVER_AMG_SMOOTHER must be ILU0, JACOBI or LU_SGS." << endl;
+    exit(EXIT_FAILURE);
+  }
+  if (Linear_Solver_AMG_Sweeps == 0) Linear_Solver_AMG_Sweeps = 1;
+
+  /*--- The Jacobian free Newton-Krylov method is only for the direct compressible
+   flow solvers, it needs a Krylov linear solver (the Jacobian is the preconditioner)
+   and a residual that does not change the problem while it is evaluated. ---*/
+
+  if (ContinuousAdjoint || DiscreteAdjoint ||
+      ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+      (Kind_Regime != COMPRESSIBLE)) Newton_Krylov = false;
+
+  if (Newton_Krylov) {
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) {
+      cout << "NEWTON_KRYLOV= YES requires TIME_DISCRE_FLOW= EULER_IMPLICIT." << endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((Kind_Linear_Solver != BCGSTAB) && (Kind_Linear_Solver != FGMRES) &&
+        (Kind_Linear_Solver != RESTARTED_FGMRES) && (Kind_Linear_Solver != PIPELINED_FGMRES)) {
+      cout << "NEWTON_KRYLOV= YES requires a Krylov linear solver (BCGSTAB, FGMRES, RESTARTED_FGMRES or PIPELINED_FGMRES)." << endl;
+      exit(EXIT_FAILURE);
+    }
+    if (Fixed_CL_Mode || (Kind_Upwind_Flow == TURKEL)) {
+      cout << "NEWTON_KRYLOV= YES is not available with FIXED_CL_MODE or the Roe-Turkel scheme." << endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
   if (DiscreteAdjoint) {
 #if !defined ADOLC_REVERSE_TYPE && !defined CODI_REVERSE_TYPE
     if (Kind_SU2 == SU2_CFD) {
@@ -4334,6 +4477,11 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case PIPELINED_FGMRES:
+              cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case SMOOTHER_JACOBI:
               cout << "A Jacobi method is used for smoothing the linear system." << endl;
               break;
@@ -4523,6 +4671,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_XML: cout << "The output file format is Paraview XML binary, written in parallel (.pvtu)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -5070,6 +5219,24 @@ unsigned short CConfig::GetMarker_CfgFile_KindBC(string val_marker) {
   return Marker_CfgFile_KindBC[iMarker_CfgFile];
 }
 
+su2double CConfig::GetMarker_PartitionWeight(unsigned short val_marker) {
+
+  /*--- The boundary conditions which search or exchange data across the
+   domain, or iterate on characteristic relations, cost more than a wall ---*/
+
+  switch (Marker_All_KindBC[val_marker]) {
+    case NEARFIELD_BOUNDARY: case INTERFACE_BOUNDARY: case FLUID_INTERFACE:
+    case ENGINE_INFLOW: case ENGINE_EXHAUST: case ACTDISK_INLET: case ACTDISK_OUTLET:
+    case RIEMANN_BOUNDARY: case NRBC_BOUNDARY:
+      return 2.0*Partition_Weights[2];
+    case SEND_RECEIVE:
+      return 0.0;
+    default:
+      return Partition_Weights[2];
+  }
+
+}
+
 unsigned short CConfig::GetMarker_CfgFile_Monitoring(string val_marker) {
   unsigned short iMarker_CfgFile;
   for (iMarker_CfgFile = 0; iMarker_CfgFile < nMarker_CfgFile; iMarker_CfgFile++)
@@ -5508,6 +5675,9 @@ CConfig::~CConfig(void) {
   if (default_grid_fix      != NULL) delete [] default_grid_fix;
   if (default_inc_crit      != NULL) delete [] default_inc_crit;
   if (default_htp_axis      != NULL) delete [] default_htp_axis;
+  if (default_part_weight   != NULL) delete [] default_part_weight;
+  if (default_lut_pressure  != NULL) delete [] default_lut_pressure;
+  if (default_lut_temperature != NULL) delete [] default_lut_temperature;
 
   if (FFDTag != NULL) delete [] FFDTag;
   if (nDV_Value != NULL) delete [] nDV_Value;
@@ -76,6 +76,13 @@ CGeometry::CGeometry(void) {
   nNewElem_Bound      = NULL;
   Marker_All_SendRecv = NULL;
   
+  nEdgeDomain      = 0;
+  nEdgeColor       = 0;
+  nEdgeColorDomain = 0;
+  EdgeColorPtr     = NULL;
+  EdgeColorIdx     = NULL;
+  Halo         = NULL;
+  
   PeriodicPoint[MAX_NUMBER_PERIODIC][2].clear();
   PeriodicElem[MAX_NUMBER_PERIODIC].clear();
 
@@ -164,6 +171,11 @@ CGeometry::~CGeometry(void) {
   if (ending_node   != NULL) delete [] ending_node;
   if (npoint_procs  != NULL) delete [] npoint_procs;
   
+  if (EdgeColorPtr != NULL) delete [] EdgeColorPtr;
+  if (EdgeColorIdx != NULL) delete [] EdgeColorIdx;
+  
+  if (Halo != NULL) delete Halo;
+  
 }
 
 su2double CGeometry::Point2Plane_Distance(su2double *Coord, su2double *iCoord, su2double *jCoord, su2double *kCoord) {
@@ -223,24 +235,44 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 void CGeometry::SetEdges(void) {
   unsigned long iPoint, jPoint;
   long iEdge;
-  unsigned short jNode, iNode;
+  unsigned short jNode, iNode, kNode, iPass;
   long TestEdge = 0;
+  vector<pair<unsigned long, unsigned short> > Neighbor;
+  
+  /*--- The edges are numbered by their first point and, for the same first
+   point, by their second point. Consecutive edges share points and follow
+   the ordering of the points (cache locality of the edge loops). The edges
+   without halo points are numbered first (first pass), so that their fluxes
+   can be computed while the values of the halo points are being exchanged. ---*/
   
   nEdge = 0;
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
-      jPoint = node[iPoint]->GetPoint(iNode);
-      for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
-        if (node[jPoint]->GetPoint(jNode) == iPoint) {
-          TestEdge = node[jPoint]->GetEdge(jNode);
-          break;
+  for (iPass = 0; iPass < 2; iPass++) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      
+      if ((iPass == 0) && !node[iPoint]->GetDomain()) continue;
+      
+      Neighbor.clear();
+      for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++)
+        Neighbor.push_back(make_pair(node[iPoint]->GetPoint(iNode), iNode));
+      sort(Neighbor.begin(), Neighbor.end());
+      
+      for (kNode = 0; kNode < Neighbor.size(); kNode++) {
+        jPoint = Neighbor[kNode].first; iNode = Neighbor[kNode].second;
+        if ((iPass == 0) && !node[jPoint]->GetDomain()) continue;
+        for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
+          if (node[jPoint]->GetPoint(jNode) == iPoint) {
+            TestEdge = node[jPoint]->GetEdge(jNode);
+            break;
+          }
+        if (TestEdge == -1) {
+          node[iPoint]->SetEdge(nEdge, iNode);
+          node[jPoint]->SetEdge(nEdge, jNode);
+          nEdge++;
         }
-      if (TestEdge == -1) {
-        node[iPoint]->SetEdge(nEdge, iNode);
-        node[jPoint]->SetEdge(nEdge, jNode);
-        nEdge++;
       }
     }
+    if (iPass == 0) nEdgeDomain = nEdge;
+  }
   
   edge = new CEdge*[nEdge];
   
@@ -252,6 +284,126 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::SetEdgeColoring(void) {
+  
+  unsigned long iEdge, iBlock, jBlock, nBlock, nBlockDomain, iPoint, iColor, iPos, EdgeBegin, EdgeEnd;
+  unsigned short iNode;
+  
+  if (EdgeColorPtr != NULL) delete [] EdgeColorPtr;
+  if (EdgeColorIdx != NULL) delete [] EdgeColorIdx;
+  
+  /*--- The edges are colored by blocks of EDGE_BLOCK_SIZE consecutive edges,
+   after the renumbering the points of a block are close in memory and each
+   thread works on whole blocks. The edges without halo points (0 to
+   nEdgeDomain-1) and the other edges are divided in blocks separately. ---*/
+  
+  nBlockDomain = (nEdgeDomain + EDGE_BLOCK_SIZE - 1)/EDGE_BLOCK_SIZE;
+  nBlock = nBlockDomain + (nEdge - nEdgeDomain + EDGE_BLOCK_SIZE - 1)/EDGE_BLOCK_SIZE;
+  
+  vector<unsigned long> EdgeBlock(nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    if (iEdge < nEdgeDomain) EdgeBlock[iEdge] = iEdge/EDGE_BLOCK_SIZE;
+    else EdgeBlock[iEdge] = nBlockDomain + (iEdge - nEdgeDomain)/EDGE_BLOCK_SIZE;
+  }
+  
+  /*--- Blocks attached to each point (CSR-like structure) ---*/
+  
+  vector<unsigned long> PointBlockPtr(nPoint+1, 0), PointBlock, LastBlock(nPoint, nBlock);
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iBlock = EdgeBlock[iEdge];
+    for (iNode = 0; iNode < 2; iNode++) {
+      iPoint = edge[iEdge]->GetNode(iNode);
+      if (LastBlock[iPoint] != iBlock) { LastBlock[iPoint] = iBlock; PointBlockPtr[iPoint+1]++; }
+    }
+  }
+  for (iPoint = 0; iPoint < nPoint; iPoint++) PointBlockPtr[iPoint+1] += PointBlockPtr[iPoint];
+  
+  PointBlock.resize(PointBlockPtr[nPoint]);
+  vector<unsigned long> Counter(PointBlockPtr.begin(), PointBlockPtr.end()-1);
+  LastBlock.assign(nPoint, nBlock);
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iBlock = EdgeBlock[iEdge];
+    for (iNode = 0; iNode < 2; iNode++) {
+      iPoint = edge[iEdge]->GetNode(iNode);
+      if (LastBlock[iPoint] != iBlock) { LastBlock[iPoint] = iBlock; PointBlock[Counter[iPoint]++] = iBlock; }
+    }
+  }
+  
+  /*--- Greedy coloring, each block takes the lowest color that is not
+   used by any other block attached to the points of its edges. The blocks
+   with halo points take different colors than the other blocks, which are
+   colored first (colors 0 to nEdgeColorDomain-1). ---*/
+  
+  vector<unsigned long> Color(nBlock, nBlock);
+  vector<bool> Used;
+  nEdgeColor = 0;
+  
+  for (iBlock = 0; iBlock < nBlock; iBlock++) {
+    
+    if (iBlock == nBlockDomain) nEdgeColorDomain = nEdgeColor;
+    
+    Used.assign(nEdgeColor+1, false);
+    
+    if (iBlock < nBlockDomain) {
+      EdgeBegin = iBlock*EDGE_BLOCK_SIZE;
+      EdgeEnd   = min(nEdgeDomain, EdgeBegin+EDGE_BLOCK_SIZE);
+    }
+    else {
+      EdgeBegin = nEdgeDomain + (iBlock-nBlockDomain)*EDGE_BLOCK_SIZE;
+      EdgeEnd   = min(nEdge, EdgeBegin+EDGE_BLOCK_SIZE);
+    }
+    for (iEdge = EdgeBegin; iEdge < EdgeEnd; iEdge++) {
+      for (iNode = 0; iNode < 2; iNode++) {
+        iPoint = edge[iEdge]->GetNode(iNode);
+        for (iPos = PointBlockPtr[iPoint]; iPos < PointBlockPtr[iPoint+1]; iPos++) {
+          jBlock = PointBlock[iPos];
+          if (Color[jBlock] < nBlock) Used[Color[jBlock]] = true;
+        }
+      }
+    }
+    
+    for (iColor = ((iBlock < nBlockDomain)? 0 : nEdgeColorDomain); Used[iColor]; iColor++);
+    Color[iBlock] = iColor;
+    if (iColor == nEdgeColor) nEdgeColor++;
+    
+  }
+  
+  if (nBlock == nBlockDomain) nEdgeColorDomain = nEdgeColor;
+  
+  /*--- Store the edges sorted by color (CSR-like structure), the blocks of
+   a color are in increasing order and the only incomplete blocks (the last
+   block without halo points and the last block with halo points) end their
+   colors. Chunks of EDGE_BLOCK_SIZE edges of a color are therefore whole
+   blocks. ---*/
+  
+  EdgeColorPtr = new unsigned long [nEdgeColor+1];
+  EdgeColorIdx = new unsigned long [nEdge];
+  
+  for (iColor = 0; iColor <= nEdgeColor; iColor++) EdgeColorPtr[iColor] = 0;
+  for (iEdge = 0; iEdge < nEdge; iEdge++) EdgeColorPtr[Color[EdgeBlock[iEdge]]+1]++;
+  for (iColor = 0; iColor < nEdgeColor; iColor++) EdgeColorPtr[iColor+1] += EdgeColorPtr[iColor];
+  
+  Counter.assign(EdgeColorPtr, EdgeColorPtr+nEdgeColor);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPos = Counter[Color[EdgeBlock[iEdge]]]++;
+    EdgeColorIdx[iPos] = iEdge;
+  }
+
+}
+
+CHaloExchange *CGeometry::GetHaloExchange(CConfig *config) {
+
+  /*--- The lists of send and receive points are taken from the vertices of
+   the SEND_RECEIVE markers, which only exist once the grid level is built. ---*/
+
+  if (Halo == NULL) Halo = new CHaloExchange(this, config);
+
+  return Halo;
+
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -1355,6 +1507,9 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
     case SU2:
       Read_SU2_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      Read_SU2_Binary_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
+      break;
     case CGNS:
       Read_CGNS_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
       break;
@@ -6859,74 +7014,54 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
 }
 
-void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
-  
-  /*--- Original CGNS reader implementation by Thomas D. Economon,
-   Francisco Palacios. Improvements for mixed-element meshes generated
-   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
-   Parallel version by Thomas D. Economon, February 2015. ---*/
+void CPhysicalGeometry::Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
   
-#ifdef HAVE_CGNS
-    
-  string text_line, Marker_Tag;
+  string Marker_Tag;
   ifstream mesh_file;
-  unsigned short VTK_Type = 0, iMarker = 0;
   unsigned short nMarker_Max = config->GetnMarker_Max();
-  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
-  unsigned long globalOffset = 0;
-  nZone = val_nZone;
-  
-  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
-  
-  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
-  su2double Coord_cgns[3] = {0.0,0.0,0.0};
-  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
-  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
-  int interiorElems = 0, totalVerts = 0;
-  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
-  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
-  char coordname[CGNS_STRING_SIZE];
-  cgsize_t* cgsize; cgsize = new cgsize_t[3];
-  ZoneType_t zonetype;
-  DataType_t datatype;
-  passivedouble** coordArray = NULL;
-  passivedouble*** gridCoords = NULL;
-  ElementType_t elemType;
-  cgsize_t range_min, range_max, startE, endE;
-  range_min = 1;
-  string currentElem;
-  int** elemTypeVTK = NULL;
-  int** elemIndex = NULL;
-  int** elemBegin = NULL;
-  int** elemEnd = NULL;
-  int** nElems = NULL;
-  cgsize_t**** connElems = NULL;
-  cgsize_t* connElemCGNS = NULL;
-  cgsize_t* connElemTemp = NULL;
-  cgsize_t ElementDataSize = 0;
-  cgsize_t* parentData = NULL;
-  int** dataSize = NULL;
-  bool** isInternal = NULL;
-  char*** sectionNames = NULL;
+  unsigned short iNode, jNode, nNodes = 0, iPeriodic, nPeriodic;
+  unsigned long iMarker, iPoint, iElem, iElem_Bound, iChunk, nChunk, Chunk_Size, Chunk_Begin, Chunk_End;
+  unsigned long VTK_Type, GlobalIndex, element_count, Offset_Point, Offset_Chunk,
+  Offset_Elem, Offset_Marker, Offset_Periodic, vnodes[8], Marker_Header[2], Bound_Record[SU2_BINARY_BOUND_RECORD];
+  unsigned long Header[SU2_BINARY_HEADER_SIZE], *Chunk_Index = NULL, *Chunk_Record = NULL;
+  unsigned long i;
+  long local_index;
+  vector<unsigned long>::iterator it;
+  char cstr[200], Magic[SU2_BINARY_MAGIC_SIZE], Tag[SU2_BINARY_TAG_SIZE];
+  passivedouble *Coord_Buffer = NULL, Angle_Offset[2], Transform[9];
+  su2double Coord[3], AoA_Offset, AoS_Offset, AoA_Current, AoS_Current;
+  int rank = MASTER_NODE, size = SINGLE_NODE;
+  bool harmonic_balance = config->GetUnsteady_Simulation() == HARMONIC_BALANCE;
+  bool actuator_disk  = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                          (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                         ((config->GetKind_SU2() == SU2_CFD) ||
+                          ((config->GetKind_SU2() == SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
+  if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
   
-  /*--- Initialize counters for local/global points & elements ---*/
+  nZone = val_nZone;
   
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
 #ifdef HAVE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
-  unsigned long Local_nElem;
-  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
-  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
-  MPI_Request *send_req, *recv_req;
-  MPI_Status  status;
-  int ind;
+  unsigned long j;
 #endif
   
-  /*--- Initialize counters for local/global points & elements ---*/
+  /*--- The binary format stores a single zone, and the surface splitting of
+   the actuator disk is only done by the ASCII reader ---*/
   
-  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  if ((val_nZone > 1 && !harmonic_balance) || actuator_disk) {
+    if (rank == MASTER_NODE)
+      cout << "The binary SU2 mesh format does not support multiple zones or actuator disks, use MESH_FORMAT= SU2." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  Global_nPoint  = 0; Global_nPointDomain   = 0; Global_nElem = 0; Global_nElemDomain = 0;
   nelem_edge     = 0; Global_nelem_edge     = 0;
   nelem_triangle = 0; Global_nelem_triangle = 0;
   nelem_quad     = 0; Global_nelem_quad     = 0;
@@ -6935,43 +7070,24 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   nelem_prism    = 0; Global_nelem_prism    = 0;
   nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
   
-  /*--- Initialize some additional counters for the parallel partitioning ---*/
-  
-  unsigned long total_pt_accounted = 0;
-  unsigned long rem_points         = 0;
-  unsigned long element_count      = 0;
-  unsigned long element_remainder  = 0;
-  unsigned long total_elems        = 0;
-  
-  /*--- Allocate memory for the linear partitioning of the mesh. These
+  /*--- Allocate memory for the linear partition of the mesh. These
    arrays are the size of the number of ranks. ---*/
   
   starting_node = new unsigned long[size];
   ending_node   = new unsigned long[size];
   npoint_procs  = new unsigned long[size];
   
-  unsigned long *nPoint_Linear = new unsigned long[size+1];
-  unsigned long *nElem_Linear  = new unsigned long[size];
-  
-  unsigned long *elemB = new unsigned long[size];
-  unsigned long *elemE = new unsigned long[size];
-  
-  unsigned long *elemGlobalID = NULL;
+  /*--- Open grid file ---*/
   
-  unsigned short *nPoinPerElem = NULL;
-  unsigned short *elemTypes = NULL;
+  strcpy (cstr, val_mesh_filename.c_str());
+  mesh_file.open(cstr, ios::in | ios::binary);
   
-  bool *isMixed = NULL;
+  /*--- Check the grid and the header of the format ---*/
   
-  unsigned short connSize = 10;
+  if (!mesh_file.fail()) mesh_file.read(Magic, SU2_BINARY_MAGIC_SIZE);
   
-  /*--- Check whether the supplied file is truly a CGNS file. ---*/
-  if (cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK) {
-    if (rank == MASTER_NODE) {
-    printf( "\n\n   !!! Error !!!\n" );
-    printf( " %s is not a CGNS file.\n", val_mesh_filename.c_str());
-    printf( " Now exiting...\n\n");
-    }
+  if (mesh_file.fail() || (strncmp(Magic, SU2_BINARY_MAGIC, SU2_BINARY_MAGIC_SIZE) != 0)) {
+    cout << "There is no binary SU2 mesh file (CPhysicalGeometry)!! " << cstr << endl;
 #ifndef HAVE_MPI
     exit(EXIT_FAILURE);
 #else
@@ -6981,94 +7097,691 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
 #endif
   }
   
-  /*--- Open the CGNS file for reading. The value of fn returned
-   is the specific index number for this file and will be
-   repeatedly used in the function calls. ---*/
+  mesh_file.read((char *)Header, SU2_BINARY_HEADER_SIZE*sizeof(unsigned long));
+  mesh_file.read((char *)Angle_Offset, 2*sizeof(passivedouble));
+  
+  nDim            = Header[1];
+  Global_nPoint   = Header[2];
+  Global_nPointDomain = Header[3];
+  Global_nElem    = Header[4];
+  Chunk_Size      = Header[5];
+  nChunk          = Header[6];
+  nMarker         = Header[7];
+  nPeriodic       = Header[8];
+  Offset_Point    = Header[9];
+  Offset_Chunk    = Header[10];
+  Offset_Elem     = Header[11];
+  Offset_Marker   = Header[12];
+  Offset_Periodic = Header[13];
   
-  if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
   if (rank == MASTER_NODE) {
-    cout << "Reading the CGNS file: ";
-    cout << val_mesh_filename.c_str() << "." << endl;
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
   }
   
-  /*--- Get the number of databases. This is the highest node
-   in the CGNS heirarchy. ---*/
-  
-  if ( cg_nbases(fn, &nbases) ) cg_error_exit();
-  if (rank == MASTER_NODE)
-    cout << "CGNS file contains " << nbases << " database(s)." << endl;
+  /*--- Offsets of the angle of attack and sideslip (in deg) ---*/
   
-  /*--- Check if there is more than one database. Throw an
-   error if there is because this reader can currently
-   only handle one database. ---*/
+  AoA_Offset = Angle_Offset[0];
+  AoA_Current = config->GetAoA() + AoA_Offset;
   
-  if ( nbases > 1 ) {
-    if (rank == MASTER_NODE) {
-    printf("\n\n   !!! Error !!!\n" );
-    printf("CGNS reader currently incapable of handling more than 1 database.");
-    printf("Now exiting...\n\n");
+  if (config->GetDiscard_InFiles() == false) {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
     }
-#ifndef HAVE_MPI
-    exit(EXIT_FAILURE);
-#else
-    MPI_Barrier(MPI_COMM_WORLD);
-    MPI_Abort(MPI_COMM_WORLD,1);
-    MPI_Finalize();
-#endif
+    config->SetAoA_Offset(AoA_Offset);
+    config->SetAoA(AoA_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
   }
   
-  /*--- Read the databases. Note that the CGNS indexing starts at 1. ---*/
+  AoS_Offset = Angle_Offset[1];
+  AoS_Current = config->GetAoS() + AoS_Offset;
   
-  for (int i = 1; i <= nbases; i++) {
-    
-    if (cg_base_read(fn, i, basename, &cell_dim, &phys_dim)) cg_error_exit();
-    
-    /*--- Get the number of zones for this base. ---*/
-    
-    if ( cg_nzones(fn, i, &nzones) ) cg_error_exit();
-    if (rank == MASTER_NODE) {
-      cout << "Database " << i << ", " << basename << ": " << nzones;
-      cout << " zone(s), cell dimension of " << cell_dim << ", physical ";
-      cout << "dimension of " << phys_dim << "." << endl;
-    }
-    
-    /*--- Check if there is more than one zone. Throw an
-     error if there is, because this reader can currently
-     only handle one zone. This could be extended in the future. ---*/
-    
-    if ( nzones > 1 ) {
-      if (rank == MASTER_NODE) {
-      printf("\n\n   !!! Error !!!\n" );
-      printf("CGNS reader currently incapable of handling more than 1 zone.");
-      printf("Now exiting...\n\n");
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+  if (config->GetDiscard_InFiles() == false) {
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
     }
+    config->SetAoS_Offset(AoS_Offset);
+    config->SetAoS(AoS_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+  }
+  
+  /*--- Number of points and possible ghost points ---*/
+  
+  if (rank == MASTER_NODE) {
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    if (size > SINGLE_NODE) cout << " ghost points before parallel partitioning." << endl;
+    else cout << " ghost points." << endl;
+  }
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
+  
+  /*--- Compute the number of points that will be on each processor.
+   This is a linear partitioning with the addition of a simple load
+   balancing for any remainder points. ---*/
+  
+  for (i = 0; i < (unsigned long)size; i++)
+    npoint_procs[i] = Global_nPoint/size;
+  for (i = 0; i < Global_nPoint%size; i++)
+    npoint_procs[i]++;
+  
+  nPoint = npoint_procs[rank];
+  nPointDomain = Global_nPointDomain;
+  starting_node[0] = 0;
+  ending_node[0]   = starting_node[0] + npoint_procs[0];
+  for (i = 1; i < (unsigned long)size; i++) {
+    starting_node[i] = ending_node[i-1];
+    ending_node[i]   = starting_node[i] + npoint_procs[i];
+  }
+  
+  /*--- The coordinates are stored contiguously, each rank only reads the
+   block of its linear partition. ---*/
+  
+  nPointNode = nPoint;
+  node = new CPoint*[nPoint];
+  Coord_Buffer = new passivedouble[nPoint*nDim];
+  
+  mesh_file.seekg(Offset_Point + starting_node[rank]*nDim*sizeof(passivedouble));
+  mesh_file.read((char *)Coord_Buffer, nPoint*nDim*sizeof(passivedouble));
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    GlobalIndex = starting_node[rank] + iPoint;
+    for (iNode = 0; iNode < nDim; iNode++)
+      Coord[iNode] = Coord_Buffer[iPoint*nDim+iNode];
+    if (nDim == 2) node[iPoint] = new CPoint(Coord[0], Coord[1], GlobalIndex, config);
+    else node[iPoint] = new CPoint(Coord[0], Coord[1], Coord[2], GlobalIndex, config);
+  }
+  
+  delete [] Coord_Buffer;
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+  
+  /*--- The elements are stored in blocks of Chunk_Size elements, and the index
+   keeps the position of each block and the range of its nodes. Only the blocks
+   that may contain a node of the linear partition are read, and any element
+   with at least one owned node is stored (i.e., there will be element redundancy,
+   since multiple ranks will store the same elems on the boundaries of the initial
+   linear partitioning). The adjacency needed by ParMETIS is built at the same time.
+   Note that every proc starts it's node indexing from zero. ---*/
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  vector< vector<unsigned long> > adj_nodes(nPoint, vector<unsigned long>(0));
+#endif
+#endif
+  
+  vector<unsigned long> Local_Elem, Local_Elem_Index;
+  
+  Chunk_Index = new unsigned long[3*nChunk];
+  mesh_file.seekg(Offset_Chunk);
+  mesh_file.read((char *)Chunk_Index, 3*nChunk*sizeof(unsigned long));
+  
+  for (iChunk = 0; iChunk < nChunk; iChunk++) {
+  
+    if ((Chunk_Index[3*iChunk+2] < starting_node[rank]) ||
+        (Chunk_Index[3*iChunk+1] >= ending_node[rank])) continue;
+  
+    Chunk_Begin = Chunk_Index[3*iChunk];
+    if (iChunk+1 < nChunk) Chunk_End = Chunk_Index[3*(iChunk+1)];
+    else Chunk_End = (Offset_Marker-Offset_Elem)/sizeof(unsigned long);
+  
+    Chunk_Record = new unsigned long[Chunk_End-Chunk_Begin];
+    mesh_file.seekg(Offset_Elem + Chunk_Begin*sizeof(unsigned long));
+    mesh_file.read((char *)Chunk_Record, (Chunk_End-Chunk_Begin)*sizeof(unsigned long));
+  
+    element_count = iChunk*Chunk_Size;
+    for (i = 0; i < Chunk_End-Chunk_Begin; i += nNodes+1) {
+  
+      VTK_Type = Chunk_Record[i];
+      switch(VTK_Type) {
+        case TRIANGLE:      nNodes = N_POINTS_TRIANGLE; break;
+        case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+        case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON; break;
+        case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON; break;
+        case PRISM:         nNodes = N_POINTS_PRISM; break;
+        case PYRAMID:       nNodes = N_POINTS_PYRAMID; break;
+        default:            nNodes = 0; break;
+      }
+      for (iNode = 0; iNode < nNodes; iNode++)
+        vnodes[iNode] = Chunk_Record[i+1+iNode];
+  
+      /*--- Decide whether we need to store this element, i.e., check if
+       any of the nodes making up this element have a global index value
+       that falls within the range of our linear partitioning. ---*/
+  
+      bool ElemIn = false;
+      for (iNode = 0; iNode < nNodes; iNode++) {
+  
+        local_index = vnodes[iNode]-starting_node[rank];
+        if ((local_index < 0) || (local_index >= (long)nPoint)) continue;
+        ElemIn = true;
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  
+        /*--- Build adjacency assuming the VTK connectivity ---*/
+  
+        switch(VTK_Type) {
+          case TRIANGLE: case TETRAHEDRON:
+            for (jNode = 0; jNode < nNodes; jNode++)
+              if (iNode != jNode) adj_nodes[local_index].push_back(vnodes[jNode]);
+            break;
+          case QUADRILATERAL:
+            adj_nodes[local_index].push_back(vnodes[(iNode+1)%4]);
+            adj_nodes[local_index].push_back(vnodes[(iNode+3)%4]);
+            break;
+          case HEXAHEDRON:
+            if (iNode < 4) {
+              adj_nodes[local_index].push_back(vnodes[(iNode+1)%4]);
+              adj_nodes[local_index].push_back(vnodes[(iNode+3)%4]);
+            } else {
+              adj_nodes[local_index].push_back(vnodes[(iNode-3)%4+4]);
+              adj_nodes[local_index].push_back(vnodes[(iNode-1)%4+4]);
+            }
+            adj_nodes[local_index].push_back(vnodes[(iNode+4)%8]);
+            break;
+          case PRISM:
+            if (iNode < 3) {
+              adj_nodes[local_index].push_back(vnodes[(iNode+1)%3]);
+              adj_nodes[local_index].push_back(vnodes[(iNode+2)%3]);
+            } else {
+              adj_nodes[local_index].push_back(vnodes[(iNode-2)%3+3]);
+              adj_nodes[local_index].push_back(vnodes[(iNode-1)%3+3]);
+            }
+            adj_nodes[local_index].push_back(vnodes[(iNode+3)%6]);
+            break;
+          case PYRAMID:
+            if (iNode < 4) {
+              adj_nodes[local_index].push_back(vnodes[(iNode+1)%4]);
+              adj_nodes[local_index].push_back(vnodes[(iNode+3)%4]);
+              adj_nodes[local_index].push_back(vnodes[4]);
+            } else {
+              for (jNode = 0; jNode < 4; jNode++)
+                adj_nodes[local_index].push_back(vnodes[jNode]);
+            }
+            break;
+        }
+  
+#endif
+#endif
+      }
+  
+      if (ElemIn) {
+        Local_Elem_Index.push_back(element_count);
+        for (iNode = 0; iNode < nNodes+1; iNode++)
+          Local_Elem.push_back(Chunk_Record[i+iNode]);
+      }
+  
+      element_count++;
+    }
+  
+    delete [] Chunk_Record;
+  
+  }
+  
+  delete [] Chunk_Index;
+  
+  /*--- Store the number of elements on the whole domain, excluding halos,
+   and the number of local elements on each rank. ---*/
+  
+  Global_nElemDomain = Global_nElem;
+  nElem = Local_Elem_Index.size();
+  
+  /*--- Begin dealing with the partitioning by adjusting the adjacency
+   information and clear out memory where possible. ---*/
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Building the graph adjacency structure." << endl;
+  
+  unsigned long loc_adjc_size = 0;
+  vector<unsigned long> adjac_vec;
+  vector<unsigned long> temp_adjacency;
+  
+  xadj = new idx_t [npoint_procs[rank]+1];
+  xadj[0] = 0;
+  
+  /*--- Sort the entries of each node and remove the duplicates, then copy
+   them into a single vector and clear memory from the multi-dim vec. ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  
+    for (j = 0; j < adj_nodes[iPoint].size(); j++)
+      temp_adjacency.push_back(adj_nodes[iPoint][j]);
+  
+    sort(temp_adjacency.begin(), temp_adjacency.end());
+    it = unique(temp_adjacency.begin(), temp_adjacency.end());
+    loc_adjc_size = it - temp_adjacency.begin();
+  
+    temp_adjacency.resize(loc_adjc_size);
+    xadj[iPoint+1] = xadj[iPoint]+loc_adjc_size;
+  
+    for (j = 0; j < loc_adjc_size; j++)
+      adjac_vec.push_back(temp_adjacency[j]);
+  
+    temp_adjacency.clear();
+    adj_nodes[iPoint].clear();
+  
+  }
+  
+  /*--- Now that we know the size, create the final adjacency array. This
+   is the array that we will feed to ParMETIS for partitioning. ---*/
+  
+  adjacency_size = xadj[npoint_procs[rank]];
+  adjacency = new idx_t [adjacency_size];
+  copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
+  xadj_size = npoint_procs[rank]+1;
+  
+  adjac_vec.clear();
+  adj_nodes.clear();
+  
+#endif
+#endif
+  
+  /*--- Store the local elements ---*/
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Distributing elements across all ranks." << endl;
+  
+  elem = new CPrimalGrid*[nElem];
+  Global_to_Local_Elem.clear();
+  
+  i = 0;
+  for (iElem = 0; iElem < nElem; iElem++) {
+  
+    VTK_Type = Local_Elem[i];
+    Global_to_Local_Elem[Local_Elem_Index[iElem]] = iElem;
+  
+    switch(VTK_Type) {
+      case TRIANGLE:
+        elem[iElem] = new CTriangle(Local_Elem[i+1], Local_Elem[i+2], Local_Elem[i+3], 2);
+        nNodes = N_POINTS_TRIANGLE; nelem_triangle++; break;
+      case QUADRILATERAL:
+        elem[iElem] = new CQuadrilateral(Local_Elem[i+1], Local_Elem[i+2], Local_Elem[i+3], Local_Elem[i+4], 2);
+        nNodes = N_POINTS_QUADRILATERAL; nelem_quad++; break;
+      case TETRAHEDRON:
+        elem[iElem] = new CTetrahedron(Local_Elem[i+1], Local_Elem[i+2], Local_Elem[i+3], Local_Elem[i+4]);
+        nNodes = N_POINTS_TETRAHEDRON; nelem_tetra++; break;
+      case HEXAHEDRON:
+        elem[iElem] = new CHexahedron(Local_Elem[i+1], Local_Elem[i+2], Local_Elem[i+3], Local_Elem[i+4],
+                                      Local_Elem[i+5], Local_Elem[i+6], Local_Elem[i+7], Local_Elem[i+8]);
+        nNodes = N_POINTS_HEXAHEDRON; nelem_hexa++; break;
+      case PRISM:
+        elem[iElem] = new CPrism(Local_Elem[i+1], Local_Elem[i+2], Local_Elem[i+3],
+                                 Local_Elem[i+4], Local_Elem[i+5], Local_Elem[i+6]);
+        nNodes = N_POINTS_PRISM; nelem_prism++; break;
+      case PYRAMID:
+        elem[iElem] = new CPyramid(Local_Elem[i+1], Local_Elem[i+2], Local_Elem[i+3],
+                                   Local_Elem[i+4], Local_Elem[i+5]);
+        nNodes = N_POINTS_PYRAMID; nelem_pyramid++; break;
+    }
+    i += nNodes+1;
+  
+  }
+  
+  Local_Elem.clear();
+  Local_Elem_Index.clear();
+  
+  /*--- Boundary markers, each marker is a tag, the number of elements and the
+   SEND_TO value, followed by fixed size records of the elements ---*/
+  
+  mesh_file.seekg(Offset_Marker);
+  
+  if (rank == MASTER_NODE) cout << nMarker << " surface markers." << endl;
+  config->SetnMarker_All(nMarker);
+  bound = new CPrimalGrid**[nMarker];
+  nElem_Bound = new unsigned long [nMarker];
+  Tag_to_Marker = new string [nMarker_Max];
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  
+    mesh_file.read(Tag, SU2_BINARY_TAG_SIZE);
+    mesh_file.read((char *)Marker_Header, 2*sizeof(unsigned long));
+    Tag[SU2_BINARY_TAG_SIZE-1] = '\0';
+    Marker_Tag = Tag;
+  
+    nElem_Bound[iMarker] = Marker_Header[0];
+    bound[iMarker] = new CPrimalGrid* [nElem_Bound[iMarker]];
+  
+    /*--- Physical boundaries definition ---*/
+  
+    if (Marker_Tag != "SEND_RECEIVE") {
+  
+      if (rank == MASTER_NODE)
+        cout << nElem_Bound[iMarker]  << " boundary elements in index "<< iMarker <<" (Marker = " <<Marker_Tag<< ")." << endl;
+  
+      nelem_edge_bound = 0; nelem_triangle_bound = 0; nelem_quad_bound = 0;
+      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+        mesh_file.read((char *)Bound_Record, SU2_BINARY_BOUND_RECORD*sizeof(unsigned long));
+        switch(Bound_Record[0]) {
+          case LINE:
+            if (nDim == 3) {
+              cout << "Please remove line boundary conditions from the mesh file!" << endl;
+#ifndef HAVE_MPI
+              exit(EXIT_FAILURE);
+#else
+              MPI_Barrier(MPI_COMM_WORLD);
+              MPI_Abort(MPI_COMM_WORLD,1);
+              MPI_Finalize();
+#endif
+            }
+            bound[iMarker][iElem_Bound] = new CLine(Bound_Record[1], Bound_Record[2], 2);
+            nelem_edge_bound++; break;
+          case TRIANGLE:
+            bound[iMarker][iElem_Bound] = new CTriangle(Bound_Record[1], Bound_Record[2], Bound_Record[3], 3);
+            nelem_triangle_bound++; break;
+          case QUADRILATERAL:
+            bound[iMarker][iElem_Bound] = new CQuadrilateral(Bound_Record[1], Bound_Record[2], Bound_Record[3], Bound_Record[4], 3);
+            nelem_quad_bound++; break;
+        }
+      }
+  
+      /*--- Update config information storing the boundary information in the right place ---*/
+  
+      Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+      config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+      config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+      config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+      config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+      config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+      config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+      config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
+      config->SetMarker_All_FSIinterface(iMarker, config->GetMarker_CfgFile_FSIinterface(Marker_Tag));
+      config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+      config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+      config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+      config->SetMarker_All_SendRecv(iMarker, NONE);
+      config->SetMarker_All_Out_1D(iMarker, config->GetMarker_CfgFile_Out_1D(Marker_Tag));
+  
+    }
+  
+    /*--- Send-Receive boundaries definition ---*/
+  
+    else {
+  
+      config->SetMarker_All_KindBC(iMarker, SEND_RECEIVE);
+      config->SetMarker_All_SendRecv(iMarker, (long)Marker_Header[1]);
+  
+      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+        mesh_file.read((char *)Bound_Record, SU2_BINARY_BOUND_RECORD*sizeof(unsigned long));
+        bound[iMarker][iElem_Bound] = new CVertexMPI(Bound_Record[1], nDim);
+        bound[iMarker][iElem_Bound]->SetRotation_Type(Bound_Record[2]);
+      }
+  
+    }
+  
+  }
+  
+  /*--- Periodic transformations (center, rotation, translation), if none
+   were found, store default zeros ---*/
+  
+  if (nPeriodic > 0) {
+  
+    if ((rank == MASTER_NODE) && (nPeriodic - 1 != 0))
+      cout << nPeriodic - 1 << " periodic transformations." << endl;
+    config->SetnPeriodicIndex(nPeriodic);
+  
+    mesh_file.seekg(Offset_Periodic);
+    for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+      mesh_file.read((char *)Transform, 9*sizeof(passivedouble));
+      su2double* center    = new su2double[3];
+      su2double* rotation  = new su2double[3];
+      su2double* translate = new su2double[3];
+      for (iNode = 0; iNode < 3; iNode++) {
+        center[iNode] = Transform[iNode]; rotation[iNode] = Transform[3+iNode]; translate[iNode] = Transform[6+iNode];
+      }
+      config->SetPeriodicCenter(iPeriodic, center);
+      config->SetPeriodicRotation(iPeriodic, rotation);
+      config->SetPeriodicTranslate(iPeriodic, translate);
+      delete [] center; delete [] rotation; delete [] translate;
+    }
+  
+  }
+  
+  else {
+    nPeriodic = 1; iPeriodic = 0;
+    config->SetnPeriodicIndex(nPeriodic);
+    su2double* center    = new su2double[3];
+    su2double* rotation  = new su2double[3];
+    su2double* translate = new su2double[3];
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      center[iDim] = 0.0; rotation[iDim] = 0.0; translate[iDim] = 0.0;
+    }
+    config->SetPeriodicCenter(iPeriodic,    center);
+    config->SetPeriodicRotation(iPeriodic,  rotation);
+    config->SetPeriodicTranslate(iPeriodic, translate);
+    delete [] center; delete [] rotation; delete [] translate;
+  }
+  
+  /*--- Close the input file ---*/
+  
+  mesh_file.close();
+  
+}
+
+void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  /*--- Original CGNS reader implementation by Thomas D. Economon,
+   Francisco Palacios. Improvements for mixed-element meshes generated
+   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
+   Parallel version by Thomas D. Economon, February 2015. ---*/
+  
+#ifdef HAVE_CGNS
+    
+  string text_line, Marker_Tag;
+  ifstream mesh_file;
+  unsigned short VTK_Type = 0, iMarker = 0;
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
+  unsigned long globalOffset = 0;
+  nZone = val_nZone;
+  
+  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+  
+  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
+  su2double Coord_cgns[3] = {0.0,0.0,0.0};
+  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
+  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
+  int interiorElems = 0, totalVerts = 0;
+  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
+  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
+  char coordname[CGNS_STRING_SIZE];
+  cgsize_t* cgsize; cgsize = new cgsize_t[3];
+  ZoneType_t zonetype;
+  DataType_t datatype;
+  passivedouble** coordArray = NULL;
+  passivedouble*** gridCoords = NULL;
+  ElementType_t elemType;
+  cgsize_t range_min, range_max, startE, endE;
+  range_min = 1;
+  string currentElem;
+  int** elemTypeVTK = NULL;
+  int** elemIndex = NULL;
+  int** elemBegin = NULL;
+  int** elemEnd = NULL;
+  int** nElems = NULL;
+  cgsize_t**** connElems = NULL;
+  cgsize_t* connElemCGNS = NULL;
+  cgsize_t* connElemTemp = NULL;
+  cgsize_t ElementDataSize = 0;
+  cgsize_t* parentData = NULL;
+  int** dataSize = NULL;
+  bool** isInternal = NULL;
+  char*** sectionNames = NULL;
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  unsigned long Local_nElem;
+  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
+  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
+  MPI_Request *send_req, *recv_req;
+  MPI_Status  status;
+  int ind;
+#endif
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+  
+  /*--- Initialize some additional counters for the parallel partitioning ---*/
+  
+  unsigned long total_pt_accounted = 0;
+  unsigned long rem_points         = 0;
+  unsigned long element_count      = 0;
+  unsigned long element_remainder  = 0;
+  unsigned long total_elems        = 0;
+  
+  /*--- Allocate memory for the linear partitioning of the mesh. These
+   arrays are the size of the number of ranks. ---*/
+  
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  
+  unsigned long *nPoint_Linear = new unsigned long[size+1];
+  unsigned long *nElem_Linear  = new unsigned long[size];
+  
+  unsigned long *elemB = new unsigned long[size];
+  unsigned long *elemE = new unsigned long[size];
+  
+  unsigned long *elemGlobalID = NULL;
+  
+  unsigned short *nPoinPerElem = NULL;
+  unsigned short *elemTypes = NULL;
+  
+  bool *isMixed = NULL;
+  
+  unsigned short connSize = 10;
+  
+  /*--- Check whether the supplied file is truly a CGNS file. ---*/
+  if (cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK) {
+    if (rank == MASTER_NODE) {
+    printf( "\n\n   !!! Error !!!\n" );
+    printf( " %s is not a CGNS file.\n", val_mesh_filename.c_str());
+    printf( " Now exiting...\n\n");
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Open the CGNS file for reading. The value of fn returned
+   is the specific index number for this file and will be
+   repeatedly used in the function calls. ---*/
+  
+  if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
+  if (rank == MASTER_NODE) {
+    cout << "Reading the CGNS file: ";
+    cout << val_mesh_filename.c_str() << "." << endl;
+  }
+  
+  /*--- Get the number of databases. This is the highest node
+   in the CGNS heirarchy. ---*/
+  
+  if ( cg_nbases(fn, &nbases) ) cg_error_exit();
+  if (rank == MASTER_NODE)
+    cout << "CGNS file contains " << nbases << " database(s)." << endl;
+  
+  /*--- Check if there is more than one database. Throw an
+   error if there is because this reader can currently
+   only handle one database. ---*/
+  
+  if ( nbases > 1 ) {
+    if (rank == MASTER_NODE) {
+    printf("\n\n   !!! Error !!!\n" );
+    printf("CGNS reader currently incapable of handling more than 1 database.");
+    printf("Now exiting...\n\n");
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Read the databases. Note that the CGNS indexing starts at 1. ---*/
+  
+  for (int i = 1; i <= nbases; i++) {
+    
+    if (cg_base_read(fn, i, basename, &cell_dim, &phys_dim)) cg_error_exit();
+    
+    /*--- Get the number of zones for this base. ---*/
+    
+    if ( cg_nzones(fn, i, &nzones) ) cg_error_exit();
+    if (rank == MASTER_NODE) {
+      cout << "Database " << i << ", " << basename << ": " << nzones;
+      cout << " zone(s), cell dimension of " << cell_dim << ", physical ";
+      cout << "dimension of " << phys_dim << "." << endl;
+    }
+    
+    /*--- Check if there is more than one zone. Throw an
+     error if there is, because this reader can currently
+     only handle one zone. This could be extended in the future. ---*/
+    
+    if ( nzones > 1 ) {
+      if (rank == MASTER_NODE) {
+      printf("\n\n   !!! Error !!!\n" );
+      printf("CGNS reader currently incapable of handling more than 1 zone.");
+      printf("Now exiting...\n\n");
+      }
+#ifndef HAVE_MPI
+      exit(EXIT_FAILURE);
+#else
+      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Abort(MPI_COMM_WORLD,1);
+      MPI_Finalize();
+#endif
+    }
+    
+    /*--- Initialize some data structures for  all zones. ---*/
+    
+    vertices     = new int[nzones];
+    cells        = new int[nzones];
+    boundVerts   = new int[nzones];
+    coordArray   = new passivedouble*[nzones];
+    gridCoords   = new passivedouble**[nzones];
+    elemTypeVTK  = new int*[nzones];
+    elemIndex    = new int*[nzones];
+    elemBegin    = new int*[nzones];
+    elemEnd      = new int*[nzones];
+    nElems       = new int*[nzones];
+    dataSize     = new int*[nzones];
+    isInternal   = new bool*[nzones];
+    nMarkers     = 0;
+    sectionNames = new char**[nzones];
+    connElems    = new cgsize_t***[nzones];
     
-    /*--- Initialize some data structures for  all zones. ---*/
-    
-    vertices     = new int[nzones];
-    cells        = new int[nzones];
-    boundVerts   = new int[nzones];
-    coordArray   = new passivedouble*[nzones];
-    gridCoords   = new passivedouble**[nzones];
-    elemTypeVTK  = new int*[nzones];
-    elemIndex    = new int*[nzones];
-    elemBegin    = new int*[nzones];
-    elemEnd      = new int*[nzones];
-    nElems       = new int*[nzones];
-    dataSize     = new int*[nzones];
-    isInternal   = new bool*[nzones];
-    nMarkers     = 0;
-    sectionNames = new char**[nzones];
-    connElems    = new cgsize_t***[nzones];
-    
     /*--- Loop over all zones in this base. Again, indexing starts at 1. ---*/
     
     for (int j = 1; j <= nzones; j++) {
@@ -7333,7 +8046,15 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
         avoid a parallel read and have the master read this section (the
         master processes all of the markers anyway). ---*/
 
-        if (nElems[j-1][s-1] < rank+1) {
+        /*--- A section with a single type of surface elements is known to be
+         a boundary from its header, only the master reads it (below), so the
+         other ranks do not need to read their slice to classify it. ---*/
+
+        bool surfaceSection = false;
+        if (cell_dim == 2) surfaceSection = ((elemType == BAR_2) || (elemType == BAR_3));
+        if (cell_dim == 3) surfaceSection = ((elemType == TRI_3) || (elemType == QUAD_4));
+
+        if ((nElems[j-1][s-1] < rank+1) || (surfaceSection && (rank != MASTER_NODE))) {
 
           isInternal[j-1][s-1] = false;
 
@@ -8989,71 +9710,80 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 
 void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
 
-  /*--- Compute the total number of nodes on no-slip boundaries ---*/
+  /*--- Compute the total number of surface elements on no-slip boundaries ---*/
 
-  unsigned long nVertex_SolidWall = 0;
+  unsigned long nElem_SolidWall = 0;
   for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
     if( (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX)  ||
        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ) {
-      nVertex_SolidWall += GetnVertex(iMarker);
+      nElem_SolidWall += GetnElem_Bound(iMarker);
     }
   }
 
-  /*--- Allocate the vectors to hold boundary node coordinates
-   and its local ID. ---*/
+  /*--- Allocate the vectors to hold the number of nodes, the node coordinates
+   and the local ID of the boundary elements. The coordinates are stored for
+   the maximum number of nodes of a surface element (quadrilateral). ---*/
 
-  vector<su2double>     Coord_bound(nDim*nVertex_SolidWall);
-  vector<unsigned long> PointIDs(nVertex_SolidWall);
+  const unsigned short nCoorElem = N_POINTS_QUADRILATERAL*nDim;
 
-  /*--- Retrieve and store the coordinates of the no-slip boundary nodes
-   and their local point IDs. ---*/
+  vector<unsigned short> nNodes_bound(nElem_SolidWall);
+  vector<su2double>      Coord_bound(nCoorElem*nElem_SolidWall, 0.0);
+  vector<unsigned long>  ElemIDs(nElem_SolidWall);
 
-  unsigned long ii = 0, jj = 0;
+  /*--- Retrieve and store the data of the no-slip boundary elements, the
+   ID of an element is its position in the list of wall elements. ---*/
+
+  unsigned long jj = 0;
   for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
     if( (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX)  ||
        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ) {
-      for(unsigned long iVertex=0; iVertex<GetnVertex(iMarker); ++iVertex) {
-        unsigned long iPoint = vertex[iMarker][iVertex]->GetNode();
-        PointIDs[jj++] = iPoint;
-        for(unsigned short iDim=0; iDim<nDim; ++iDim)
-          Coord_bound[ii++] = node[iPoint]->GetCoord(iDim);
+      for(unsigned long iElem=0; iElem<GetnElem_Bound(iMarker); ++iElem, ++jj) {
+        nNodes_bound[jj] = bound[iMarker][iElem]->GetnNodes();
+        ElemIDs[jj] = jj;
+        for(unsigned short iNode=0; iNode<nNodes_bound[jj]; ++iNode) {
+          unsigned long iPoint = bound[iMarker][iElem]->GetNode(iNode);
+          for(unsigned short iDim=0; iDim<nDim; ++iDim)
+            Coord_bound[jj*nCoorElem + iNode*nDim + iDim] = node[iPoint]->GetCoord(iDim);
+        }
       }
     }
   }
 
-  /*--- Build the ADT of the boundary nodes. ---*/
+  /*--- Build the ADT of the boundary elements of all ranks. ---*/
 
-  su2_adtPointsOnlyClass WallADT(nDim, nVertex_SolidWall, Coord_bound.data(), PointIDs.data());
+  su2_adtElemClass WallADT(nDim, nElem_SolidWall, nNodes_bound.data(), Coord_bound.data(), ElemIDs.data());
 
-  /*--- Loop over all interior mesh nodes and compute the distances to each
-   of the no-slip boundary nodes. Store the minimum distance to the wall
-   for each interior mesh node. ---*/
+  /*--- Loop over all interior mesh nodes and compute the distance to the
+   nearest no-slip boundary element. The points are searched in parallel by
+   the threads, consecutive points (close to each other after the point
+   ordering) give a good initial guess to the search of the tree. ---*/
 
   if( WallADT.IsEmpty() ) {
-  
-    /*--- No solid wall boundary nodes in the entire mesh.
+
+    /*--- No solid wall boundary elements in the entire mesh.
      Set the wall distance to zero for all nodes. ---*/
-    
+
     for(unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
       node[iPoint]->SetWall_Distance(0.0);
   }
   else {
 
-    /*--- Solid wall boundary nodes are present. Compute the wall
+    /*--- Solid wall boundary elements are present. Compute the wall
      distance for all nodes. ---*/
-    
+
+    SU2_OMP(parallel for schedule(dynamic, 512))
     for(unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-      
+
       su2double dist;
-      unsigned long pointID;
+      unsigned long elemID;
       int rankID;
-      
-      WallADT.DetermineNearestNode(node[iPoint]->GetCoord(), dist,
-                                   pointID, rankID);
+
+      WallADT.DetermineNearestElement(node[iPoint]->GetCoord(), dist,
+                                      elemID, rankID);
       node[iPoint]->SetWall_Distance(dist);
     }
   }
-  
+
 }
 
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
@@ -9182,105 +9912,40 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
           for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
             Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
             Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
-            
-            /*--- Store the point into the point ---*/
-            
-            node[iPoint]->SetPoint(Point_Neighbor);
-          }
-    }
-  
-  /*--- Set the number of neighbors variable, this is
-   important for JST and multigrid in parallel ---*/
-  
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    node[iPoint]->SetnNeighbor(node[iPoint]->GetnPoint());
-  
-}
-
-void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
-  vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
-  bool *inQueue;
-  
-  inQueue = new bool [nPoint];
-  
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    inQueue[iPoint] = false;
-  
-  /*--- Select the node with the lowest degree in the grid. ---*/
-  
-  MinDegree = node[0]->GetnNeighbor(); AddPoint = 0;
-  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
-    Degree = node[iPoint]->GetnPoint();
-    if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
-  }
-  
-  /*--- Add the node in the first free position. ---*/
-  
-  Result.push_back(AddPoint); inQueue[AddPoint] = true;
-  
-  /*--- Loop until reorganize all the nodes ---*/
-  
-  do {
-    
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
-    
-    AuxQueue.clear();
-    for (iNode = 0; iNode < node[AddPoint]->GetnPoint(); iNode++) {
-      AdjPoint = node[AddPoint]->GetPoint(iNode);
-      if ((!inQueue[AdjPoint]) && (AdjPoint < nPointDomain)) {
-        AuxQueue.push_back(AdjPoint);
-      }
-    }
-    
-    if (AuxQueue.size() != 0) {
-      
-      /*--- Sort the auxiliar queue based on the number of neighbors ---*/
-      
-      for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
-        for (jNode = 0; jNode < AuxQueue.size() - 1 - iNode; jNode++) {
-          if (node[AuxQueue[jNode]]->GetnPoint() > node[AuxQueue[jNode+1]]->GetnPoint()) {
-            AuxPoint = AuxQueue[jNode];
-            AuxQueue[jNode] = AuxQueue[jNode+1];
-            AuxQueue[jNode+1] = AuxPoint;
+            
+            /*--- Store the point into the point ---*/
+            
+            node[iPoint]->SetPoint(Point_Neighbor);
           }
-        }
-      }
-      
-      Queue.insert(Queue.end(), AuxQueue.begin(), AuxQueue.end());
-      for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
-        inQueue[AuxQueue[iNode]] = true;
-      }
-      
-    }
-    
-    /*--- Extract the first node from the queue and add it in the first free
-     position. ---*/
-    
-    if (Queue.size() != 0) {
-      AddPoint = Queue[0];
-      Result.push_back(Queue[0]);
-      Queue.erase (Queue.begin(), Queue.begin()+1);
     }
-    
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
-    
-  } while (Queue.size() != 0);
   
-  /*--- Check that all the points have been added ---*/
+  /*--- Set the number of neighbors variable, this is
+   important for JST and multigrid in parallel ---*/
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    if (inQueue[iPoint] == false) Result.push_back(iPoint);
-  }
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetnNeighbor(node[iPoint]->GetnPoint());
   
-  delete[] inQueue;
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(CConfig *config) {
+  unsigned long iPoint, iElem, iNode;
+  vector<unsigned long> Result;
+  unsigned short iDim, iMarker;
   
-  reverse(Result.begin(), Result.end());
+  /*--- New ordering of the points of the domain ---*/
+  
+  switch ((nPointDomain > 0)? config->GetKind_Point_Ordering() : NO_ORDERING) {
+    case RCM_ORDERING:
+      ComputeRCM_Ordering(Result);
+      break;
+    case HILBERT_ORDERING:
+      ComputeHilbert_Ordering(Result);
+      break;
+    default:
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        Result.push_back(iPoint);
+      break;
+  }
   
   /*--- Add the MPI points ---*/
   
@@ -9344,14 +10009,6 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
       
-      string Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-      if (Marker_Tag == "SEND_RECEIVE") {
-        for (unsigned long iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
-          if (config->GetMarker_All_SendRecv(iMarker) < 0)
-            node[bound[iMarker][iElem_Bound]->GetNode(0)]->SetDomain(false);
-        }
-      }
-      
       for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
         iPoint = bound[iMarker][iElem]->GetNode(iNode);
         bound[iMarker][iElem]->SetNode(iNode, InvResult[iPoint]);
@@ -9369,13 +10026,166 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
           node[InvResult[iPoint]]->SetSolidBoundary(true);
       }
     }
+    
+    /*--- The received points do not belong to the domain, this is done once
+     per marker, after the nodes of its elements have been renumbered. ---*/
+    
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) < 0)) {
+      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
+        node[bound[iMarker][iElem]->GetNode(0)]->SetDomain(false);
+    }
   }
   
-  
   delete[] InvResult;
   
 }
 
+void CPhysicalGeometry::ComputeRCM_Ordering(vector<unsigned long> &Result) {
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode, Head = 0, NextPoint = 0;
+  vector<unsigned long> AuxQueue;
+  unsigned short Degree, MinDegree;
+  bool *inQueue;
+  
+  inQueue = new bool [nPointDomain];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    inQueue[iPoint] = false;
+  
+  Result.clear();
+  Result.reserve(nPoint);
+  
+  /*--- Select the node with the lowest degree in the grid. ---*/
+  
+  MinDegree = node[0]->GetnPoint(); AddPoint = 0;
+  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
+    Degree = node[iPoint]->GetnPoint();
+    if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
+  }
+  
+  /*--- The points already numbered are the queue, the head of the queue
+   is the next point whose neighbors are added (breadth first search).
+   A domain made of several disconnected parts restarts the search from
+   the first point which has not been numbered. ---*/
+  
+  while (Result.size() < nPointDomain) {
+    
+    if (Head == Result.size()) {
+      if (Head > 0) {
+        while (inQueue[NextPoint]) NextPoint++;
+        AddPoint = NextPoint;
+      }
+      Result.push_back(AddPoint); inQueue[AddPoint] = true;
+    }
+    
+    AddPoint = Result[Head]; Head++;
+    
+    /*--- Add to the queue all the nodes adjacent in the increasing
+     order of their degree, checking if the element is already
+     in the Queue. ---*/
+    
+    AuxQueue.clear();
+    for (iNode = 0; iNode < node[AddPoint]->GetnPoint(); iNode++) {
+      AdjPoint = node[AddPoint]->GetPoint(iNode);
+      if ((AdjPoint < nPointDomain) && (!inQueue[AdjPoint])) {
+        AuxQueue.push_back(AdjPoint);
+      }
+    }
+    
+    /*--- Sort the auxiliar queue based on the number of neighbors ---*/
+    
+    for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
+      for (jNode = 0; jNode < AuxQueue.size() - 1 - iNode; jNode++) {
+        if (node[AuxQueue[jNode]]->GetnPoint() > node[AuxQueue[jNode+1]]->GetnPoint()) {
+          AuxPoint = AuxQueue[jNode];
+          AuxQueue[jNode] = AuxQueue[jNode+1];
+          AuxQueue[jNode+1] = AuxPoint;
+        }
+      }
+    }
+    
+    for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
+      Result.push_back(AuxQueue[iNode]);
+      inQueue[AuxQueue[iNode]] = true;
+    }
+    
+  }
+  
+  delete[] inQueue;
+  
+  reverse(Result.begin(), Result.end());
+  
+}
+
+void CPhysicalGeometry::ComputeHilbert_Ordering(vector<unsigned long> &Result) {
+  unsigned long iPoint, Key, X[3], M, P, Q, t;
+  unsigned short iDim, nBits = (nDim == 2)? 31 : 21;
+  short iBit;
+  su2double Coord_Min[3] = {0.0, 0.0, 0.0}, Coord_Max[3] = {0.0, 0.0, 0.0}, Length = 0.0, Scale;
+  vector<pair<unsigned long, unsigned long> > Point_Key(nPointDomain);
+  
+  /*--- Bounding box of the domain, the same scale is used in all the
+   directions, each coordinate is an integer with nBits bits. ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Coord_Min[iDim] = node[0]->GetCoord(iDim);
+    Coord_Max[iDim] = node[0]->GetCoord(iDim);
+  }
+  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord_Min[iDim] = min(Coord_Min[iDim], node[iPoint]->GetCoord(iDim));
+      Coord_Max[iDim] = max(Coord_Max[iDim], node[iPoint]->GetCoord(iDim));
+    }
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    Length = max(Length, Coord_Max[iDim]-Coord_Min[iDim]);
+  
+  M = 1UL << (nBits-1);
+  Scale = (Length > 0.0)? su2double((M << 1) - 1)/Length : 0.0;
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    for (iDim = 0; iDim < nDim; iDim++)
+      X[iDim] = (unsigned long)SU2_TYPE::GetValue((node[iPoint]->GetCoord(iDim)-Coord_Min[iDim])*Scale);
+    
+    /*--- Transposed Hilbert index (J. Skilling, Programming the Hilbert
+     curve, AIP Conf. Proc. 707, 2004), inverse undo and Gray encoding. ---*/
+    
+    for (Q = M; Q > 1; Q >>= 1) {
+      P = Q - 1;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        if (X[iDim] & Q) X[0] ^= P;
+        else { t = (X[0] ^ X[iDim]) & P; X[0] ^= t; X[iDim] ^= t; }
+      }
+    }
+    for (iDim = 1; iDim < nDim; iDim++) X[iDim] ^= X[iDim-1];
+    t = 0;
+    for (Q = M; Q > 1; Q >>= 1)
+      if (X[nDim-1] & Q) t ^= Q - 1;
+    for (iDim = 0; iDim < nDim; iDim++) X[iDim] ^= t;
+    
+    /*--- The index is made of the interleaved bits of the transposed index ---*/
+    
+    Key = 0;
+    for (iBit = nBits-1; iBit >= 0; iBit--)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Key = (Key << 1) | ((X[iDim] >> iBit) & 1UL);
+    
+    Point_Key[iPoint] = make_pair(Key, iPoint);
+    
+  }
+  
+  /*--- The points are numbered along the curve ---*/
+  
+  sort(Point_Key.begin(), Point_Key.end());
+  
+  Result.clear();
+  Result.reserve(nPoint);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result.push_back(Point_Key[iPoint].second);
+  
+}
+
 void CPhysicalGeometry::SetElement_Connectivity(void) {
   unsigned short first_elem_face, second_elem_face, iFace, iNode, jElem;
   unsigned long face_point, Test_Elem, iElem;
@@ -11494,6 +12304,9 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     
     real_t ubvec;
     real_t *tpwgts = new real_t[size];
+    idx_t *vwgt    = NULL;
+    
+    bool weighted = config->GetWeighted_Partitioning();
     
     /*--- Some recommended defaults for the various ParMETIS options. ---*/
     
@@ -11519,9 +12332,18 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       vtxdist[i+1] = (idx_t)ending_node[i];
     }
     
+    /*--- Weight the vertices of the graph with the estimated cost of each
+     point, the weights are only on the vertices (wgtflag = 2). ---*/
+    
+    if (weighted) {
+      vwgt = new idx_t[nPoint];
+      SetPartition_Weights(config, vwgt);
+      wgtflag = 2;
+    }
+    
     /*--- Calling ParMETIS ---*/
     if (rank == MASTER_NODE) cout << "Calling ParMETIS..." << endl;
-    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, NULL, NULL, &wgtflag,
+    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, vwgt, NULL, &wgtflag,
                          &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
                          &edgecut, part, &comm);
     if (rank == MASTER_NODE) {
@@ -11529,6 +12351,35 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       cout << edgecut << " edge cuts)." << endl;
     }
     
+    /*--- Estimated imbalance of the partitions, ratio between the weight of
+     the heaviest partition and the mean weight. ---*/
+    
+    if (weighted) {
+      
+      su2double *Part_Weight     = new su2double[size];
+      su2double *Part_Weight_Tot = new su2double[size];
+      su2double Max_Weight = 0.0, Total_Weight = 0.0;
+      
+      for (int i = 0; i < size; i++) Part_Weight[i] = 0.0;
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        Part_Weight[part[iPoint]] += su2double(vwgt[iPoint]);
+      
+      SU2_MPI::Allreduce(Part_Weight, Part_Weight_Tot, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      
+      for (int i = 0; i < size; i++) {
+        Total_Weight += Part_Weight_Tot[i];
+        Max_Weight = max(Max_Weight, Part_Weight_Tot[i]);
+      }
+      
+      if (rank == MASTER_NODE)
+        cout << "Estimated load imbalance of the partitions: "
+        << 100.0*(Max_Weight*su2double(size)/Total_Weight - 1.0) << "%." << endl;
+      
+      delete [] Part_Weight;
+      delete [] Part_Weight_Tot;
+      
+    }
+    
     /*--- Store the results of the partitioning (note that this is local
      since each processor is calling ParMETIS in parallel and storing the
      results for its initial piece of the grid. ---*/
@@ -11542,6 +12393,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     delete [] vtxdist;
     delete [] part;
     delete [] tpwgts;
+    if (vwgt != NULL) delete [] vwgt;
     
   }
   
@@ -11556,6 +12408,216 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
   
 }
 
+#ifdef HAVE_PARMETIS
+void CPhysicalGeometry::SetPartition_Weights(CConfig *config, idx_t *vwgt) {
+  
+  unsigned long iPoint, iElem_Bound, GlobalIndex, nPoint_Profile = 0;
+  unsigned short iMarker, iNode;
+  su2double Marker_Weight, Local_Weight = 0.0, Global_Weight = 0.0, Scale;
+  passivedouble *Profile = NULL;
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  
+  su2double *Cost = new su2double[nPoint];
+  short *Marker_Done = new short[nPoint];
+  
+  /*--- Cost of the point itself and of the edges to its neighbors, the
+   number of neighbors is given by the adjacency of the graph. ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Cost[iPoint] = config->GetPartition_Weights(0) +
+    config->GetPartition_Weights(1)*su2double(xadj[iPoint+1]-xadj[iPoint]);
+    Marker_Done[iPoint] = -1;
+  }
+  
+  /*--- Cost of the boundary conditions, every rank has all the boundary
+   elements (with the global numbering), a point counts once per marker. ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    Marker_Weight = config->GetMarker_PartitionWeight(iMarker);
+    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+      for (iNode = 0; iNode < bound[iMarker][iElem_Bound]->GetnNodes(); iNode++) {
+        GlobalIndex = bound[iMarker][iElem_Bound]->GetNode(iNode);
+        if ((GlobalIndex >= starting_node[rank]) && (GlobalIndex < ending_node[rank])) {
+          iPoint = GlobalIndex - starting_node[rank];
+          if (Marker_Done[iPoint] != iMarker) {
+            Cost[iPoint] += Marker_Weight;
+            Marker_Done[iPoint] = iMarker;
+          }
+        }
+      }
+    }
+  }
+  
+  /*--- Scale with the measured cost of a previous run, the profile has the
+   number of points followed by a factor per point in the global numbering. ---*/
+  
+  if (config->GetRead_Partition_Profile()) {
+    
+    MPI_File fhr;
+    MPI_Status status;
+    string filename = config->GetPartition_Profile_FileName();
+    int ierr;
+    
+    ierr = MPI_File_open(MPI_COMM_WORLD, (char *)filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhr);
+    if (ierr == MPI_SUCCESS) {
+      
+      MPI_File_read_at(fhr, 0, &nPoint_Profile, 1, MPI_UNSIGNED_LONG, &status);
+      
+      if (nPoint_Profile == Global_nPointDomain) {
+        
+        /*--- The points beyond the domain (periodic copies) keep their estimated cost ---*/
+        
+        Profile = new passivedouble[nPoint];
+        for (iPoint = 0; iPoint < nPoint; iPoint++) Profile[iPoint] = 1.0;
+        
+        unsigned long nPoint_Read = 0;
+        if (starting_node[rank] < nPoint_Profile)
+          nPoint_Read = min(ending_node[rank], nPoint_Profile) - starting_node[rank];
+        
+        MPI_File_read_at(fhr, sizeof(unsigned long) + starting_node[rank]*sizeof(passivedouble),
+                         Profile, nPoint_Read, MPI_DOUBLE, &status);
+        
+        for (iPoint = 0; iPoint < nPoint; iPoint++)
+          Cost[iPoint] *= Profile[iPoint];
+        
+        delete [] Profile;
+        
+      }
+      
+      MPI_File_close(&fhr);
+      
+    }
+    
+    if (rank == MASTER_NODE) {
+      if (ierr != MPI_SUCCESS)
+        cout << "Unable to open the partition profile " << filename << ", the estimated cost is used." << endl;
+      else if (nPoint_Profile != Global_nPointDomain)
+        cout << "The partition profile " << filename << " does not match the grid, the estimated cost is used." << endl;
+      else
+        cout << "Weighting the partitioning with the partition profile " << filename << "." << endl;
+    }
+    
+  }
+  
+  /*--- ParMETIS needs integer weights, their sum must fit in an idx_t.
+   The mean point gets a weight of 100, unless the grid is too large. ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) Local_Weight += Cost[iPoint];
+  SU2_MPI::Allreduce(&Local_Weight, &Global_Weight, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  
+  Scale = 100.0*su2double(ending_node[size-1])/Global_Weight;
+  Scale = min(Scale, 1.0E9/Global_Weight);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    vwgt[iPoint] = max((idx_t)1, (idx_t)SU2_TYPE::Int(Cost[iPoint]*Scale + 0.5));
+  
+  delete [] Cost;
+  delete [] Marker_Done;
+  
+}
+#endif
+
+void CPhysicalGeometry::SetPartition_Profile(CConfig *config, su2double val_ComputeTime) {
+  
+#ifdef HAVE_MPI
+  
+  unsigned long iPoint, *Index;
+  unsigned short iMarker;
+  su2double Local_Cost = 0.0, Cost[2], Total_Cost[2], Factor;
+  passivedouble *Profile;
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  
+  if (size == SINGLE_NODE) return;
+  
+  /*--- Estimated cost of the points of the rank, as in the weights of the partitioning ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Local_Cost += config->GetPartition_Weights(0) +
+    config->GetPartition_Weights(1)*su2double(node[iPoint]->GetnPoint());
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+      if (node[vertex[iMarker][iVertex]->GetNode()]->GetDomain())
+        Local_Cost += config->GetMarker_PartitionWeight(iMarker);
+  }
+  
+  /*--- Ratio between the measured and the estimated cost of the rank,
+   relative to the ratio of the whole computation. ---*/
+  
+  Cost[0] = val_ComputeTime; Cost[1] = Local_Cost;
+  SU2_MPI::Allreduce(Cost, Total_Cost, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  
+  Factor = 1.0;
+  if ((Local_Cost > 0.0) && (Total_Cost[0] > 0.0))
+    Factor = (val_ComputeTime/Local_Cost)/(Total_Cost[0]/Total_Cost[1]);
+  
+  /*--- Each rank writes the factor of its points in the global numbering ---*/
+  
+  Index   = new unsigned long[nPointDomain];
+  Profile = new passivedouble[nPointDomain];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Index[iPoint] = node[iPoint]->GetGlobalIndex();
+    Profile[iPoint] = SU2_TYPE::GetValue(Factor);
+  }
+  sort(Index, Index+nPointDomain);
+  
+  int *Displacement = new int[nPointDomain];
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Displacement[iPoint] = (int)Index[iPoint];
+  
+  MPI_File fhw;
+  MPI_Status status;
+  MPI_Datatype filetype;
+  string filename = config->GetPartition_Profile_FileName();
+  int ierr;
+  
+  ierr = MPI_File_open(MPI_COMM_WORLD, (char *)filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "Unable to open the partition profile " << filename << "." << endl;
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  MPI_File_set_size(fhw, 0);
+  
+  if (rank == MASTER_NODE)
+    MPI_File_write_at(fhw, 0, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, &status);
+  
+  MPI_Type_create_indexed_block((int)nPointDomain, 1, Displacement, MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+  MPI_File_set_view(fhw, sizeof(unsigned long), MPI_DOUBLE, filetype, (char *)"native", MPI_INFO_NULL);
+  MPI_File_write_all(fhw, Profile, (int)nPointDomain, MPI_DOUBLE, &status);
+  MPI_Type_free(&filetype);
+  
+  MPI_File_close(&fhw);
+  
+  /*--- Summary of the balance of the computation ---*/
+  
+  su2double Max_Time;
+  SU2_MPI::Allreduce(&val_ComputeTime, &Max_Time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  
+  if (rank == MASTER_NODE) {
+    cout << "Measured load imbalance of the ranks: ";
+    cout << 100.0*(Max_Time*su2double(size)/Total_Cost[0] - 1.0) << "%." << endl;
+    cout << "Partition profile written in " << filename << ", restart with ";
+    cout << "READ_PARTITION_PROFILE= YES to repartition the grid." << endl;
+  }
+  
+  delete [] Index;
+  delete [] Profile;
+  delete [] Displacement;
+  
+#endif
+  
+}
+
 void CPhysicalGeometry::GetQualityStatistics(su2double *statistics) {
   unsigned long jPoint, Point_2, Point_3, iElem;
   su2double *Coord_j, *Coord_2, *Coord_3;
@@ -12964,6 +14026,68 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     filename = config->GetUnsteady_FileName(filename, nExtIter-1);
   }
 
+  /*--- In a binary restart file the records of the points have a fixed
+   length, so each rank only reads the sensitivity of its own points, and
+   the variable is located by its name in the header. ---*/
+
+  if (config->GetRead_Binary_Restart()) {
+
+    char Magic[SU2_BINARY_MAGIC_SIZE], *Names;
+    unsigned long Header[2], nFields, Data_Offset;
+    long iField, Sens_Field = -1;
+    passivedouble Sens_Record[3], Restart_Meta[SU2_RESTART_META_SIZE];
+
+    restart_file.open(filename.data(), ios::in | ios::binary);
+    if (restart_file.fail()) {
+      cout << "There is no adjoint restart file!! " << filename.data() << "."<< endl;
+      exit(EXIT_FAILURE);
+    }
+
+    restart_file.read(Magic, SU2_BINARY_MAGIC_SIZE);
+    restart_file.read((char *)Header, 2*sizeof(unsigned long));
+    if ((strncmp(Magic, SU2_RESTART_MAGIC, SU2_BINARY_MAGIC_SIZE) != 0) ||
+        (Header[1] != GetGlobal_nPointDomain())) {
+      cout << "The adjoint restart file " << filename.data() << " is not a binary restart file of this mesh." << endl;
+      exit(EXIT_FAILURE);
+    }
+    nFields = Header[0];
+
+    Names = new char[nFields*SU2_BINARY_TAG_SIZE];
+    restart_file.read(Names, nFields*SU2_BINARY_TAG_SIZE);
+    for (iField = 0; iField < (long)nFields; iField++)
+      if (strcmp(&Names[iField*SU2_BINARY_TAG_SIZE], "Sensitivity_x") == 0) Sens_Field = iField;
+    delete [] Names;
+
+    if (Sens_Field < 0) {
+      cout << "There is no surface sensitivity in the adjoint restart file " << filename.data() << "." << endl;
+      exit(EXIT_FAILURE);
+    }
+
+    if (rank == MASTER_NODE)
+      cout << "Reading in sensitivity at iteration " << nExtIter-1 << "."<< endl;
+
+    Data_Offset = SU2_BINARY_MAGIC_SIZE + 2*sizeof(unsigned long) + nFields*SU2_BINARY_TAG_SIZE;
+
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      iPoint_Global = node[iPoint]->GetGlobalIndex();
+      restart_file.seekg(Data_Offset + (iPoint_Global*nFields + Sens_Field)*sizeof(passivedouble));
+      restart_file.read((char *)Sens_Record, nDim*sizeof(passivedouble));
+      for (iDim = 0; iDim < nDim; iDim++)
+        Sensitivity[iPoint*nDim+iDim] = Sens_Record[iDim];
+    }
+
+    /*--- The AoA sensitivity is stored with the flow conditions after the data ---*/
+
+    restart_file.seekg(Data_Offset + Header[1]*nFields*sizeof(passivedouble));
+    restart_file.read((char *)Restart_Meta, SU2_RESTART_META_SIZE*sizeof(passivedouble));
+    config->SetAoA_Sens(Restart_Meta[4]);
+
+    restart_file.close();
+
+    return;
+
+  }
+
   restart_file.open(filename.data(), ios::in);
   if (restart_file.fail()) {
     cout << "There is no adjoint restart file!! " << filename.data() << "."<< endl;
@@ -13530,7 +14654,7 @@ void CPhysicalGeometry::Compute_Wing(CConfig *config, bool original_surface,
     
     /*--- Write an output file---*/
 
-    if (config->GetOutput_FileFormat() == PARAVIEW) {
+    if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
       Wing_File.open("Wing_Distribution.csv", ios::out);
       if (config->GetSystemMeasurements() == US)
         Wing_File << "\"yCoord/SemiSpan\",\"Area (in^2)\",\"Max. Thickness (in)\",\"Chord (in)\",\"t_max/c\",\"Twist (deg)\",\"Curvature (1/in)\",\"Dihedral (deg)\",\"Leading Edge X (in)\",\"Leading Edge Y (in)\",\"Leading Edge Z (in)\",\"Trailing Edge X (in)\",\"Trailing Edge Y (in)\",\"Trailing Edge Z (in)\"" << endl;
@@ -13618,7 +14742,7 @@ void CPhysicalGeometry::Compute_Wing(CConfig *config, bool original_surface,
 
     for (iPlane = 0; iPlane < nPlane; iPlane++) {
     	if (Xcoord_Airfoil[iPlane].size() != 0) {
-    		if (config->GetOutput_FileFormat() == PARAVIEW) {
+    		if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
     			Wing_File  << Ycoord_Airfoil[iPlane][0]/SemiSpan <<", "<< Area[iPlane]  <<", "<< MaxThickness[iPlane]  <<", "<< Chord[iPlane]  <<", "<< ToC[iPlane]
     			                                                                                                                                            <<", "<< Twist[iPlane] <<", "<< Curvature[iPlane] <<", "<< Dihedral[iPlane]
     			                                                                                                                                                                                                                <<", "<< LeadingEdge[iPlane][0] <<", "<< LeadingEdge[iPlane][1]  <<", "<< LeadingEdge[iPlane][2]
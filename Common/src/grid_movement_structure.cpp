@@ -215,6 +215,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner(config);
+    		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
@@ -293,6 +299,22 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
         
         break;
         
+        /*--- Solve the linear system (pipelined GMRES, one reduction per iteration) ---*/
+        
+      case PIPELINED_FGMRES:
+        
+        Tot_Iter = system->FGMRES_Pipelined_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+        
+        break;
+        
+        /*--- Solve the linear system (pipelined CG, the stiffness matrix is symmetric positive definite) ---*/
+        
+      case PIPELINED_CG:
+        
+        Tot_Iter = system->CG_Pipelined_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+        
+        break;
+        
     }
     
     /*--- Deallocate memory needed by the Krylov linear solver ---*/
@@ -2827,7 +2849,7 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
         /*--- Output original FFD FFDBox ---*/
         
         if (rank == MASTER_NODE) {
-          if (config->GetOutput_FileFormat() == PARAVIEW) {
+          if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
             cout << "Writing a Paraview file of the FFD boxes." << endl;
             FFDBox[iFFDBox]->SetParaview(geometry, iFFDBox, true);
           }
@@ -2902,7 +2924,7 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
       /*--- Output original FFD FFDBox ---*/
       
       if (rank == MASTER_NODE) {
-        if (config->GetOutput_FileFormat() == PARAVIEW) {
+        if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
           cout << "Writing a Paraview file of the FFD boxes." << endl;
           for (iFFDBox = 0; iFFDBox < GetnFFDBox(); iFFDBox++) {
             FFDBox[iFFDBox]->SetParaview(geometry, iFFDBox, true);
@@ -3036,7 +3058,7 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
         /*--- Output the deformed FFD Boxes ---*/
         
         if (rank == MASTER_NODE) {
-          if (config->GetOutput_FileFormat() == PARAVIEW) {
+          if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
             cout << "Writing a Paraview file of the FFD boxes." << endl;
             for (iFFDBox = 0; iFFDBox < GetnFFDBox(); iFFDBox++) {
               FFDBox[iFFDBox]->SetParaview(geometry, iFFDBox, false);
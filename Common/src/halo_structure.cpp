@@ -0,0 +1,355 @@
+/*!
+ * \file halo_structure.cpp
+ * \brief Main subroutines for the exchange of the halo points between ranks.
+ * \author SU2 Developers
+ * \version 5.0.0 "Raven"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *                 Prof. Edwin van der Weide's group at the University of Twente.
+ *                 Prof. Vincent Terrapon's group at the University of Liege.
+ *
+ * Copyright (C) 2012-2017 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/halo_structure.hpp"
+#include "../include/geometry_structure.hpp"
+
+CHaloExchange::CHaloExchange(CGeometry *geometry, CConfig *config) {
+
+  unsigned short iMarker, MarkerS, MarkerR;
+  unsigned long iVertex, iPos;
+  int iNeighbor, send_to, receive_from;
+
+  nChannel       = 0;
+  Channel_nVar   = NULL;
+  Channel_Active = NULL;
+  Buffer_Send    = NULL;
+  Buffer_Recv    = NULL;
+#ifdef HAVE_MPI
+  Request        = NULL;
+  Status         = NULL;
+#endif
+
+  /*--- Merge the vertices of the send/receive marker pairs per neighbour rank.
+   The markers are visited in the same order as in the marker-by-marker
+   exchanges, so that the messages of two ranks that share several markers
+   are packed consistently on both sides. ---*/
+
+  vector<int> Rank_Send, Rank_Recv;
+  vector<vector<unsigned long> > List_Send, List_Recv;
+  vector<vector<unsigned short> > List_Rotation;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+
+      send_to      = config->GetMarker_All_SendRecv(MarkerS)-1;
+      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+
+      iNeighbor = int(find(Rank_Send.begin(), Rank_Send.end(), send_to) - Rank_Send.begin());
+      if (iNeighbor == int(Rank_Send.size())) {
+        Rank_Send.push_back(send_to);
+        List_Send.push_back(vector<unsigned long>());
+      }
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerS]; iVertex++)
+        List_Send[iNeighbor].push_back(geometry->vertex[MarkerS][iVertex]->GetNode());
+
+      iNeighbor = int(find(Rank_Recv.begin(), Rank_Recv.end(), receive_from) - Rank_Recv.begin());
+      if (iNeighbor == int(Rank_Recv.size())) {
+        Rank_Recv.push_back(receive_from);
+        List_Recv.push_back(vector<unsigned long>());
+        List_Rotation.push_back(vector<unsigned short>());
+      }
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerR]; iVertex++) {
+        List_Recv[iNeighbor].push_back(geometry->vertex[MarkerR][iVertex]->GetNode());
+        List_Rotation[iNeighbor].push_back(geometry->vertex[MarkerR][iVertex]->GetRotation_Type());
+      }
+
+    }
+
+  }
+
+  /*--- Store the lists in CSR-like arrays ---*/
+
+  nNeighbor_Send = int(Rank_Send.size());
+  nNeighbor_Recv = int(Rank_Recv.size());
+
+  Neighbor_Send = new int [nNeighbor_Send];
+  Neighbor_Recv = new int [nNeighbor_Recv];
+  Offset_Send   = new unsigned long [nNeighbor_Send+1];
+  Offset_Recv   = new unsigned long [nNeighbor_Recv+1];
+
+  Offset_Send[0] = 0;
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Send; iNeighbor++) {
+    Neighbor_Send[iNeighbor] = Rank_Send[iNeighbor];
+    Offset_Send[iNeighbor+1] = Offset_Send[iNeighbor] + List_Send[iNeighbor].size();
+  }
+
+  Offset_Recv[0] = 0;
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Recv; iNeighbor++) {
+    Neighbor_Recv[iNeighbor] = Rank_Recv[iNeighbor];
+    Offset_Recv[iNeighbor+1] = Offset_Recv[iNeighbor] + List_Recv[iNeighbor].size();
+  }
+
+  Point_Send    = new unsigned long [Offset_Send[nNeighbor_Send]];
+  Point_Recv    = new unsigned long [Offset_Recv[nNeighbor_Recv]];
+  Rotation_Recv = new unsigned short [Offset_Recv[nNeighbor_Recv]];
+
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Send; iNeighbor++)
+    for (iPos = 0; iPos < List_Send[iNeighbor].size(); iPos++)
+      Point_Send[Offset_Send[iNeighbor]+iPos] = List_Send[iNeighbor][iPos];
+
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Recv; iNeighbor++)
+    for (iPos = 0; iPos < List_Recv[iNeighbor].size(); iPos++) {
+      Point_Recv[Offset_Recv[iNeighbor]+iPos]    = List_Recv[iNeighbor][iPos];
+      Rotation_Recv[Offset_Recv[iNeighbor]+iPos] = List_Rotation[iNeighbor][iPos];
+    }
+
+#ifdef HAVE_MPI
+  Status = new MPI_Status [nNeighbor_Send+nNeighbor_Recv];
+#endif
+
+}
+
+CHaloExchange::~CHaloExchange(void) {
+
+  unsigned short iChannel;
+
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- Release the persistent requests (unless MPI has already been finalized) ---*/
+
+  int iRequest, finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    for (iChannel = 0; iChannel < nChannel; iChannel++)
+      for (iRequest = 0; iRequest < nNeighbor_Send+nNeighbor_Recv; iRequest++)
+        MPI_Request_free(&Request[iChannel][iRequest]);
+  }
+
+#endif
+
+  for (iChannel = 0; iChannel < nChannel; iChannel++) {
+    delete [] Buffer_Send[iChannel];
+    delete [] Buffer_Recv[iChannel];
+#ifdef HAVE_MPI
+    delete [] Request[iChannel];
+#endif
+  }
+
+  if (Buffer_Send    != NULL) delete [] Buffer_Send;
+  if (Buffer_Recv    != NULL) delete [] Buffer_Recv;
+  if (Channel_nVar   != NULL) delete [] Channel_nVar;
+  if (Channel_Active != NULL) delete [] Channel_Active;
+#ifdef HAVE_MPI
+  if (Request        != NULL) delete [] Request;
+  if (Status         != NULL) delete [] Status;
+#endif
+
+  delete [] Neighbor_Send;
+  delete [] Neighbor_Recv;
+  delete [] Offset_Send;
+  delete [] Offset_Recv;
+  delete [] Point_Send;
+  delete [] Point_Recv;
+  delete [] Rotation_Recv;
+
+}
+
+unsigned short CHaloExchange::GetChannel(unsigned short val_nVar) {
+
+  unsigned short iChannel;
+
+  for (iChannel = 0; iChannel < nChannel; iChannel++)
+    if (Channel_nVar[iChannel] == val_nVar) return iChannel;
+
+  /*--- First exchange with this number of values per point, grow the arrays
+   of channels (the buffers of the existing channels are not moved). ---*/
+
+  unsigned short *Channel_nVar_New   = new unsigned short [nChannel+1];
+  bool *Channel_Active_New           = new bool [nChannel+1];
+  su2double **Buffer_Send_New        = new su2double* [nChannel+1];
+  su2double **Buffer_Recv_New        = new su2double* [nChannel+1];
+#ifdef HAVE_MPI
+  MPI_Request **Request_New          = new MPI_Request* [nChannel+1];
+#endif
+
+  for (iChannel = 0; iChannel < nChannel; iChannel++) {
+    Channel_nVar_New[iChannel]   = Channel_nVar[iChannel];
+    Channel_Active_New[iChannel] = Channel_Active[iChannel];
+    Buffer_Send_New[iChannel]    = Buffer_Send[iChannel];
+    Buffer_Recv_New[iChannel]    = Buffer_Recv[iChannel];
+#ifdef HAVE_MPI
+    Request_New[iChannel]        = Request[iChannel];
+#endif
+  }
+
+  if (Channel_nVar   != NULL) delete [] Channel_nVar;
+  if (Channel_Active != NULL) delete [] Channel_Active;
+  if (Buffer_Send    != NULL) delete [] Buffer_Send;
+  if (Buffer_Recv    != NULL) delete [] Buffer_Recv;
+  Channel_nVar = Channel_nVar_New;   Channel_Active = Channel_Active_New;
+  Buffer_Send  = Buffer_Send_New;    Buffer_Recv    = Buffer_Recv_New;
+#ifdef HAVE_MPI
+  if (Request        != NULL) delete [] Request;
+  Request = Request_New;
+#endif
+
+  iChannel = nChannel;
+  nChannel++;
+
+  Channel_nVar[iChannel]   = val_nVar;
+  Channel_Active[iChannel] = false;
+  Buffer_Send[iChannel]    = new su2double [GetnPoint_Send()*val_nVar];
+  Buffer_Recv[iChannel]    = new su2double [GetnPoint_Recv()*val_nVar];
+
+#ifdef HAVE_MPI
+
+  /*--- Receives first, then sends. The number of values per point is used
+   as tag, so that different channels can be in flight at the same time. ---*/
+
+  int iNeighbor, count;
+
+  Request[iChannel] = new MPI_Request [nNeighbor_Recv+nNeighbor_Send];
+
+#ifdef HAVE_PERSISTENT_COMMS
+
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Recv; iNeighbor++) {
+    count = int((Offset_Recv[iNeighbor+1]-Offset_Recv[iNeighbor])*val_nVar);
+    MPI_Recv_init(&Buffer_Recv[iChannel][Offset_Recv[iNeighbor]*val_nVar], count, MPI_DOUBLE,
+                  Neighbor_Recv[iNeighbor], val_nVar, MPI_COMM_WORLD, &Request[iChannel][iNeighbor]);
+  }
+
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Send; iNeighbor++) {
+    count = int((Offset_Send[iNeighbor+1]-Offset_Send[iNeighbor])*val_nVar);
+    MPI_Send_init(&Buffer_Send[iChannel][Offset_Send[iNeighbor]*val_nVar], count, MPI_DOUBLE,
+                  Neighbor_Send[iNeighbor], val_nVar, MPI_COMM_WORLD, &Request[iChannel][nNeighbor_Recv+iNeighbor]);
+  }
+
+#endif
+
+#endif
+
+  return iChannel;
+
+}
+
+void CHaloExchange::InitiateComms(unsigned short val_nVar) {
+
+  unsigned short iChannel = GetChannel(val_nVar);
+
+#ifdef HAVE_MPI
+
+#ifdef HAVE_PERSISTENT_COMMS
+
+  MPI_Startall(nNeighbor_Recv+nNeighbor_Send, Request[iChannel]);
+
+#else
+
+  int iNeighbor, count;
+
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Recv; iNeighbor++) {
+    count = int((Offset_Recv[iNeighbor+1]-Offset_Recv[iNeighbor])*val_nVar);
+    SU2_MPI::Irecv(&Buffer_Recv[iChannel][Offset_Recv[iNeighbor]*val_nVar], count, MPI_DOUBLE,
+                   Neighbor_Recv[iNeighbor], val_nVar, MPI_COMM_WORLD, &Request[iChannel][iNeighbor]);
+  }
+
+  for (iNeighbor = 0; iNeighbor < nNeighbor_Send; iNeighbor++) {
+    count = int((Offset_Send[iNeighbor+1]-Offset_Send[iNeighbor])*val_nVar);
+    SU2_MPI::Isend(&Buffer_Send[iChannel][Offset_Send[iNeighbor]*val_nVar], count, MPI_DOUBLE,
+                   Neighbor_Send[iNeighbor], val_nVar, MPI_COMM_WORLD, &Request[iChannel][nNeighbor_Recv+iNeighbor]);
+  }
+
+#endif
+
+#else
+
+  /*--- Without MPI all the messages are sent to the same rank (periodic
+   boundaries), the packed buffers only have to be copied. ---*/
+
+  unsigned long iPos, nPos = min(GetnPoint_Send(), GetnPoint_Recv())*val_nVar;
+  for (iPos = 0; iPos < nPos; iPos++)
+    Buffer_Recv[iChannel][iPos] = Buffer_Send[iChannel][iPos];
+
+#endif
+
+  Channel_Active[iChannel] = true;
+
+}
+
+void CHaloExchange::CompleteComms(unsigned short val_nVar) {
+
+  unsigned short iChannel = GetChannel(val_nVar);
+
+  if (!Channel_Active[iChannel]) return;
+
+#ifdef HAVE_MPI
+
+#ifdef HAVE_PERSISTENT_COMMS
+  double StartTime = MPI_Wtime();
+  MPI_Waitall(nNeighbor_Recv+nNeighbor_Send, Request[iChannel], Status);
+  SU2_MPI::AddWait_Time(MPI_Wtime() - StartTime);
+#else
+  SU2_MPI::Waitall(nNeighbor_Recv+nNeighbor_Send, Request[iChannel], Status);
+#endif
+
+#endif
+
+  Channel_Active[iChannel] = false;
+
+}
+
+void CHaloExchange::InitiateComms(CSysVector & x) {
+
+  unsigned short iVar, nVar = x.GetNVar();
+  unsigned long iPos, iPoint;
+  su2double *Buffer = GetBuffer_Send(nVar);
+
+  for (iPos = 0; iPos < GetnPoint_Send(); iPos++) {
+    iPoint = Point_Send[iPos];
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iPos*nVar+iVar] = x[iPoint*nVar+iVar];
+  }
+
+  InitiateComms(nVar);
+
+}
+
+void CHaloExchange::CompleteComms(CSysVector & x) {
+
+  unsigned short iVar, nVar = x.GetNVar();
+  unsigned long iPos, iPoint;
+  su2double *Buffer = GetBuffer_Recv(nVar);
+
+  CompleteComms(nVar);
+
+  for (iPos = 0; iPos < GetnPoint_Recv(); iPos++) {
+    iPoint = Point_Recv[iPos];
+    for (iVar = 0; iVar < nVar; iVar++)
+      x[iPoint*nVar+iVar] = Buffer[iPos*nVar+iVar];
+  }
+
+}
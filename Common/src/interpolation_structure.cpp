@@ -32,6 +32,7 @@
  */
 
 #include "../include/interpolation_structure.hpp"
+#include "../include/adt_structure.hpp"
 
 CInterpolator::CInterpolator(void) {
 
@@ -291,15 +292,22 @@ CNearestNeighbor::~CNearestNeighbor() {}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
-  int iProcessor, pProcessor, nProcessor;
+  int iProcessor, pProcessor, nProcessor, rankDonor;
   int markDonor, markTarget, Target_check, Donor_check;
 
   unsigned short iDim, nDim, iMarkerInt, nMarkerInt, iDonor;    
 
   unsigned long nVertexDonor, nVertexTarget, Point_Target, jVertex, iVertexTarget;
-  unsigned long Global_Point_Donor, pGlobalPoint=0;
+  unsigned long Global_Point_Donor, pGlobalPoint=0, Position, iNeighbor;
 
-  su2double *Coord_i, Coord_j[3], dist, mindist, maxdist;
+  su2double *Coord_i, dist, dist_neighbor, maxdist;
+
+  bool incremental = config[donorZone]->GetIncremental_InterfaceSearch(), local_search;
+
+  su2_adtPointsOnlyClass *DonorADT;
+
+  vector<su2double>     Coord_Donor;
+  vector<unsigned long> Index_Donor;
 
 #ifdef HAVE_MPI
 
@@ -328,6 +336,12 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
   
   Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
 
+  if (Previous_Donor.size() < (unsigned long)nMarkerInt+1) {
+    Previous_Donor.resize(nMarkerInt+1);
+    Donor_Neighbor_Ptr.resize(nMarkerInt+1);
+    Donor_Neighbor.resize(nMarkerInt+1);
+    Previous_MaxLocalVertex.resize(nMarkerInt+1, 0);
+  }
 
   /*--- Cycle over nMarkersInt interface to determine communication pattern ---*/
 
@@ -401,6 +415,45 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
     /*-- Collect coordinates, global points, and normal vectors ---*/
     Collect_VertexInfo( false, markDonor, markTarget, nVertexDonor, nDim );
 
+    /*--- For the incremental search, the donors are searched on the donor
+     interface starting from the donors of the previous update. The vertices
+     of a rigidly sliding interface keep their position in the buffers, the
+     donor of the previous update moved with its zone and the search only
+     covers the relative motion of the interfaces since then. It requires an
+     unchanged interface, otherwise the ADT is used. ---*/
+
+    if (incremental && Donor_Neighbor_Ptr[iMarkerInt].empty())
+      Set_DonorNeighbors(markDonor, iMarkerInt, nVertexDonor);
+
+    local_search = (incremental && (Previous_MaxLocalVertex[iMarkerInt] == MaxLocalVertex_Donor) &&
+                    (Previous_Donor[iMarkerInt].size() == nVertexTarget));
+
+    Previous_MaxLocalVertex[iMarkerInt] = MaxLocalVertex_Donor;
+    Previous_Donor[iMarkerInt].resize(nVertexTarget, 0);
+
+    /*--- Build the ADT of the donor points gathered from all the processors
+     (only the points actually sent, not the padding of the buffers). The ID
+     of a point in the ADT is its position in the receive buffers. ---*/
+
+    DonorADT = NULL;
+
+    if (!local_search) {
+
+      Coord_Donor.clear();
+      Index_Donor.clear();
+
+      for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+        for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
+          Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
+          Index_Donor.push_back(Global_Point_Donor);
+          for (iDim = 0; iDim < nDim; iDim++)
+            Coord_Donor.push_back(Buffer_Receive_Coord[Global_Point_Donor*nDim+iDim]);
+        }
+      }
+
+      DonorADT = new su2_adtPointsOnlyClass(nDim, Index_Donor.size(), Coord_Donor.data(), Index_Donor.data(), false);
+    }
+
     /*--- Compute the closest point to a Near-Field boundary point ---*/
     maxdist = 0.0;
 
@@ -416,39 +469,53 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
         /*--- Coordinates of the boundary point ---*/
         Coord_i = target_geometry->node[Point_Target]->GetCoord();
 
-        mindist    = 1E6; 
-        pProcessor = 0;
+        if (local_search) {
+
+          /*--- Move from the previous donor to its closest neighbor on the
+           donor interface, until no neighbor is closer to the target ---*/
+
+          Global_Point_Donor = Previous_Donor[iMarkerInt][iVertexTarget];
+          dist = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dist += pow(Buffer_Receive_Coord[Global_Point_Donor*nDim+iDim] - Coord_i[iDim], 2.0);
+
+          do {
+            Position = Global_Point_Donor;
+            for (iNeighbor = Donor_Neighbor_Ptr[iMarkerInt][Position]; iNeighbor < Donor_Neighbor_Ptr[iMarkerInt][Position+1]; iNeighbor++) {
+              jVertex = Donor_Neighbor[iMarkerInt][iNeighbor];
+              dist_neighbor = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++)
+                dist_neighbor += pow(Buffer_Receive_Coord[jVertex*nDim+iDim] - Coord_i[iDim], 2.0);
+              if (dist_neighbor < dist) {
+                dist = dist_neighbor; Global_Point_Donor = jVertex;
+              }
+            }
+          } while (Global_Point_Donor != Position);
 
-        /*--- Loop over all the boundaries to find the pair ---*/
+          dist = sqrt(dist);
+        }
+        else {
 
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (jVertex = 0; jVertex < MaxLocalVertex_Donor; jVertex++) {
-            Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
-
-            /*--- Compute the dist ---*/
-            dist = 0.0; 
-            for (iDim = 0; iDim < nDim; iDim++) {
-              Coord_j[iDim] = Buffer_Receive_Coord[ Global_Point_Donor*nDim+iDim];
-              dist += pow(Coord_j[iDim] - Coord_i[iDim], 2.0);
-            }
+          /*--- Search the ADT for the pair ---*/
 
-            if (dist < mindist) {
-              mindist = dist; pProcessor = iProcessor; pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
-            }
+          DonorADT->DetermineNearestNode(Coord_i, dist, Global_Point_Donor, rankDonor);
+        }
 
-            if (dist == 0.0) break;
-          }
+        Previous_Donor[iMarkerInt][iVertexTarget] = Global_Point_Donor;
 
-        } 
+        pProcessor   = Global_Point_Donor/MaxLocalVertex_Donor;
+        pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
 
         /*--- Store the value of the pair ---*/
-        maxdist = max(maxdist, mindist);
+        maxdist = max(maxdist, dist);
         target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, pGlobalPoint);
         target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, pProcessor);
         target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor, 1.0);
       }
     }
 
+    delete DonorADT;
+
     delete[] Buffer_Send_Coord;
     delete[] Buffer_Send_GlobalPoint;
     
@@ -467,6 +534,91 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
   #endif
 }
 
+void CNearestNeighbor::Set_DonorNeighbors(int markDonor, unsigned short iMarkerInt, unsigned long nVertexDonor) {
+
+  int iProcessor, nProcessor = SINGLE_NODE;
+  unsigned short iNode;
+  unsigned long iVertex, iPoint, jPoint, jVertex, Position, iNeighbor, nNeighbor, nRecord, nLocalVertex = 0;
+  unsigned long MaxNeighbor_Local = 0, MaxNeighbor = 0;
+  map<unsigned long, unsigned long> Donor_Position;
+  map<unsigned long, unsigned long>::iterator it_Position;
+
+#ifdef HAVE_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+#endif
+
+  /*--- Maximum number of neighbors of the donor vertices ---*/
+
+  for (iVertex = 0; iVertex < nVertexDonor; iVertex++) {
+    iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (donor_geometry->node[iPoint]->GetDomain())
+      MaxNeighbor_Local = max(MaxNeighbor_Local, (unsigned long)donor_geometry->node[iPoint]->GetnPoint());
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&MaxNeighbor_Local, &MaxNeighbor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+#else
+  MaxNeighbor = MaxNeighbor_Local;
+#endif
+
+  /*--- Each donor vertex sends the number of its neighbors on the interface
+   followed by their global indices, in the same order as Collect_VertexInfo ---*/
+
+  nRecord = MaxNeighbor+1;
+
+  unsigned long *Buffer_Send_Neighbor    = new unsigned long [MaxLocalVertex_Donor*nRecord];
+  unsigned long *Buffer_Receive_Neighbor = new unsigned long [nProcessor*MaxLocalVertex_Donor*nRecord];
+
+  for (iVertex = 0; iVertex < MaxLocalVertex_Donor*nRecord; iVertex++)
+    Buffer_Send_Neighbor[iVertex] = 0;
+
+  for (iVertex = 0; iVertex < nVertexDonor; iVertex++) {
+    iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (donor_geometry->node[iPoint]->GetDomain()) {
+      nNeighbor = 0;
+      for (iNode = 0; iNode < donor_geometry->node[iPoint]->GetnPoint(); iNode++) {
+        jPoint = donor_geometry->node[iPoint]->GetPoint(iNode);
+        if (donor_geometry->node[jPoint]->GetVertex(markDonor) != -1) {
+          Buffer_Send_Neighbor[nLocalVertex*nRecord+1+nNeighbor] = donor_geometry->node[jPoint]->GetGlobalIndex();
+          nNeighbor++;
+        }
+      }
+      Buffer_Send_Neighbor[nLocalVertex*nRecord] = nNeighbor;
+      nLocalVertex++;
+    }
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(Buffer_Send_Neighbor, MaxLocalVertex_Donor*nRecord, MPI_UNSIGNED_LONG, Buffer_Receive_Neighbor, MaxLocalVertex_Donor*nRecord, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  for (iVertex = 0; iVertex < MaxLocalVertex_Donor*nRecord; iVertex++)
+    Buffer_Receive_Neighbor[iVertex] = Buffer_Send_Neighbor[iVertex];
+#endif
+
+  /*--- Convert the global indices of the neighbors to positions in the receive buffers ---*/
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++)
+      Donor_Position[Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]] = MaxLocalVertex_Donor*iProcessor+jVertex;
+
+  Donor_Neighbor_Ptr[iMarkerInt].assign(nProcessor*MaxLocalVertex_Donor+1, 0);
+  Donor_Neighbor[iMarkerInt].clear();
+
+  for (Position = 0; Position < nProcessor*MaxLocalVertex_Donor; Position++) {
+    nNeighbor = Buffer_Receive_Neighbor[Position*nRecord];
+    for (iNeighbor = 0; iNeighbor < nNeighbor; iNeighbor++) {
+      it_Position = Donor_Position.find(Buffer_Receive_Neighbor[Position*nRecord+1+iNeighbor]);
+      if (it_Position != Donor_Position.end())
+        Donor_Neighbor[iMarkerInt].push_back(it_Position->second);
+    }
+    Donor_Neighbor_Ptr[iMarkerInt][Position+1] = Donor_Neighbor[iMarkerInt].size();
+  }
+
+  delete [] Buffer_Send_Neighbor;
+  delete [] Buffer_Receive_Neighbor;
+
+}
+
 
 
 CIsoparametric::CIsoparametric(CGeometry ***geometry_container, CConfig **config, unsigned int iZone, unsigned int jZone)  :  CInterpolator(geometry_container, config, iZone, jZone) {
@@ -508,7 +660,15 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
 
   unsigned long nLocalFace_Donor = 0, nLocalFaceNodes_Donor=0;
 
-  unsigned long faceindex;
+  unsigned long faceindex, iFaceDonor, nearestDonor, iCandidate;
+  int rankDonor;
+
+  map<unsigned long, unsigned long> Donor_Position;
+  map<unsigned long, unsigned long>::iterator it_Position;
+  vector<vector<unsigned long> > Donor_Faces;
+  vector<unsigned long> All_Faces, *Candidate_Faces;
+  vector<su2double>     Coord_Donor;
+  vector<unsigned long> Index_Donor;
 
   su2double dist = 0.0, mindist=1E6, *Coord, *Coord_i;
   su2double myCoeff[10]; // Maximum # of donor points
@@ -650,6 +810,14 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
 
     Buffer_Send_FaceIndex[0] = rank * MaxFaceNodes_Donor;
 
+    /*--- Position of the gathered donor points in the receive buffers, used to
+     match the nodes of the faces without searching all the donor points. ---*/
+
+    Donor_Position.clear();
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++)
+        Donor_Position[Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]] = MaxLocalVertex_Donor*iProcessor+jVertex;
+
     if (nDim==2) nNodes=2;
 
     for (iVertexDonor = 0; iVertexDonor < nVertexDonor; iVertexDonor++) {
@@ -680,13 +848,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
               dPoint = donor_geometry->elem[temp_donor]->GetNode(inode);
               // Match node on the face to the correct global index
               jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                  if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                    Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                    Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                  }
-                }
+              it_Position = Donor_Position.find(jGlobalPoint);
+              if (it_Position != Donor_Position.end()) {
+                Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=it_Position->second;
+                Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=it_Position->second/MaxLocalVertex_Donor;
               }
               nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
             }
@@ -710,13 +875,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
             dPoint = donor_geometry->edge[inode]->GetNode(iDonor);
             // Match node on the face to the correct global index
             jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-            for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-              for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                  Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                  Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                }
-              }
+            it_Position = Donor_Position.find(jGlobalPoint);
+            if (it_Position != Donor_Position.end()) {
+              Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=it_Position->second;
+              Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=it_Position->second/MaxLocalVertex_Donor;
             }
             nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
           }
@@ -744,6 +906,32 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
       Buffer_Receive_FaceProc[iVertex] = Buffer_Send_FaceProc[iVertex];
 #endif
 
+    /*--- Build the ADT of the donor points, the ID of a point is its position
+     in the receive buffers, and the list of the faces of each donor point.
+     A face is identified by the position of its index in Buffer_Receive_FaceIndex. ---*/
+
+    Coord_Donor.clear();
+    Index_Donor.clear();
+    All_Faces.clear();
+    Donor_Faces.assign(nProcessor*MaxLocalVertex_Donor, vector<unsigned long>());
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
+        Index_Donor.push_back(MaxLocalVertex_Donor*iProcessor+jVertex);
+        for (iDim = 0; iDim < nDim; iDim++)
+          Coord_Donor.push_back(Buffer_Receive_Coord[(MaxLocalVertex_Donor*iProcessor+jVertex)*nDim+iDim]);
+      }
+      for (iFaceDonor = 0; iFaceDonor < Buffer_Receive_nFace_Donor[iProcessor]; iFaceDonor++) {
+        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFaceDonor];
+        nNodes = (unsigned int)(Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFaceDonor+1] - faceindex);
+        for (iDonor = 0; iDonor < nNodes; iDonor++)
+          Donor_Faces[Buffer_Receive_FaceNodes[faceindex+iDonor]].push_back(iProcessor*MaxFace_Donor+iFaceDonor);
+        All_Faces.push_back(iProcessor*MaxFace_Donor+iFaceDonor);
+      }
+    }
+
+    su2_adtPointsOnlyClass DonorADT(nDim, Index_Donor.size(), Coord_Donor.data(), Index_Donor.data(), false);
+
     /*--- Loop over the vertices on the target Marker ---*/
     for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
       mindist=1E6;
@@ -755,81 +943,84 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
       if (target_geometry->node[Point_Target]->GetDomain()) {
 
     Coord_i = target_geometry->node[Point_Target]->GetCoord();
-    /*---Loop over the faces previously communicated/stored ---*/
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
 
-      nFaces = (unsigned int)Buffer_Receive_nFace_Donor[iProcessor];
+    /*--- Find the nearest donor point, only the faces which contain it are
+     candidates (all the faces if, unexpectedly, it does not belong to any). ---*/
+    DonorADT.DetermineNearestNode(Coord_i, dist, nearestDonor, rankDonor);
 
-      for (iFace = 0; iFace< nFaces; iFace++) {
-        /*--- ---*/
+    Candidate_Faces = &Donor_Faces[nearestDonor];
+    if (Candidate_Faces->empty()) Candidate_Faces = &All_Faces;
 
-        nNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1] -
-                (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace];
+    /*---Loop over the candidate faces previously communicated/stored ---*/
+    for (iCandidate = 0; iCandidate < Candidate_Faces->size(); iCandidate++) {
 
-        su2double *X = new su2double[nNodes*nDim];
-        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-        for (iDonor=0; iDonor<nNodes; iDonor++) {
-          jVertex = Buffer_Receive_FaceNodes[iDonor+faceindex]; // index which points to the stored coordinates, global points
-          for (iDim=0; iDim<nDim; iDim++) {
-            X[iDim*nNodes+iDonor]=
-                Buffer_Receive_Coord[jVertex*nDim+iDim];
-          }
-        }
-        jVertex = Buffer_Receive_FaceNodes[faceindex];
+      iFaceDonor = (*Candidate_Faces)[iCandidate];
+      nNodes = (unsigned int)Buffer_Receive_FaceIndex[iFaceDonor+1] -
+              (unsigned int)Buffer_Receive_FaceIndex[iFaceDonor];
 
+      su2double *X = new su2double[nNodes*nDim];
+      faceindex = Buffer_Receive_FaceIndex[iFaceDonor]; // first index of this face
+      for (iDonor=0; iDonor<nNodes; iDonor++) {
+        jVertex = Buffer_Receive_FaceNodes[iDonor+faceindex]; // index which points to the stored coordinates, global points
         for (iDim=0; iDim<nDim; iDim++) {
-          Normal[iDim] = Buffer_Receive_Normal[jVertex*nDim+iDim];
+          X[iDim*nNodes+iDonor]=
+              Buffer_Receive_Coord[jVertex*nDim+iDim];
         }
+      }
+      jVertex = Buffer_Receive_FaceNodes[faceindex];
 
-        /* Project point used for case where surfaces are not exactly coincident, where
-         * the point is assumed connected by a rigid rod normal to the surface.
-         */
-        tmp = 0;
-        tmp2=0;
-        for (iDim=0; iDim<nDim; iDim++) {
-          tmp+=Normal[iDim]*Normal[iDim];
-          tmp2+=Normal[iDim]*(Coord_i[iDim]-X[iDim*nNodes]);
-        }
-        tmp = 1/tmp;
-        tmp2 = tmp2*sqrt(tmp);
-        for (iDim=0; iDim<nDim; iDim++) {
-          // projection of \vec{q} onto plane defined by \vec{n} and \vec{p}:
-          // \vec{q} - \vec{n} ( (\vec{q}-\vec{p} ) \cdot \vec{n})
-          // tmp2 = ( (\vec{q}-\vec{p} ) \cdot \vec{N})
-          // \vec{n} = \vec{N}/(|N|), tmp = 1/|N|^2
-          projected_point[iDim]=Coord_i[iDim] + Normal[iDim]*tmp2*tmp;
-        }
+      for (iDim=0; iDim<nDim; iDim++) {
+        Normal[iDim] = Buffer_Receive_Normal[jVertex*nDim+iDim];
+      }
 
-        Isoparameters(nDim, nNodes, X, projected_point,myCoeff);
+      /* Project point used for case where surfaces are not exactly coincident, where
+       * the point is assumed connected by a rigid rod normal to the surface.
+       */
+      tmp = 0;
+      tmp2=0;
+      for (iDim=0; iDim<nDim; iDim++) {
+        tmp+=Normal[iDim]*Normal[iDim];
+        tmp2+=Normal[iDim]*(Coord_i[iDim]-X[iDim*nNodes]);
+      }
+      tmp = 1/tmp;
+      tmp2 = tmp2*sqrt(tmp);
+      for (iDim=0; iDim<nDim; iDim++) {
+        // projection of \vec{q} onto plane defined by \vec{n} and \vec{p}:
+        // \vec{q} - \vec{n} ( (\vec{q}-\vec{p} ) \cdot \vec{n})
+        // tmp2 = ( (\vec{q}-\vec{p} ) \cdot \vec{N})
+        // \vec{n} = \vec{N}/(|N|), tmp = 1/|N|^2
+        projected_point[iDim]=Coord_i[iDim] + Normal[iDim]*tmp2*tmp;
+      }
 
-        /*--- Find distance to the interpolated point ---*/
-        dist = 0.0;
-        for (iDim=0; iDim<nDim; iDim++) {
-          Coord[iDim] = Coord_i[iDim];
-          for(iDonor=0; iDonor< nNodes; iDonor++) {
-            Coord[iDim]-=myCoeff[iDonor]*X[iDim*nNodes+iDonor];
-          }
-          dist+=pow(Coord[iDim],2.0);
+      Isoparameters(nDim, nNodes, X, projected_point,myCoeff);
+
+      /*--- Find distance to the interpolated point ---*/
+      dist = 0.0;
+      for (iDim=0; iDim<nDim; iDim++) {
+        Coord[iDim] = Coord_i[iDim];
+        for(iDonor=0; iDonor< nNodes; iDonor++) {
+          Coord[iDim]-=myCoeff[iDonor]*X[iDim*nNodes+iDonor];
         }
+        dist+=pow(Coord[iDim],2.0);
+      }
 
-        /*--- If the dist is shorter than last closest (and nonzero nodes are on the boundary), update ---*/
-        if (dist<mindist ) {
-          /*--- update last dist ---*/
-          mindist = dist;
-          /*--- Store info ---*/
-          donor_elem = temp_donor;
-          target_geometry->vertex[markTarget][iVertex]->SetDonorElem(donor_elem); // in 2D is nearest neighbor
-          target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
-          for (iDonor=0; iDonor<nNodes; iDonor++) {
-            storeCoeff[iDonor] = myCoeff[iDonor];
-            jVertex = Buffer_Receive_FaceNodes[faceindex+iDonor];
-            storeGlobal[iDonor] =Buffer_Receive_GlobalPoint[jVertex];
-            storeProc[iDonor] = (int)Buffer_Receive_FaceProc[faceindex+iDonor];
-          }
+      /*--- If the dist is shorter than last closest (and nonzero nodes are on the boundary), update ---*/
+      if (dist<mindist ) {
+        /*--- update last dist ---*/
+        mindist = dist;
+        /*--- Store info ---*/
+        donor_elem = temp_donor;
+        target_geometry->vertex[markTarget][iVertex]->SetDonorElem(donor_elem); // in 2D is nearest neighbor
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
+        for (iDonor=0; iDonor<nNodes; iDonor++) {
+          storeCoeff[iDonor] = myCoeff[iDonor];
+          jVertex = Buffer_Receive_FaceNodes[faceindex+iDonor];
+          storeGlobal[iDonor] =Buffer_Receive_GlobalPoint[jVertex];
+          storeProc[iDonor] = (int)Buffer_Receive_FaceProc[faceindex+iDonor];
         }
-      
-        delete [] X;
       }
+    
+      delete [] X;
     }
     /*--- Set the appropriate amount of memory and fill ---*/
     nNodes =target_geometry->vertex[markTarget][iVertex]->GetnDonorPoints();
@@ -598,6 +598,395 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
 	return (unsigned long) i;
 }
 
+void CSysSolve::StartReduction(unsigned short nVal, su2double *loc_val, su2double *val) {
+  
+#ifdef HAVE_NONBLOCKING_REDUCTION
+  MPI_Iallreduce(loc_val, val, nVal, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &Reduction_Request);
+#endif
+  
+}
+
+void CSysSolve::CompleteReduction(unsigned short nVal, su2double *loc_val, su2double *val) {
+  
+#if defined HAVE_NONBLOCKING_REDUCTION
+  double StartTime = MPI_Wtime();
+  MPI_Wait(&Reduction_Request, MPI_STATUS_IGNORE);
+  SU2_MPI::AddWait_Time(MPI_Wtime() - StartTime);
+#elif defined HAVE_MPI
+  SU2_MPI::Allreduce(loc_val, val, nVal, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  for (unsigned short iVal = 0; iVal < nVal; iVal++)
+    val[iVal] = loc_val[iVal];
+#endif
+  
+}
+
+unsigned long CSysSolve::CG_Pipelined_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = 0;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Check the subspace size ---*/
+  if (m < 1) {
+    if (rank == MASTER_NODE) cerr << "CSysSolve::PipelinedConjugateGradient: illegal value for subspace size, m = " << m << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Besides the residual r, the recurrences keep u = M r and w = A u, so that the
+   only products that depend on the new direction are computed with the next
+   preconditioner and matrix-vector product (m = M w, n = A m) ---*/
+  
+  CSysVector r(b);
+  CSysVector u(b);
+  CSysVector w(b);
+  CSysVector m_w(b);
+  CSysVector n(b);
+  CSysVector p(b);
+  CSysVector s(b);
+  CSysVector q(b);
+  CSysVector z(b);
+  
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+  mat_vec(x, w);
+  
+  r -= w; // recall, r holds b initially
+  su2double norm_r = r.norm();
+  su2double norm0 = b.norm();
+  if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::PipelinedConjugateGradient(): system solved by initial guess." << endl;
+    (*residual) = norm_r;
+    return 0;
+  }
+  
+  precond(r, u);
+  mat_vec(u, w);
+  
+  p = su2double(0.0); s = su2double(0.0);
+  q = su2double(0.0); z = su2double(0.0);
+  
+  su2double alpha = 0.0, alpha_old = 0.0, beta = 0.0, gamma = 0.0, gamma_old = 0.0, delta = 0.0;
+  su2double loc_prod[3], prod[3];
+  
+  /*--- Set the norm to the initial initial residual value ---*/
+  norm0 = norm_r;
+  
+  /*--- Output header information including initial residual ---*/
+  int i = 0;
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("Pipelined CG", tol, norm_r);
+    WriteHistory(i, norm_r, norm0);
+  }
+  
+  /*---  Loop over all search directions ---*/
+  for (i = 0; i < (int)m; i++) {
+    
+    /*--- Local products (r,u), (w,u) and (r,r), summed in a single reduction ---*/
+    loc_prod[0] = dotProdLocal(r, u);
+    loc_prod[1] = dotProdLocal(w, u);
+    loc_prod[2] = dotProdLocal(r, r);
+    StartReduction(3, loc_prod, prod);
+    
+    /*--- Preconditioner and matrix-vector product while the reduction is in flight ---*/
+    precond(w, m_w);
+    mat_vec(m_w, n);
+    
+    CompleteReduction(3, loc_prod, prod);
+    gamma = prod[0]; delta = prod[1]; norm_r = sqrt(prod[2]);
+    
+    /*--- Check if solution has converged (the residual of the previous
+     update), else output the relative residual if necessary ---*/
+    if (i > 0) {
+      if (norm_r < tol*norm0) break;
+      if (((monitoring) && (rank == MASTER_NODE)) && (i % 5 == 0)) WriteHistory(i, norm_r, norm0);
+    }
+    
+    /*--- Step-length alpha and Gram-Schmidt coefficient beta ---*/
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta*gamma/alpha_old);
+    }
+    else {
+      beta = 0.0;
+      alpha = gamma / delta;
+    }
+    
+    /*--- Update the directions, z = A q, q = M s, s = A p ---*/
+    z.Equals_AX_Plus_BY(1.0, n, beta, z);
+    q.Equals_AX_Plus_BY(1.0, m_w, beta, q);
+    s.Equals_AX_Plus_BY(1.0, w, beta, s);
+    p.Equals_AX_Plus_BY(1.0, u, beta, p);
+    
+    /*--- Update solution and residual (and its preconditioned products) ---*/
+    x.Plus_AX(alpha, p);
+    r.Plus_AX(-alpha, s);
+    u.Plus_AX(-alpha, q);
+    w.Plus_AX(-alpha, z);
+    
+    gamma_old = gamma; alpha_old = alpha;
+  }
+  
+  /*--- The norm of the last residual was not reduced inside the loop ---*/
+  if (i == (int)m) norm_r = r.norm();
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# Pipelined Conjugate Gradient final (true) residual:" << endl;
+    cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
+  }
+  
+  (*residual) = norm_r;
+  return (unsigned long) i;
+  
+}
+
+unsigned long CSysSolve::FGMRES_Pipelined_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                    CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = 0;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*---  Check the subspace size ---*/
+  
+  if ((m < 1) || (m > 1000)) {
+    if (rank == MASTER_NODE) cerr << "CSysSolve::PipelinedFGMRES: illegal value for subspace size, m = " << m << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Parameter for reorthonormalization (same criterion as ModGramSchmidt,
+   cosine of the angle between the new vector and the subspace > 0.98) ---*/
+  
+  static const su2double reorth = 0.98;
+  
+  /*--- The rounding errors of the recurrences for z and u grow with the size
+   of the subspace, the method is restarted from the true residual after
+   nRestart iterations ---*/
+  
+  static const unsigned long nRestart = 50;
+  unsigned long nKrylov = min(m, nRestart), nIter, Tot_Iter = 0;
+  
+  /*---  Define various arrays, w is the orthonormal basis, z = M w and u = A z.
+   Note: elements in w, z and u are initialized to x to avoid creating
+   a temporary CSysVector object for the copy constructor ---*/
+  
+  vector<CSysVector> w(nKrylov+1, x);
+  vector<CSysVector> z(nKrylov+1, x);
+  vector<CSysVector> u(nKrylov+1, x);
+  vector<su2double> g(nKrylov+1, 0.0);
+  vector<su2double> sn(nKrylov+1, 0.0);
+  vector<su2double> cs(nKrylov+1, 0.0);
+  vector<su2double> y(nKrylov, 0.0);
+  vector<su2double> loc_prod(nKrylov+2, 0.0);
+  vector<su2double> prod(nKrylov+2, 0.0);
+  vector<vector<su2double> > H(nKrylov+1, vector<su2double>(nKrylov, 0.0));
+  
+  /*---  Calculate the norm of the rhs vector ---*/
+  
+  su2double norm0 = b.norm(), beta = 0.0, nrm, nrm_new;
+  int i = 0, k;
+  bool replace;
+  
+  /*---  Loop over the restarts ---*/
+  
+  while (true) {
+    
+    /*---  Calculate the (true) residual, actually the negative residual,
+     and compute its norm ---*/
+    
+    mat_vec(x, w[0]);
+    w[0] -= b;
+    beta = w[0].norm();
+    
+    if (Tot_Iter == 0) {
+      
+      if ( (beta < tol*norm0) || (beta < eps) ) {
+        
+        /*---  System is already solved ---*/
+        
+        if (rank == MASTER_NODE) cout << "CSysSolve::PipelinedFGMRES(): system solved by initial guess." << endl;
+        (*residual) = beta;
+        return 0;
+      }
+      
+      /*--- Set the norm to the initial residual value and output header
+       information including initial residual ---*/
+      
+      norm0 = beta;
+      if ((monitoring) && (rank == MASTER_NODE)) {
+        WriteHeader("Pipelined FGMRES", tol, beta);
+        WriteHistory(0, beta, norm0);
+      }
+      
+    }
+    else if ((beta < tol*norm0) || (Tot_Iter >= m)) break;
+    
+    nIter = min(nKrylov, m - Tot_Iter);
+    
+    /*---  Normalize residual to get w_{0} (the negative sign is because w[0]
+     holds the negative residual, as mentioned above) ---*/
+    
+    w[0] /= -beta;
+    
+    /*---  First direction of the preconditioned and multiplied bases ---*/
+    
+    precond(w[0], z[0]);
+    mat_vec(z[0], u[0]);
+    
+    /*---  Initialize the RHS of the reduced system ---*/
+    
+    g.assign(nKrylov+1, 0.0);
+    g[0] = beta;
+    
+    /*---  Loop over all search directions ---*/
+    
+    for (i = 0; i < (int)nIter; i++) {
+      
+      /*---  Check if solution has converged ---*/
+      
+      if (beta < tol*norm0) break;
+      
+      /*---  Classical Gram-Schmidt products of u[i] = A M w[i] with the basis
+       and norm of u[i], summed in a single reduction ---*/
+      
+      for (k = 0; k < i+1; k++)
+        loc_prod[k] = dotProdLocal(u[i], w[k]);
+      loc_prod[i+1] = dotProdLocal(u[i], u[i]);
+      StartReduction(i+2, &loc_prod[0], &prod[0]);
+      
+      /*---  Preconditioner and matrix-vector product of u[i] while the reduction
+       is in flight, they are the next directions of z and u before the
+       orthogonalization (not needed in the last iteration) ---*/
+      
+      if (i+1 < (int)nIter) {
+        precond(u[i], z[i+1]);
+        mat_vec(z[i+1], u[i+1]);
+      }
+      
+      CompleteReduction(i+2, &loc_prod[0], &prod[0]);
+      
+      /*--- The norm of u[i] < 0.0 or u[i] = NaN (the values are global, so all
+       the processors take the same decision) ---*/
+      
+      nrm = prod[i+1];
+      if ((nrm <= 0.0) || (nrm != nrm)) {
+        if (rank == MASTER_NODE)
+          cout << "\n !!! Error: SU2 has diverged. Now exiting... !!! \n" << endl;
+#ifndef HAVE_MPI
+        exit(EXIT_DIVERGENCE);
+#else
+        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Abort(MPI_COMM_WORLD,1);
+        MPI_Finalize();
+#endif
+      }
+      
+      /*--- Orthogonalize, the norm of the new vector follows from the norm
+       of u[i] and the projections ---*/
+      
+      w[i+1] = u[i];
+      nrm_new = nrm;
+      for (k = 0; k < i+1; k++) {
+        H[k][i] = prod[k];
+        nrm_new -= H[k][i]*H[k][i];
+        w[i+1].Plus_AX(-H[k][i], w[k]);
+      }
+      
+      /*--- Most of u[i] was in the subspace, the norm is not accurate and a
+       second (blocking) pass is done, followed by the explicit norm ---*/
+      
+      replace = (nrm_new < (1.0 - reorth*reorth)*nrm);
+      if (replace) {
+        for (k = 0; k < i+1; k++)
+          loc_prod[k] = dotProdLocal(w[i+1], w[k]);
+        StartReduction(i+1, &loc_prod[0], &prod[0]);
+        CompleteReduction(i+1, &loc_prod[0], &prod[0]);
+        for (k = 0; k < i+1; k++) {
+          H[k][i] += prod[k];
+          w[i+1].Plus_AX(-prod[k], w[k]);
+        }
+        nrm_new = dotProd(w[i+1], w[i+1]);
+      }
+      
+      if (nrm_new > 0.0) H[i+1][i] = sqrt(nrm_new);
+      else H[i+1][i] = 0.0;
+      
+      /*--- Normalize, and apply the same combination to the next directions of
+       z and u (the preconditioner and the product are linear). After a
+       cancellation the directions are computed again from w[i+1]. ---*/
+      
+      if (H[i+1][i] > 0.0) {
+        w[i+1] /= H[i+1][i];
+        if ((i+1 < (int)nIter) && replace) {
+          precond(w[i+1], z[i+1]);
+          mat_vec(z[i+1], u[i+1]);
+        }
+        else if (i+1 < (int)nIter) {
+          for (k = 0; k < i+1; k++) {
+            z[i+1].Plus_AX(-H[k][i], z[k]);
+            u[i+1].Plus_AX(-H[k][i], u[k]);
+          }
+          z[i+1] /= H[i+1][i];
+          u[i+1] /= H[i+1][i];
+        }
+      }
+      
+      /*---  Apply old Givens rotations to new column of the Hessenberg matrix
+       then generate the new Givens rotation matrix and apply it to
+       the last two elements of H[:][i] and g ---*/
+      
+      for (k = 0; k < i; k++)
+        ApplyGivens(sn[k], cs[k], H[k][i], H[k+1][i]);
+      GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+      ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+      
+      /*---  Set L2 norm of residual and check if solution has converged ---*/
+      
+      beta = fabs(g[i+1]);
+      
+      /*---  Output the relative residual if necessary ---*/
+      
+      if (((monitoring) && (rank == MASTER_NODE)) && ((Tot_Iter+i+1) % 50 == 0)) WriteHistory(Tot_Iter+i+1, beta, norm0);
+      
+    }
+    
+    /*---  Solve the least-squares system and update solution ---*/
+    
+    SolveReduced(i, H, g, y);
+    for (k = 0; k < i; k++) {
+      x.Plus_AX(y[k], z[k]);
+    }
+    
+    Tot_Iter += i;
+    
+  }
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# Pipelined FGMRES final (true) residual:" << endl;
+    cout << "# Iteration = " << Tot_Iter << ": |res|/|res0| = " << beta/norm0 << ".\n" << endl;
+  }
+  
+  (*residual) = beta;
+  return Tot_Iter;
+  
+}
+
 unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
   
   su2double SolverTol = config->GetLinear_Solver_Error(), Residual;
@@ -625,56 +1014,12 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   
   if (config->GetKind_Linear_Solver() == BCGSTAB ||
       config->GetKind_Linear_Solver() == FGMRES ||
-      config->GetKind_Linear_Solver() == RESTARTED_FGMRES) {
+      config->GetKind_Linear_Solver() == RESTARTED_FGMRES ||
+      config->GetKind_Linear_Solver() == PIPELINED_FGMRES) {
     
     mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-    CPreconditioner* precond = NULL;
-    
-    switch (config->GetKind_Linear_Solver_Prec()) {
-      case JACOBI:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
-      case ILU:
-        Jacobian.BuildILUPreconditioner();
-        precond = new CILUPreconditioner(Jacobian, geometry, config);
-        break;
-      case LU_SGS:
-        precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
-        break;
-      case LINELET:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CLineletPreconditioner(Jacobian, geometry, config);
-        break;
-      default:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
-    }
-    
-    switch (config->GetKind_Linear_Solver()) {
-      case BCGSTAB:
-        IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-        break;
-      case FGMRES:
-        IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-        break;
-      case RESTARTED_FGMRES:
-        IterLinSol = 0;
-        while (IterLinSol < config->GetLinear_Solver_Iter()) {
-          if (IterLinSol + config->GetLinear_Solver_Restart_Frequency() > config->GetLinear_Solver_Iter())
-            MaxIter = config->GetLinear_Solver_Iter() - IterLinSol;
-          IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-          if (LinSysRes.norm() < SolverTol) break;
-          SolverTol = SolverTol*(1.0/LinSysRes.norm());
-        }
-        break;
-    }
-    
-    /*--- Dealocate memory of the Krylov subspace method ---*/
-    
+    IterLinSol = Solve(Jacobian, *mat_vec, LinSysRes, LinSysSol, geometry, config);
     delete mat_vec;
-    delete precond;
     
   }
   
@@ -723,6 +1068,73 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   
 }
 
+unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes, CSysVector & LinSysSol,
+                               CGeometry *geometry, CConfig *config) {
+  
+  su2double SolverTol = config->GetLinear_Solver_Error(), Residual;
+  unsigned long MaxIter = config->GetLinear_Solver_Iter();
+  unsigned long IterLinSol = 0;
+  
+  /*--- Solve the linear system using a Krylov subspace method ---*/
+  
+  CPreconditioner* precond = NULL;
+  
+  switch (config->GetKind_Linear_Solver_Prec()) {
+    case JACOBI:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+      break;
+    case ILU:
+      Jacobian.BuildILUPreconditioner();
+      precond = new CILUPreconditioner(Jacobian, geometry, config);
+      break;
+    case LU_SGS:
+      precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
+      break;
+    case LINELET:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CLineletPreconditioner(Jacobian, geometry, config);
+      break;
+    case AMG:
+      Jacobian.BuildAMGPreconditioner(config);
+      precond = new CAMGPreconditioner(Jacobian, geometry, config);
+      break;
+    default:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+      break;
+  }
+  
+  switch (config->GetKind_Linear_Solver()) {
+    case BCGSTAB:
+      IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case FGMRES:
+      IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case RESTARTED_FGMRES:
+      IterLinSol = 0;
+      while (IterLinSol < config->GetLinear_Solver_Iter()) {
+        if (IterLinSol + config->GetLinear_Solver_Restart_Frequency() > config->GetLinear_Solver_Iter())
+          MaxIter = config->GetLinear_Solver_Iter() - IterLinSol;
+        IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        if (LinSysRes.norm() < SolverTol) break;
+        SolverTol = SolverTol*(1.0/LinSysRes.norm());
+      }
+      break;
+    case PIPELINED_FGMRES:
+      IterLinSol = FGMRES_Pipelined_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+  }
+  
+  /*--- Dealocate memory of the preconditioner ---*/
+  
+  delete precond;
+  
+  return IterLinSol;
+  
+}
+
 void CSysSolve::SetExternalSolve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
 
 #ifdef CODI_REVERSE_TYPE
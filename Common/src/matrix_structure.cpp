@@ -33,6 +33,42 @@
 
 #include "../include/matrix_structure.hpp"
 
+vector<CSysMatrixPattern*> CSysMatrix::Pattern_List;
+
+CSysMatrixPattern::CSysMatrixPattern(CGeometry *val_geometry, bool val_EdgeConnect, unsigned long val_nPoint, unsigned long val_nPointDomain,
+                                     unsigned long *val_row_ptr, unsigned long *val_col_ind, unsigned long val_nnz) {
+  
+  geometry        = val_geometry;
+  EdgeConnect     = val_EdgeConnect;
+  nPoint          = val_nPoint;
+  nPointDomain    = val_nPointDomain;
+  nnz             = val_nnz;
+  row_ptr         = val_row_ptr;
+  col_ind         = val_col_ind;
+  
+  ILU_Levels      = false;
+  nLevel_Lower    = 0;
+  nLevel_Upper    = 0;
+  Level_Lower_Ptr = NULL;
+  Level_Lower_Row = NULL;
+  Level_Upper_Ptr = NULL;
+  Level_Upper_Row = NULL;
+  
+  nRef            = 0;
+  
+}
+
+CSysMatrixPattern::~CSysMatrixPattern(void) {
+  
+  if (row_ptr != NULL)          delete [] row_ptr;
+  if (col_ind != NULL)          delete [] col_ind;
+  if (Level_Lower_Ptr != NULL)  delete [] Level_Lower_Ptr;
+  if (Level_Lower_Row != NULL)  delete [] Level_Lower_Row;
+  if (Level_Upper_Ptr != NULL)  delete [] Level_Upper_Ptr;
+  if (Level_Upper_Row != NULL)  delete [] Level_Upper_Row;
+  
+}
+
 CSysMatrix::CSysMatrix(void) {
   
   /*--- Array initialization ---*/
@@ -47,9 +83,34 @@ CSysMatrix::CSysMatrix(void) {
   aux_vector        = NULL;
   sum_vector        = NULL;
   invM              = NULL;
+  ILU_matrix_float  = NULL;
+  invM_float        = NULL;
+  block_load        = NULL;
+  prec_float        = false;
+  ILU_work          = NULL;
+  nWork_ILU         = 0;
+  
+  /*--- Levels of the ILU preconditioner ---*/
+  
+  pattern           = NULL;
+  nLevel_Lower      = 0;
+  nLevel_Upper      = 0;
+  Level_Lower_Ptr   = NULL;
+  Level_Lower_Row   = NULL;
+  Level_Upper_Ptr   = NULL;
+  Level_Upper_Row   = NULL;
   block_weight      = NULL;
   block_inverse     = NULL;
 
+  /*--- Algebraic multigrid preconditioner ---*/
+  
+  AMG_Built       = false;
+  AMG_Smoother    = ILU;
+  AMG_Sweeps      = 1;
+  AMG_Coarse      = NULL;
+  AMG_Aggregate   = NULL;
+  AMG_Index       = NULL;
+
   /*--- Linelet preconditioner ---*/
   
   LineletBool     = NULL;
@@ -64,6 +125,15 @@ CSysMatrix::CSysMatrix(void) {
   LyVector        = NULL;
   FzVector        = NULL;
   max_nElem       = 0;
+
+  /*--- Block kernels (generic until the size of the blocks is known) ---*/
+
+  BlockVector_Kernel    = &BlockVector<0>;
+  BlockVectorAdd_Kernel = &BlockVectorAdd<0>;
+  BlockVectorSub_Kernel = &BlockVectorSub<0>;
+  BlockBlock_Kernel     = &BlockBlock<0>;
+  BlockSolve_Kernel     = &BlockSolve<0>;
+  BlockInverse_Kernel   = &BlockInverse<0>;
   
 }
 
@@ -73,10 +143,22 @@ CSysMatrix::~CSysMatrix(void) {
   
   /*--- Memory deallocation ---*/
   
+  /*--- The shared pattern is deleted with the last matrix that uses it ---*/
+  
+  if (pattern != NULL) {
+    ReleasePattern(pattern);
+  }
+  else {
+    if (row_ptr != NULL)          delete [] row_ptr;
+    if (col_ind != NULL)          delete [] col_ind;
+    if (Level_Lower_Ptr != NULL)  delete [] Level_Lower_Ptr;
+    if (Level_Lower_Row != NULL)  delete [] Level_Lower_Row;
+    if (Level_Upper_Ptr != NULL)  delete [] Level_Upper_Ptr;
+    if (Level_Upper_Row != NULL)  delete [] Level_Upper_Row;
+  }
+  
   if (matrix != NULL)             delete [] matrix;
   if (ILU_matrix != NULL)         delete [] ILU_matrix;
-  if (row_ptr != NULL)            delete [] row_ptr;
-  if (col_ind != NULL)            delete [] col_ind;
   if (block != NULL)              delete [] block;
   if (block_weight != NULL)       delete [] block_weight;
   if (block_inverse != NULL)      delete [] block_inverse;
@@ -86,6 +168,13 @@ CSysMatrix::~CSysMatrix(void) {
   if (aux_vector != NULL)         delete [] aux_vector;
   if (sum_vector != NULL)         delete [] sum_vector;
   if (invM != NULL)               delete [] invM;
+  if (ILU_matrix_float != NULL)   delete [] ILU_matrix_float;
+  if (invM_float != NULL)         delete [] invM_float;
+  if (block_load != NULL)         delete [] block_load;
+  if (ILU_work != NULL)           delete [] ILU_work;
+  if (AMG_Coarse != NULL)         delete AMG_Coarse;
+  if (AMG_Aggregate != NULL)      delete [] AMG_Aggregate;
+  if (AMG_Index != NULL)          delete [] AMG_Index;
   if (LineletBool != NULL)        delete [] LineletBool;
   if (LineletPoint != NULL)       delete [] LineletPoint;
   
@@ -119,8 +208,30 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   vector<unsigned long>::iterator it;
   vector<unsigned long> vneighs;
   
+  /*--- The sparse pattern only depends on the grid and on the connectivity, it
+   is built once and shared by all the matrices of the grid (e.g. flow, turbulence
+   and adjoint), which only store their own values. ---*/
+  
+  pattern = GetPattern(geometry, EdgeConnect, nPoint, nPointDomain);
+  
+  if (pattern != NULL) {
+    
+    pattern->nRef++;
+    
+    /*--- Set the indices in the in the sparce matrix structure, and memory allocation ---*/
+    
+    SetIndexes(nPoint, nPointDomain, nVar, nEqn, pattern->row_ptr, pattern->col_ind, pattern->nnz, config);
+    
+    /*--- Initialization matrix to zero ---*/
+    
+    SetValZero();
+    
+    return;
+    
+  }
+  
   /*--- Don't delete *row_ptr, *col_ind because they are
-   asigned to the Jacobian structure. ---*/
+   asigned to the shared pattern. ---*/
   
   /*--- Compute the number of neighbors ---*/
   
@@ -188,6 +299,12 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
     
   }
   
+  /*--- Register the pattern so that the other matrices of the grid use it ---*/
+  
+  pattern = new CSysMatrixPattern(geometry, EdgeConnect, nPoint, nPointDomain, row_ptr, col_ind, nnz);
+  pattern->nRef++;
+  Pattern_List.push_back(pattern);
+  
   /*--- Set the indices in the in the sparce matrix structure, and memory allocation ---*/
   
   SetIndexes(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind, nnz, config);
@@ -200,6 +317,40 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   
 }
 
+CSysMatrixPattern *CSysMatrix::GetPattern(CGeometry *geometry, bool EdgeConnect, unsigned long val_nPoint, unsigned long val_nPointDomain) {
+  
+  unsigned long iPattern;
+  
+  for (iPattern = 0; iPattern < Pattern_List.size(); iPattern++) {
+    if ((Pattern_List[iPattern]->geometry == geometry) &&
+        (Pattern_List[iPattern]->EdgeConnect == EdgeConnect) &&
+        (Pattern_List[iPattern]->nPoint == val_nPoint) &&
+        (Pattern_List[iPattern]->nPointDomain == val_nPointDomain))
+      return Pattern_List[iPattern];
+  }
+  
+  return NULL;
+  
+}
+
+void CSysMatrix::ReleasePattern(CSysMatrixPattern *val_pattern) {
+  
+  unsigned long iPattern;
+  
+  val_pattern->nRef--;
+  if (val_pattern->nRef > 0) return;
+  
+  for (iPattern = 0; iPattern < Pattern_List.size(); iPattern++) {
+    if (Pattern_List[iPattern] == val_pattern) {
+      Pattern_List.erase(Pattern_List.begin()+iPattern);
+      break;
+    }
+  }
+  
+  delete val_pattern;
+  
+}
+
 void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config) {
   
   unsigned long iVar;
@@ -212,6 +363,10 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   row_ptr      = val_row_ptr;
   col_ind      = val_col_ind;
   
+  /*--- Select the kernels of the block operations for this block size ---*/
+  
+  SetBlockKernels();
+  
   matrix            = new su2double [nnz*nVar*nEqn];  // Reserve memory for the values of the matrix
   block             = new su2double [nVar*nEqn];
   block_weight      = new su2double [nVar*nEqn];
@@ -221,6 +376,7 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   prod_row_vector   = new su2double [nVar];
   aux_vector        = new su2double [nVar];
   sum_vector        = new su2double [nVar];
+  block_load        = new su2double [2*nVar*nEqn];
   
   /*--- Memory initialization ---*/
   
@@ -233,10 +389,26 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   for (iVar = 0; iVar < nVar; iVar++)          prod_row_vector[iVar] = 0.0;
   for (iVar = 0; iVar < nVar; iVar++)          aux_vector[iVar] = 0.0;
   for (iVar = 0; iVar < nVar; iVar++)          sum_vector[iVar] = 0.0;
+  for (iVar = 0; iVar < 2*nVar*nEqn; iVar++)   block_load[iVar] = 0.0;
+  
+  /*--- The ILU and Jacobi preconditioners can be stored in single precision,
+   which halves their memory and the memory traffic of their application.
+   The blocks are converted to double precision to operate with them, so
+   the Krylov solvers still iterate in double precision. ---*/
+  
+  prec_float = config->GetLinear_Solver_Prec_Float();
+  
+  /*--- The levels of the algebraic multigrid preconditioner (this matrix
+   and the coarse ones) need the storage of their smoother, the deformation
+   can also be solved by SU2_CFD for the dynamic meshes. ---*/
+  
+  bool amg = ((config->GetKind_Linear_Solver_Prec() == AMG) ||
+              (config->GetKind_Deform_Linear_Solver_Prec() == AMG));
   
   /*--- Set specific preconditioner matrices (ILU) ---*/
   
   if ((config->GetKind_Linear_Solver_Prec() == ILU) ||
+      (amg && (config->GetLinear_Solver_AMG_Smoother() == ILU)) ||
   		((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == ILU)) ||
   		((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == ILU)) ||
   		(config->GetKind_Linear_Solver() == SMOOTHER_ILU) ||
@@ -244,8 +416,41 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
     
     /*--- Reserve memory for the ILU matrix. ---*/
     
-    ILU_matrix = new su2double [nnz*nVar*nEqn];
-    for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    if (prec_float) {
+      ILU_matrix_float = new float [nnz*nVar*nEqn];
+      for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) ILU_matrix_float[iVar] = 0.0;
+    }
+    else {
+      ILU_matrix = new su2double [nnz*nVar*nEqn];
+      for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    }
+    
+    /*--- Levels of the factorization and of the substitutions, so that
+     they can be shared among the threads, and work arrays of each thread.
+     The levels only depend on the pattern, they are computed once for all
+     the matrices that share it. ---*/
+    
+    if (pattern != NULL) {
+      if (!pattern->ILU_Levels) {
+        SetILU_Levels(false, pattern->nLevel_Lower, pattern->Level_Lower_Ptr, pattern->Level_Lower_Row);
+        SetILU_Levels(true, pattern->nLevel_Upper, pattern->Level_Upper_Ptr, pattern->Level_Upper_Row);
+        pattern->ILU_Levels = true;
+      }
+      nLevel_Lower    = pattern->nLevel_Lower;
+      Level_Lower_Ptr = pattern->Level_Lower_Ptr;
+      Level_Lower_Row = pattern->Level_Lower_Row;
+      nLevel_Upper    = pattern->nLevel_Upper;
+      Level_Upper_Ptr = pattern->Level_Upper_Ptr;
+      Level_Upper_Row = pattern->Level_Upper_Row;
+    }
+    else {
+      SetILU_Levels(false, nLevel_Lower, Level_Lower_Ptr, Level_Lower_Row);
+      SetILU_Levels(true, nLevel_Upper, Level_Upper_Ptr, Level_Upper_Row);
+    }
+    
+    nWork_ILU = 5*nVar*nEqn + 2*nVar;
+    ILU_work = new su2double [SU2_OMP_GetMaxThreads()*nWork_ILU];
+    for (iVar = 0; iVar < SU2_OMP_GetMaxThreads()*nWork_ILU; iVar++) ILU_work[iVar] = 0.0;
 
   }
   
@@ -253,6 +458,7 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   
   if ((config->GetKind_Linear_Solver_Prec() == JACOBI) ||
       (config->GetKind_Linear_Solver_Prec() == LINELET) ||
+      (amg && (config->GetLinear_Solver_AMG_Smoother() == JACOBI)) ||
    		((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI)) ||
     	((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI)) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_JACOBI) ||
@@ -261,9 +467,204 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
     
     /*--- Reserve memory for the values of the inverse of the preconditioner. ---*/
     
-    invM = new su2double [nPoint*nVar*nEqn];
-    for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    if (prec_float) {
+      invM_float = new float [nPoint*nVar*nEqn];
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM_float[iVar] = 0.0;
+    }
+    else {
+      invM = new su2double [nPoint*nVar*nEqn];
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    }
+
+  }
+
+}
+
+void CSysMatrix::SetBlockKernels(void) {
+
+  /*--- The block size is fixed for the life of the matrix, so the kernels are
+   selected only once. The usual sizes get the specialized kernels (loops with
+   compile time bounds that the compiler can unroll and vectorize): 1 and 2 for
+   the turbulence models, 4 and 5 for the 2D and 3D flow equations, and 3, 6
+   and 7 for the coupled cases. Other sizes use the generic kernels. ---*/
+
+  switch (nVar) {
+    case 1: BlockVector_Kernel = &BlockVector<1>; BlockVectorAdd_Kernel = &BlockVectorAdd<1>; BlockVectorSub_Kernel = &BlockVectorSub<1>;
+      BlockBlock_Kernel = &BlockBlock<1>; BlockSolve_Kernel = &BlockSolve<1>; BlockInverse_Kernel = &BlockInverse<1>; break;
+    case 2: BlockVector_Kernel = &BlockVector<2>; BlockVectorAdd_Kernel = &BlockVectorAdd<2>; BlockVectorSub_Kernel = &BlockVectorSub<2>;
+      BlockBlock_Kernel = &BlockBlock<2>; BlockSolve_Kernel = &BlockSolve<2>; BlockInverse_Kernel = &BlockInverse<2>; break;
+    case 3: BlockVector_Kernel = &BlockVector<3>; BlockVectorAdd_Kernel = &BlockVectorAdd<3>; BlockVectorSub_Kernel = &BlockVectorSub<3>;
+      BlockBlock_Kernel = &BlockBlock<3>; BlockSolve_Kernel = &BlockSolve<3>; BlockInverse_Kernel = &BlockInverse<3>; break;
+    case 4: BlockVector_Kernel = &BlockVector<4>; BlockVectorAdd_Kernel = &BlockVectorAdd<4>; BlockVectorSub_Kernel = &BlockVectorSub<4>;
+      BlockBlock_Kernel = &BlockBlock<4>; BlockSolve_Kernel = &BlockSolve<4>; BlockInverse_Kernel = &BlockInverse<4>; break;
+    case 5: BlockVector_Kernel = &BlockVector<5>; BlockVectorAdd_Kernel = &BlockVectorAdd<5>; BlockVectorSub_Kernel = &BlockVectorSub<5>;
+      BlockBlock_Kernel = &BlockBlock<5>; BlockSolve_Kernel = &BlockSolve<5>; BlockInverse_Kernel = &BlockInverse<5>; break;
+    case 6: BlockVector_Kernel = &BlockVector<6>; BlockVectorAdd_Kernel = &BlockVectorAdd<6>; BlockVectorSub_Kernel = &BlockVectorSub<6>;
+      BlockBlock_Kernel = &BlockBlock<6>; BlockSolve_Kernel = &BlockSolve<6>; BlockInverse_Kernel = &BlockInverse<6>; break;
+    case 7: BlockVector_Kernel = &BlockVector<7>; BlockVectorAdd_Kernel = &BlockVectorAdd<7>; BlockVectorSub_Kernel = &BlockVectorSub<7>;
+      BlockBlock_Kernel = &BlockBlock<7>; BlockSolve_Kernel = &BlockSolve<7>; BlockInverse_Kernel = &BlockInverse<7>; break;
+    default: BlockVector_Kernel = &BlockVector<0>; BlockVectorAdd_Kernel = &BlockVectorAdd<0>; BlockVectorSub_Kernel = &BlockVectorSub<0>;
+      BlockBlock_Kernel = &BlockBlock<0>; BlockSolve_Kernel = &BlockSolve<0>; BlockInverse_Kernel = &BlockInverse<0>; break;
+  }
+
+}
+
+template<unsigned short BS>
+void CSysMatrix::BlockVector(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar) {
+
+  const unsigned short n = (BS != 0) ? BS : val_nVar;
+  unsigned short iVar, jVar;
+
+  for (iVar = 0; iVar < n; iVar++) {
+    c[iVar] = 0.0;
+    for (jVar = 0; jVar < n; jVar++)
+      c[iVar] += a[iVar*n+jVar] * b[jVar];
+  }
+
+}
+
+template<unsigned short BS>
+void CSysMatrix::BlockVectorAdd(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar) {
+
+  const unsigned short n = (BS != 0) ? BS : val_nVar;
+  unsigned short iVar, jVar;
+  su2double sum;
+
+  for (iVar = 0; iVar < n; iVar++) {
+    sum = 0.0;
+    for (jVar = 0; jVar < n; jVar++)
+      sum += a[iVar*n+jVar] * b[jVar];
+    c[iVar] += sum;
+  }
+
+}
+
+template<unsigned short BS>
+void CSysMatrix::BlockVectorSub(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar) {
+
+  const unsigned short n = (BS != 0) ? BS : val_nVar;
+  unsigned short iVar, jVar;
+  su2double sum;
 
+  for (iVar = 0; iVar < n; iVar++) {
+    sum = 0.0;
+    for (jVar = 0; jVar < n; jVar++)
+      sum += a[iVar*n+jVar] * b[jVar];
+    c[iVar] -= sum;
+  }
+
+}
+
+template<unsigned short BS>
+void CSysMatrix::BlockBlock(const su2double *a, const su2double *b, su2double *c, unsigned short val_nVar) {
+
+  const unsigned short n = (BS != 0) ? BS : val_nVar;
+  unsigned short iVar, jVar, kVar;
+
+  for (iVar = 0; iVar < n; iVar++) {
+    for (jVar = 0; jVar < n; jVar++) {
+      c[iVar*n+jVar] = 0.0;
+      for (kVar = 0; kVar < n; kVar++)
+        c[iVar*n+jVar] += a[iVar*n+kVar] * b[kVar*n+jVar];
+    }
+  }
+
+}
+
+template<unsigned short BS>
+void CSysMatrix::BlockSolve(const su2double *Block, su2double *rhs, su2double *work, bool transposed, unsigned short val_nVar) {
+
+  const short n = (BS != 0) ? BS : val_nVar;
+  short iVar, jVar, kVar; // Signed, the backwards substitution counts down to zero
+  su2double weight, aux;
+
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm---*/
+
+  if (!transposed) {
+    for (iVar = 0; iVar < n; iVar++)
+      for (jVar = 0; jVar < n; jVar++)
+        work[iVar*n+jVar] = Block[iVar*n+jVar];
+  } else {
+    for (iVar = 0; iVar < n; iVar++)
+      for (jVar = 0; jVar < n; jVar++)
+        work[iVar*n+jVar] = Block[jVar*n+iVar];
+  }
+
+  /*--- Transform system in Upper Matrix ---*/
+
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = work[iVar*n+jVar] / work[jVar*n+jVar];
+      for (kVar = jVar; kVar < n; kVar++)
+        work[iVar*n+kVar] -= weight*work[jVar*n+kVar];
+      rhs[iVar] -= weight*rhs[jVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+
+  rhs[n-1] = rhs[n-1] / work[n*n-1];
+  for (iVar = n-2; iVar >= 0; iVar--) {
+    aux = 0.0;
+    for (jVar = iVar+1; jVar < n; jVar++)
+      aux += work[iVar*n+jVar]*rhs[jVar];
+    rhs[iVar] = (rhs[iVar]-aux) / work[iVar*n+iVar];
+  }
+
+}
+
+template<unsigned short BS>
+void CSysMatrix::BlockInverse(const su2double *Block, su2double *invBlock, su2double *work, bool transposed, unsigned short val_nVar) {
+
+  const short n = (BS != 0) ? BS : val_nVar;
+  short iVar, jVar, kVar, lVar; // Signed, the backwards substitution counts down to zero
+  su2double weight, aux;
+
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm---*/
+
+  if (!transposed) {
+    for (iVar = 0; iVar < n; iVar++)
+      for (jVar = 0; jVar < n; jVar++)
+        work[iVar*n+jVar] = Block[iVar*n+jVar];
+  } else {
+    for (iVar = 0; iVar < n; iVar++)
+      for (jVar = 0; jVar < n; jVar++)
+        work[iVar*n+jVar] = Block[jVar*n+iVar];
+  }
+
+  /*--- The right hand sides are the columns of the identity, which are
+   transformed together (the same operations as n Gauss eliminations of a
+   single column, but the block is only eliminated once) ---*/
+
+  for (iVar = 0; iVar < n; iVar++)
+    for (jVar = 0; jVar < n; jVar++)
+      invBlock[iVar*n+jVar] = (iVar == jVar) ? 1.0 : 0.0;
+
+  /*--- Transform system in Upper Matrix ---*/
+
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = work[iVar*n+jVar] / work[jVar*n+jVar];
+      for (kVar = jVar; kVar < n; kVar++)
+        work[iVar*n+kVar] -= weight*work[jVar*n+kVar];
+      for (lVar = 0; lVar < n; lVar++)
+        invBlock[iVar*n+lVar] -= weight*invBlock[jVar*n+lVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+
+  for (lVar = 0; lVar < n; lVar++)
+    invBlock[(n-1)*n+lVar] = invBlock[(n-1)*n+lVar] / work[n*n-1];
+  for (iVar = n-2; iVar >= 0; iVar--) {
+    for (lVar = 0; lVar < n; lVar++) {
+      aux = 0.0;
+      for (jVar = iVar+1; jVar < n; jVar++)
+        aux += work[iVar*n+jVar]*invBlock[jVar*n+lVar];
+      invBlock[iVar*n+lVar] = (invBlock[iVar*n+lVar]-aux) / work[iVar*n+iVar];
+    }
   }
 
 }
@@ -358,89 +759,52 @@ void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2
 
 su2double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
   
-  unsigned long step = 0, index;
+  unsigned long index = GetIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) { return &(ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
-  }
-  return NULL;
+  if ((ILU_matrix == NULL) || (index == nnz)) return NULL;
+  return &(ILU_matrix[index*nVar*nEqn]);
   
 }
 
 void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long index = GetIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
-      break;
-    }
-  }
+  if (index == nnz) return;
+  if (prec_float) StoreBlock(&ILU_matrix_float[index*nVar*nEqn], val_block);
+  else StoreBlock(&ILU_matrix[index*nVar*nEqn], val_block);
   
 }
 
 void CSysMatrix::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
 
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long index = GetIndex(block_i, block_j);
 
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[jVar*nVar+iVar];
-      break;
-    }
-  }
+  if (index == nnz) return;
+  if (prec_float) StoreBlock(&ILU_matrix_float[index*nVar*nEqn], val_block, true);
+  else StoreBlock(&ILU_matrix[index*nVar*nEqn], val_block, true);
 
 }
 
 void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long index = GetIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar*nVar+jVar];
-      break;
-    }
-  }
+  if (index == nnz) return;
+  if (prec_float) SubtractFromBlock(&ILU_matrix_float[index*nVar*nEqn], val_block);
+  else SubtractFromBlock(&ILU_matrix[index*nVar*nEqn], val_block);
   
 }
 
 void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2double *product) {
   
-  unsigned short iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    product[iVar] = 0.0;
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
-    }
-  }
+  BlockVector_Kernel(matrix, vector, product, nVar);
   
 }
 
 void CSysMatrix::MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, su2double *product) {
   
-  unsigned short iVar, jVar, kVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++) {
-        product[iVar*nVar+jVar] += matrix_a[iVar*nVar+kVar]*matrix_b[kVar*nVar+jVar];
-      }
-    }
-  }
+  BlockBlock_Kernel(matrix_a, matrix_b, product, nVar);
   
 }
 
@@ -593,150 +957,34 @@ void CSysMatrix::MatrixTranspose(su2double **a, unsigned long n) {
 
 void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool transposed) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  su2double *Block = GetBlock(block_i, block_i);
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  if (!transposed) {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
-        block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  } else {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
-        block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
-  }
-  /*--- Gauss elimination ---*/
+  /*--- The block of the matrix is copied to the internal array block,
+   the original matrix is not modified ---*/
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  BlockSolve_Kernel(GetBlock(block_i, block_i), rhs, block, transposed, nVar);
   
 }
 
 void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+  unsigned long index = GetIndex(block_i, block_i)*nVar*nEqn;
+  const su2double *Block;
   
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+  if (prec_float) Block = LoadBlock(&ILU_matrix_float[index], block_load);
+  else Block = &ILU_matrix[index];
   
-  /*--- Gauss elimination ---*/
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  BlockSolve_Kernel(Block, rhs, block, false, nVar);
   
 }
 
 void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  BlockSolve_Kernel(Block, rhs, block, false, nVar);
   
 }
 
 void CSysMatrix::ProdBlockVector(unsigned long block_i, unsigned long block_j, const CSysVector & vec) {
   
-  unsigned long j = block_j*nVar;
-  unsigned short iVar, jVar;
-  
-  su2double *block = GetBlock(block_i, block_j);
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    prod_block_vector[iVar] = 0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      prod_block_vector[iVar] += block[iVar*nVar+jVar]*vec[j+jVar];
-  }
+  BlockVector_Kernel(GetBlock(block_i, block_j), &vec[block_j*nVar], prod_block_vector, nVar);
   
 }
 
@@ -793,89 +1041,13 @@ void CSysMatrix::DiagonalProduct(CSysVector & vec, unsigned long row_i) {
 
 void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConfig *config) {
   
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive = NULL, *Buffer_Send = NULL;
+  /*--- All the neighbours are exchanged at once, with the preallocated
+   buffers of the halo exchange of the grid level. The coarse levels of the
+   algebraic multigrid have no geometry and no halo points. ---*/
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
+  if (geometry == NULL) return;
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-      
-#endif
-
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      
-      Buffer_Receive = new su2double [nBufferR_Vector];
-      Buffer_Send = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution that should be sended ---*/
-      
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send[iVertex*nVar+iVar] = x[iPoint*nVar+iVar];
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      
-      SU2_MPI::Sendrecv(Buffer_Send, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive[iVar*nVertexR+iVertex] = Buffer_Send[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      
-      delete [] Buffer_Send;
-      
-      /*--- Do the coordinate transformation ---*/
-      
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        
-        for (iVar = 0; iVar < nVar; iVar++)
-          x[iPoint*nVar+iVar] = Buffer_Receive[iVertex*nVar+iVar];
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      
-      delete [] Buffer_Receive;
-      
-    }
-    
-  }
+  geometry->GetHaloExchange(config)->SendReceive(x);
   
 }
 
@@ -996,7 +1168,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod)
 
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
+  unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
   
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
@@ -1016,11 +1188,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
     for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
       vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
       mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(unsigned long)(prod_begin+iVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+jVar)];
-        }
-      }
+      BlockVectorAdd_Kernel(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin], nVar);
     }
   }
   
@@ -1066,26 +1234,13 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
 
 void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar, kVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) {
-      c[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++)
-        c[iVar*nVar+jVar] += a[iVar*nVar+kVar] * b[kVar*nVar+jVar];
-    }
+  BlockBlock_Kernel(a, b, c, nVar);
   
 }
 
 void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    c[iVar] =  0.0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
-  }
+  BlockVector_Kernel(a, b, c, nVar);
   
 }
 
@@ -1110,37 +1265,15 @@ void CSysMatrix::GetSubsVector(su2double *c, su2double *a, su2double *b) {
 
 void CSysMatrix::InverseBlock(su2double *Block, su2double *invBlock) {
   
-  unsigned long iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    Gauss_Elimination(Block, aux_vector);
-    
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
+  BlockInverse_Kernel(Block, invBlock, block, false, nVar);
   
 }
 
 void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock, bool transpose) {
   
-  unsigned long iVar, jVar;
+  /*--- All the columns of the inverse matrix are computed at once ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    
-    Gauss_Elimination(block_i, aux_vector, transpose);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
+  BlockInverse_Kernel(GetBlock(block_i, block_i), invBlock, block, transpose, nVar);
   
   //  su2double Det, **Matrix, **CoFactor;
   //  su2double *Block = GetBlock(block_i, block_i);
@@ -1179,19 +1312,15 @@ void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock
 
 void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double *invBlock) {
   
-  unsigned long iVar, jVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    
-    Gauss_Elimination_ILUMatrix(block_i, aux_vector);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
+  unsigned long index = GetIndex(block_i, block_i)*nVar*nEqn;
+  const su2double *Block;
+  
+  if (prec_float) Block = LoadBlock(&ILU_matrix_float[index], block_load);
+  else Block = &ILU_matrix[index];
+  
+  /*--- All the columns of the inverse matrix are computed at once ---*/
+  
+  BlockInverse_Kernel(Block, invBlock, block, false, nVar);
   
   //  su2double Det, **Matrix, **CoFactor;
   //  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
@@ -1229,7 +1358,7 @@ void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double
 
 void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
-  unsigned long iPoint, iVar, jVar;
+  unsigned long iPoint;
 
   /*--- Compute Jacobi Preconditioner ---*/
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -1238,9 +1367,8 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
     InverseDiagonalBlock(iPoint, block_inverse, transpose);
 
     /*--- Set the inverse of the matrix to the invM structure (which is a vector) ---*/
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (jVar = 0; jVar < nVar; jVar++)
-        invM[iPoint*nVar*nVar+iVar*nVar+jVar] = block_inverse[iVar*nVar+jVar];
+    if (prec_float) StoreBlock(&invM_float[iPoint*nVar*nVar], block_inverse);
+    else StoreBlock(&invM[iPoint*nVar*nVar], block_inverse);
   }
 
 }
@@ -1248,16 +1376,10 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
 void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, iVar, jVar;
+  unsigned long iPoint;
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++)
-        prod[(unsigned long)(iPoint*nVar+iVar)] +=
-        invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
-    }
-  }
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    BlockVector_Kernel(GetBlock_InvM(iPoint, block_load), &vec[iPoint*nVar], &prod[iPoint*nVar], nVar);
   
   /*--- MPI Parallelization ---*/
   
@@ -1267,7 +1389,7 @@ void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector
 
 unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, iVar, jVar;
+  unsigned long iPoint;
   int rank = MASTER_NODE;
   
 #ifdef HAVE_MPI
@@ -1328,13 +1450,8 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
      diagonal matrix of A, which was built in the preprocessing phase. Note
      that we are directly updating the solution (x^k+1) during the loop. ---*/
     
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++)
-          x[(unsigned long)(iPoint*nVar+iVar)] +=
-          invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*r[(unsigned long)(iPoint*nVar+jVar)];
-      }
-    }
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      BlockVectorAdd_Kernel(GetBlock_InvM(iPoint, block_load), &r[iPoint*nVar], &x[iPoint*nVar], nVar);
     
     /*--- MPI Parallelization ---*/
     
@@ -1367,147 +1484,241 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
 
 void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   
-  unsigned long index, index_;
-  su2double *Block_ij, *Block_jk;
-  long iPoint, jPoint, kPoint;
+  /*--- The factorization is computed directly in the storage of the
+   preconditioner, in double or single precision ---*/
   
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm, so that we have the factorization stored
-   in the ILUMatrix at the end of this preprocessing. ---*/
+  if (prec_float) BuildILU(ILU_matrix_float, transposed);
+  else BuildILU(ILU_matrix, transposed);
   
-  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      if (transposed) {
-        Block_ij = GetBlock(jPoint, iPoint);
-        SetBlockTransposed_ILUMatrix(iPoint, jPoint, Block_ij);
-      } else {
-        Block_ij = GetBlock(iPoint, jPoint);
-        SetBlock_ILUMatrix(iPoint, jPoint, Block_ij);
+}
+
+template<class ScalarType>
+void CSysMatrix::BuildILU(ScalarType *ilu, bool transposed) {
+  
+  bool threaded = (SU2_OMP_GetMaxThreads() > 1);
+  
+  /*--- The rows of a level only need the rows of the previous levels, so they
+   are factorized in parallel. Each row is processed with the same operations,
+   in the same order, as in the sequential factorization, so the result does
+   not depend on the number of threads. ---*/
+  
+  SU2_OMP(parallel if(threaded))
+  {
+    
+    unsigned long iLevel, iRow, iPoint, jPoint, kPoint, index, index_, index_ik, nBlk = nVar*nEqn;
+    const su2double *Block_ij, *Block_jk;
+    
+    /*--- Work arrays of the thread ---*/
+    
+    su2double *Work_ij = &ILU_work[SU2_OMP_GetThreadNum()*nWork_ILU];
+    su2double *Work_jk = &Work_ij[nBlk], *Inverse = &Work_ij[2*nBlk], *Weight = &Work_ij[3*nBlk], *Product = &Work_ij[4*nBlk];
+    
+    /*--- Copy block matrix, note that the original matrix
+     is modified by the algorithm, so that we have the factorization stored
+     in the ILUMatrix at the end of this preprocessing. ---*/
+    
+    SU2_OMP(for schedule(static))
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        jPoint = col_ind[index];
+        if (transposed) StoreBlock(&ilu[index*nBlk], GetBlock(jPoint, iPoint), true);
+        else StoreBlock(&ilu[index*nBlk], &matrix[index*nBlk]);
       }
     }
-  }
-  
-  /*--- Transform system in Upper Matrix ---*/
-  
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
     
-    /*--- For each row (unknown), loop over all entries in A on this row
-     row_ptr[iPoint+1] will have the index for the first entry on the next
-     row. ---*/
+    /*--- Transform system in Upper Matrix, level by level ---*/
     
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      
-      /*--- jPoint here is the column for each entry on this row ---*/
-      
-      jPoint = col_ind[index];
-      
-      /*--- Check that this column is in the lower triangular portion ---*/
+    for (iLevel = 0; iLevel < nLevel_Lower; iLevel++) {
       
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
+      SU2_OMP(for schedule(static))
+      for (iRow = Level_Lower_Ptr[iLevel]; iRow < Level_Lower_Ptr[iLevel+1]; iRow++) {
         
-        /*--- If we're in the lower triangle, get the pointer to this block,
-         invert it, and then right multiply against the original block ---*/
+        iPoint = Level_Lower_Row[iRow];
         
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        InverseDiagonalBlock_ILUMatrix(jPoint, block_inverse);
-        MatrixMatrixProduct(Block_ij, block_inverse, block_weight);
+        /*--- For each row (unknown), loop over all entries in A on this row
+         row_ptr[iPoint+1] will have the index for the first entry on the next
+         row. ---*/
         
-        /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
-        
-        for (index_ = row_ptr[jPoint]; index_ < row_ptr[jPoint+1]; index_++) {
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
           
-          /*--- Get the column of the entry ---*/
+          /*--- jPoint here is the column for each entry on this row ---*/
           
-          kPoint = col_ind[index_];
+          jPoint = col_ind[index];
           
-          /*--- If the column is greater than or equal to jPoint, i.e., the
-           upper triangular part, then multiply and modify the matrix.
-           Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
+          /*--- Check that this column is in the lower triangular portion ---*/
           
-          if (kPoint < (long)nPointDomain) {
-            Block_jk = GetBlock_ILUMatrix(jPoint, kPoint);
-            if (kPoint >= jPoint) {
+          if (jPoint < iPoint) {
+            
+            /*--- If we're in the lower triangle, get the pointer to this block,
+             invert it, and then right multiply against the original block ---*/
+            
+            Block_ij = LoadBlock(&ilu[index*nBlk], Work_ij);
+            BlockInverse_Kernel(LoadBlock(&ilu[GetIndex(jPoint, jPoint)*nBlk], Work_jk), Inverse, Product, false, nVar);
+            BlockBlock_Kernel(Block_ij, Inverse, Weight, nVar);
+            
+            /*--- Weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
+            
+            for (index_ = row_ptr[jPoint]; index_ < row_ptr[jPoint+1]; index_++) {
+              
+              /*--- Get the column of the entry ---*/
               
-              // WARNING: here we have a left multiply by Block_jk, should it
-              // be a right multiply to give Aik' = Aik - Aij*inv(Ajj)*Ajk?
+              kPoint = col_ind[index_];
               
-              MatrixMatrixProduct(Block_jk, block_weight, block);
-              SubtractBlock_ILUMatrix(iPoint, kPoint, block);
+              /*--- If the column is greater than or equal to jPoint, i.e., the
+               upper triangular part, then multiply and modify the matrix.
+               Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
               
+              if ((kPoint < nPointDomain) && (kPoint >= jPoint)) {
+                
+                // WARNING: here we have a left multiply by Block_jk, should it
+                // be a right multiply to give Aik' = Aik - Aij*inv(Ajj)*Ajk?
+                
+                Block_jk = LoadBlock(&ilu[index_*nBlk], Work_jk);
+                BlockBlock_Kernel(Block_jk, Weight, Product, nVar);
+                
+                index_ik = GetIndex(iPoint, kPoint);
+                if (index_ik != nnz) SubtractFromBlock(&ilu[index_ik*nBlk], Product);
+                
+              }
             }
+            
+            /*--- Lastly, store Weight in the lower triangular part, which
+             will be reused during the forward solve in the precon/smoother. ---*/
+            
+            StoreBlock(&ilu[index*nBlk], Weight);
+            
           }
         }
-        
-        /*--- Lastly, store block_weight in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
-        
-        SetBlock_ILUMatrix(iPoint, jPoint, block_weight);
-        
       }
     }
+    
   }
   
 }
 
-void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+template<class ScalarType>
+void CSysMatrix::SolveILU(const ScalarType *ilu, CSysVector & vec) {
   
-  unsigned long index;
-  su2double *Block_ij;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  bool threaded = (SU2_OMP_GetMaxThreads() > 1);
   
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+  /*--- As in the factorization, the rows of a level are independent and
+   the result does not depend on the number of threads. ---*/
   
-  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+  SU2_OMP(parallel if(threaded))
+  {
+    
+    unsigned long iLevel, iRow, iPoint, jPoint, index, nBlk = nVar*nEqn;
+    unsigned short iVar;
+    
+    /*--- Work arrays of the thread ---*/
+    
+    su2double *Work = &ILU_work[SU2_OMP_GetThreadNum()*nWork_ILU];
+    su2double *Inverse = &Work[nBlk], *Product = &Work[2*nBlk], *Sum = &Work[5*nBlk], *Aux = &Work[5*nBlk+nVar];
+    
+    /*--- Forward solve the system using the lower matrix entries that
+     were computed and stored during the ILU0 preprocessing. Note
+     that we are overwriting the vector as we go. ---*/
+    
+    for (iLevel = 0; iLevel < nLevel_Lower; iLevel++) {
+      SU2_OMP(for schedule(static))
+      for (iRow = Level_Lower_Ptr[iLevel]; iRow < Level_Lower_Ptr[iLevel+1]; iRow++) {
+        iPoint = Level_Lower_Row[iRow];
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+          jPoint = col_ind[index];
+          if (jPoint < iPoint)
+            BlockVectorSub_Kernel(LoadBlock(&ilu[index*nBlk], Work), &vec[jPoint*nVar], &vec[iPoint*nVar], nVar);
+        }
+      }
+    }
+    
+    /*--- Backwards substitution (the levels start at the last row) ---*/
+    
+    for (iLevel = 0; iLevel < nLevel_Upper; iLevel++) {
+      SU2_OMP(for schedule(static))
+      for (iRow = Level_Upper_Ptr[iLevel]; iRow < Level_Upper_Ptr[iLevel+1]; iRow++) {
+        iPoint = Level_Upper_Row[iRow];
+        for (iVar = 0; iVar < nVar; iVar++) Sum[iVar] = 0.0;
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+          jPoint = col_ind[index];
+          if ((jPoint > iPoint) && (jPoint < nPointDomain))
+            BlockVectorAdd_Kernel(LoadBlock(&ilu[index*nBlk], Work), &vec[jPoint*nVar], Sum, nVar);
+        }
+        for (iVar = 0; iVar < nVar; iVar++) vec[iPoint*nVar+iVar] = (vec[iPoint*nVar+iVar]-Sum[iVar]);
+        BlockInverse_Kernel(LoadBlock(&ilu[GetIndex(iPoint, iPoint)*nBlk], Work), Inverse, Product, false, nVar);
+        BlockVector_Kernel(Inverse, &vec[iPoint*nVar], Aux, nVar);
+        for (iVar = 0; iVar < nVar; iVar++) vec[iPoint*nVar+iVar] = Aux[iVar];
+      }
     }
+    
   }
   
-  /*--- Transform system in Upper Matrix ---*/
+}
+
+void CSysMatrix::SetILU_Levels(bool upper, unsigned long &val_nLevel, unsigned long *&val_Level_Ptr, unsigned long *&val_Level_Row) {
+  
+  unsigned long iRow, iPoint, jPoint, index, iLevel, *Level, *Level_Pos;
+  
+  /*--- Level of each row: one more than the highest level of the rows it depends
+   on, i.e. the lower (forward substitution) or upper (backward substitution)
+   columns of the row. ---*/
   
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
+  Level = new unsigned long [nPointDomain];
+  val_nLevel = 0;
+  
+  for (iRow = 0; iRow < nPointDomain; iRow++) {
+    iPoint = (upper ? nPointDomain-1-iRow : iRow);
+    Level[iPoint] = 0;
     for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
       jPoint = col_ind[index];
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-        for (iVar = 0; iVar < nVar; iVar++)
-          prod[iPoint*nVar+iVar] -= aux_vector[iVar];
-        
-      }
+      if ((jPoint < nPointDomain) && ((upper && (jPoint > iPoint)) || (!upper && (jPoint < iPoint))))
+        if (Level[jPoint]+1 > Level[iPoint]) Level[iPoint] = Level[jPoint]+1;
     }
+    if (Level[iPoint]+1 > val_nLevel) val_nLevel = Level[iPoint]+1;
   }
   
-  /*--- Backwards substitution ---*/
+  /*--- Sort the rows by level (compressed storage) ---*/
   
-  InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-  MatrixVectorProduct(block_inverse, &prod[(nPointDomain-1)*nVar], aux_vector);
+  val_Level_Ptr = new unsigned long [val_nLevel+1];
+  val_Level_Row = new unsigned long [nPointDomain];
+  Level_Pos     = new unsigned long [val_nLevel];
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    prod[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
+  for (iLevel = 0; iLevel <= val_nLevel; iLevel++) val_Level_Ptr[iLevel] = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) val_Level_Ptr[Level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < val_nLevel; iLevel++) {
+    val_Level_Ptr[iLevel+1] += val_Level_Ptr[iLevel];
+    Level_Pos[iLevel] = val_Level_Ptr[iLevel];
+  }
   
-  for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      if (jPoint < (long)nPointDomain) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-          MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-        }
-      }
+  for (iRow = 0; iRow < nPointDomain; iRow++) {
+    iPoint = (upper ? nPointDomain-1-iRow : iRow);
+    val_Level_Row[Level_Pos[Level[iPoint]]] = iPoint;
+    Level_Pos[Level[iPoint]]++;
+  }
+  
+  delete [] Level;
+  delete [] Level_Pos;
+  
+}
+
+void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint;
+  unsigned short iVar;
+  
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
     }
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = (prod[iPoint*nVar+iVar]-sum_vector[iVar]);
-    InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-    MatrixVectorProduct(block_inverse, &prod[iPoint*nVar], aux_vector);
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector[iVar];
-    if (iPoint == 0) break;
   }
   
+  /*--- Forward and backward substitution with the factorization ---*/
+  
+  if (prec_float) SolveILU(ILU_matrix_float, prod);
+  else SolveILU(ILU_matrix, prod);
+  
   /*--- MPI Parallelization ---*/
   
   SendReceive_Solution(prod, geometry, config);
@@ -1516,10 +1727,7 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
 
 unsigned long CSysMatrix::ILU0_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij, omega = 1.0;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  su2double omega = 1.0;
   int rank = MASTER_NODE;
   
 #ifdef HAVE_MPI
@@ -1576,64 +1784,12 @@ unsigned long CSysMatrix::ILU0_Smoother(const CSysVector & b, CSysVector & x, CM
   
   for (i = 0; i < (int)m; i++) {
     
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU0 preprocessing. Note
+    /*--- Forward and backward substitution with the lower and upper matrix
+     entries that were computed and stored during the ILU0 preprocessing. Note
      that we are overwriting the residual vector as we go. ---*/
     
-    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-      
-      /*--- For each row (unknown), loop over all entries in A on this row
-       row_ptr[iPoint+1] will have the index for the first entry on the next
-       row. ---*/
-      
-      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-        
-        /*--- jPoint here is the column for each entry on this row ---*/
-        
-        jPoint = col_ind[index];
-        
-        /*--- Check that this column is in the lower triangular portion ---*/
-        
-        if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-          
-          /*--- Lastly, get Aij*inv(Ajj) from the lower triangular part, which
-           was calculated in the preprocessing, and apply to r. ---*/
-          
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++)
-            r[iPoint*nVar+iVar] -= aux_vector[iVar];
-          
-        }
-      }
-    }
-    
-    /*--- Backwards substitution (starts at the last row) ---*/
-    
-    InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-    MatrixVectorProduct(block_inverse, &r[(nPointDomain-1)*nVar], aux_vector);
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      r[(nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
-    
-    for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-        jPoint = col_ind[index];
-        if (jPoint < (long)nPointDomain) {
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-            MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-            for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-          }
-        }
-      }
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = (r[iPoint*nVar+iVar]-sum_vector[iVar]);
-      InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-      MatrixVectorProduct(block_inverse, &r[iPoint*nVar], aux_vector);
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = aux_vector[iVar];
-      if (iPoint == 0) break;
-    }
+    if (prec_float) SolveILU(ILU_matrix_float, r);
+    else SolveILU(ILU_matrix, r);
     
     /*--- Update solution (x^k+1 = x^k + w*M^-1*r^k) using the residual vector,
      which holds the update after applying the ILU0 smoother, i.e., M^-1*r^k.
@@ -2046,14 +2202,8 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
     /*--- Jacobi preconditioning if there is no linelet ---*/
     
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!LineletBool[iPoint]) {
-        for (iVar = 0; iVar < nVar; iVar++) {
-          prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
-          for (jVar = 0; jVar < nVar; jVar++)
-            prod[(unsigned long)(iPoint*nVar+iVar)] +=
-            invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
-        }
-      }
+      if (!LineletBool[iPoint])
+        BlockVector_Kernel(GetBlock_InvM(iPoint, block_load), &vec[iPoint*nVar], &prod[iPoint*nVar], nVar);
     }
     
     /*--- MPI Parallelization ---*/
@@ -2159,3 +2309,328 @@ void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, C
   }
   
 }
+
+void CSysMatrix::BuildAMGPreconditioner(CConfig *config) {
+
+  /*--- The hierarchy of levels is built the first time, with the pattern
+   and the values of the first matrix, and then kept: only the values of the
+   coarse matrices and the smoothers are recomputed afterwards. ---*/
+
+  BuildAMG_Level(config->GetLinear_Solver_AMG_Levels(), config);
+
+}
+
+void CSysMatrix::BuildAMG_Level(unsigned short val_nLevel, CConfig *config) {
+
+  unsigned long nAggregate;
+
+  /*--- Coarsen the level, the coarsening stops when the level is small or
+   when the aggregation does not reduce the number of points enough. ---*/
+
+  const unsigned long nPoint_Min = 50;
+  const su2double Ratio_Max = 0.8;
+
+  if (!AMG_Built) {
+
+    AMG_Built    = true;
+    AMG_Smoother = config->GetLinear_Solver_AMG_Smoother();
+    AMG_Sweeps   = config->GetLinear_Solver_AMG_Sweeps();
+
+    AMG_Res.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    AMG_Aux.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+    if ((val_nLevel > 0) && (nPointDomain > nPoint_Min)) {
+
+      AMG_Aggregate = new unsigned long [nPointDomain];
+      nAggregate = SetAMG_Aggregates(AMG_Aggregate);
+
+      if (nAggregate < Ratio_Max*nPointDomain) {
+        SetAMG_CoarseMatrix(nAggregate, config);
+        AMG_CoarseRhs.Initialize(nAggregate, nAggregate, nVar, 0.0);
+        AMG_CoarseSol.Initialize(nAggregate, nAggregate, nVar, 0.0);
+      }
+      else {
+        delete [] AMG_Aggregate;
+        AMG_Aggregate = NULL;
+      }
+
+    }
+
+  }
+
+  /*--- Smoother of the level ---*/
+
+  switch (AMG_Smoother) {
+    case ILU:    BuildILUPreconditioner(); break;
+    case JACOBI: BuildJacobiPreconditioner(); break;
+    default: break;
+  }
+
+  /*--- Values of the coarse matrix, and the levels below it ---*/
+
+  if (AMG_Coarse != NULL) {
+    SetAMG_CoarseValues();
+    AMG_Coarse->BuildAMG_Level(val_nLevel-1, config);
+  }
+
+}
+
+unsigned long CSysMatrix::SetAMG_Aggregates(unsigned long *val_aggregate) {
+
+  unsigned long iPoint, jPoint, index, nAggregate = 0, iAggregate;
+  unsigned short iVar;
+  su2double *Strength, *Strength_Max, Best;
+  const unsigned long Unassigned = nPointDomain;
+  const su2double Threshold = 0.25;
+
+  /*--- Strength of the couplings, the Frobenius norm of the blocks. A coupling
+   of two points of the domain is strong when it is at least a fraction of the
+   strongest off-diagonal coupling of the row, the couplings with the halo
+   points are ignored (the aggregates do not cross the partitions). ---*/
+
+  Strength     = new su2double [nnz];
+  Strength_Max = new su2double [nPointDomain];
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Strength_Max[iPoint] = 0.0;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      Strength[index] = 0.0;
+      for (iVar = 0; iVar < nVar*nEqn; iVar++)
+        Strength[index] += matrix[index*nVar*nEqn+iVar]*matrix[index*nVar*nEqn+iVar];
+      Strength[index] = sqrt(Strength[index]);
+      jPoint = col_ind[index];
+      if ((jPoint != iPoint) && (jPoint < nPointDomain))
+        Strength_Max[iPoint] = max(Strength_Max[iPoint], Strength[index]);
+    }
+  }
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if ((jPoint == iPoint) || (jPoint >= nPointDomain) || (Strength_Max[iPoint] == 0.0) ||
+          (Strength[index] < Threshold*Strength_Max[iPoint]))
+        Strength[index] = -1.0;
+    }
+  }
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    val_aggregate[iPoint] = Unassigned;
+
+  /*--- First pass, a point whose strong neighbours are all free is the
+   root of a new aggregate with all of them. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (val_aggregate[iPoint] != Unassigned) continue;
+    bool Free = true, Coupled = false;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (Strength[index] < 0.0) continue;
+      Coupled = true;
+      if (val_aggregate[col_ind[index]] != Unassigned) { Free = false; break; }
+    }
+    if (Free && Coupled) {
+      val_aggregate[iPoint] = nAggregate;
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+        if (Strength[index] >= 0.0) val_aggregate[col_ind[index]] = nAggregate;
+      nAggregate++;
+    }
+  }
+
+  /*--- Second pass, the remaining points join the aggregate of their
+   strongest aggregated neighbour. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (val_aggregate[iPoint] != Unassigned) continue;
+    Best = -1.0; iAggregate = Unassigned;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if ((Strength[index] > Best) && (val_aggregate[jPoint] != Unassigned)) {
+        Best = Strength[index]; iAggregate = val_aggregate[jPoint];
+      }
+    }
+    val_aggregate[iPoint] = iAggregate;
+  }
+
+  /*--- Third pass, the points without strong couplings (e.g. the rows of
+   the Dirichlet conditions) are aggregates on their own. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (val_aggregate[iPoint] == Unassigned) {
+      val_aggregate[iPoint] = nAggregate; nAggregate++;
+    }
+  }
+
+  delete [] Strength;
+  delete [] Strength_Max;
+
+  return nAggregate;
+
+}
+
+void CSysMatrix::SetAMG_CoarseMatrix(unsigned long val_nAggregate, CConfig *config) {
+
+  unsigned long iPoint, jPoint, index, iAggregate, *coarse_row_ptr, *coarse_col_ind, coarse_nnz, iNeigh;
+  vector<unsigned long>::iterator it;
+  vector<unsigned long> *vneighs;
+
+  /*--- The coarse blocks are the sums of the fine blocks that couple two
+   aggregates (Galerkin product with piecewise constant interpolation), hence
+   the neighbours of an aggregate are the aggregates of the neighbours of its
+   points. The coarse levels have no halo points. ---*/
+
+  vneighs = new vector<unsigned long> [val_nAggregate];
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if (jPoint < nPointDomain)
+        vneighs[AMG_Aggregate[iPoint]].push_back(AMG_Aggregate[jPoint]);
+    }
+  }
+
+  coarse_row_ptr = new unsigned long [val_nAggregate+1];
+  coarse_row_ptr[0] = 0;
+  for (iAggregate = 0; iAggregate < val_nAggregate; iAggregate++) {
+    sort(vneighs[iAggregate].begin(), vneighs[iAggregate].end());
+    it = unique(vneighs[iAggregate].begin(), vneighs[iAggregate].end());
+    vneighs[iAggregate].resize(it - vneighs[iAggregate].begin());
+    coarse_row_ptr[iAggregate+1] = coarse_row_ptr[iAggregate] + vneighs[iAggregate].size();
+  }
+  coarse_nnz = coarse_row_ptr[val_nAggregate];
+
+  coarse_col_ind = new unsigned long [coarse_nnz];
+  for (iAggregate = 0; iAggregate < val_nAggregate; iAggregate++) {
+    index = coarse_row_ptr[iAggregate];
+    for (iNeigh = 0; iNeigh < vneighs[iAggregate].size(); iNeigh++) {
+      coarse_col_ind[index] = vneighs[iAggregate][iNeigh];
+      index++;
+    }
+  }
+
+  delete [] vneighs;
+
+  AMG_Coarse = new CSysMatrix();
+  AMG_Coarse->SetIndexes(val_nAggregate, val_nAggregate, nVar, nEqn, coarse_row_ptr, coarse_col_ind, coarse_nnz, config);
+
+  /*--- Position in the coarse matrix of each block of the fine matrix,
+   nnz of the coarse matrix for the couplings with the halo points. ---*/
+
+  AMG_Index = new unsigned long [nnz];
+  for (index = 0; index < nnz; index++) AMG_Index[index] = coarse_nnz;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if (jPoint < nPointDomain)
+        AMG_Index[index] = AMG_Coarse->GetIndex(AMG_Aggregate[iPoint], AMG_Aggregate[jPoint]);
+    }
+  }
+
+}
+
+void CSysMatrix::SetAMG_CoarseValues(void) {
+
+  unsigned long iPoint, index, coarse_nnz = AMG_Coarse->nnz;
+  unsigned long iVar, nBlk = nVar*nEqn;
+
+  AMG_Coarse->SetValZero();
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (AMG_Index[index] == coarse_nnz) continue;
+      for (iVar = 0; iVar < nBlk; iVar++)
+        AMG_Coarse->matrix[AMG_Index[index]*nBlk+iVar] += matrix[index*nBlk+iVar];
+    }
+  }
+
+}
+
+void CSysMatrix::ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+
+  /*--- One V cycle, starting from a zero solution ---*/
+
+  AMG_Cycle(vec, prod, geometry, config);
+
+}
+
+void CSysMatrix::AMG_Cycle(const CSysVector & b, CSysVector & x, CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint, iAggregate;
+  unsigned short iVar;
+
+  /*--- The coarsest level is only smoothed, it is small enough for the
+   smoother to converge it with a few more sweeps ---*/
+
+  const unsigned short nSweep_Coarsest = 10;
+
+  if (AMG_Coarse == NULL) {
+    AMG_Smooth(b, x, true, nSweep_Coarsest*AMG_Sweeps, geometry, config);
+    return;
+  }
+
+  /*--- Pre smoothing ---*/
+
+  AMG_Smooth(b, x, true, AMG_Sweeps, geometry, config);
+
+  /*--- Restriction of the residual, the sum over each aggregate ---*/
+
+  MatrixVectorProduct(x, AMG_Res, geometry, config);
+
+  AMG_CoarseRhs = su2double(0.0);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    iAggregate = AMG_Aggregate[iPoint];
+    for (iVar = 0; iVar < nVar; iVar++)
+      AMG_CoarseRhs[iAggregate*nVar+iVar] += b[iPoint*nVar+iVar] - AMG_Res[iPoint*nVar+iVar];
+  }
+
+  /*--- Coarse grid correction, interpolated with a constant per aggregate ---*/
+
+  AMG_Coarse->AMG_Cycle(AMG_CoarseRhs, AMG_CoarseSol, NULL, config);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    iAggregate = AMG_Aggregate[iPoint];
+    for (iVar = 0; iVar < nVar; iVar++)
+      x[iPoint*nVar+iVar] += AMG_CoarseSol[iAggregate*nVar+iVar];
+  }
+
+  SendReceive_Solution(x, geometry, config);
+
+  /*--- Post smoothing ---*/
+
+  AMG_Smooth(b, x, false, AMG_Sweeps, geometry, config);
+
+}
+
+void CSysMatrix::AMG_Smooth(const CSysVector & b, CSysVector & x, bool zero_guess, unsigned short val_nSweep,
+                            CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint;
+  unsigned short iSweep;
+
+  for (iSweep = 0; iSweep < val_nSweep; iSweep++) {
+
+    /*--- x = M^-1 b for the first sweep from a zero solution, otherwise
+     x = x + M^-1 (b - A x) ---*/
+
+    if (zero_guess && (iSweep == 0)) {
+      AMG_Precondition(b, x, geometry, config);
+    }
+    else {
+      MatrixVectorProduct(x, AMG_Res, geometry, config);
+      for (iPoint = 0; iPoint < nPointDomain*nVar; iPoint++)
+        AMG_Res[iPoint] = b[iPoint] - AMG_Res[iPoint];
+      AMG_Precondition(AMG_Res, AMG_Aux, geometry, config);
+      x += AMG_Aux;
+    }
+
+  }
+
+}
+
+void CSysMatrix::AMG_Precondition(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+
+  switch (AMG_Smoother) {
+    case ILU:    ComputeILUPreconditioner(vec, prod, geometry, config); break;
+    case JACOBI: ComputeJacobiPreconditioner(vec, prod, geometry, config); break;
+    case LU_SGS: ComputeLU_SGSPreconditioner(vec, prod, geometry, config); break;
+  }
+
+}
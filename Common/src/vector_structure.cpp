@@ -418,3 +418,21 @@ su2double dotProd(const CSysVector & u, const CSysVector & v) {
   
   return prod;
 }
+
+su2double dotProdLocal(const CSysVector & u, const CSysVector & v) {
+  
+  /*--- check for consistent sizes ---*/
+  if (u.nElm != v.nElm) {
+    cerr << "CSysVector friend dotProdLocal(CSysVector, CSysVector): "
+    << "CSysVector sizes do not match";
+    throw(-1);
+  }
+  
+  /*--- local inner product only (nElemDomain), the sum over the processors
+   is left to the caller ---*/
+  su2double loc_prod = 0.0;
+  for (unsigned long i = 0; i < u.nElmDomain; i++)
+    loc_prod += u.vec_val[i]*v.vec_val[i];
+  
+  return loc_prod;
+}
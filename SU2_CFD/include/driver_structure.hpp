@@ -66,7 +66,8 @@ protected:
   unsigned short iMesh,                         /*!< \brief Iterator on mesh levels.*/
                 iZone,                          /*!< \brief Iterator on zones.*/
                 nZone,                          /*!< \brief Total number of zones in the problem. */
-                nDim;                           /*!< \brief Number of dimensions.*/
+                nDim,                           /*!< \brief Number of dimensions.*/
+                nThread;                        /*!< \brief Number of shared-memory threads of each MPI rank.*/
   bool StopCalc,                                /*!< \brief Stop computation flag.*/
        fsi;                                     /*!< \brief FSI simulation flag.*/
   CIteration **iteration_container;             /*!< \brief Container vector with all the iteration methods. */
@@ -75,6 +76,7 @@ protected:
   CGeometry ***geometry_container;              /*!< \brief Geometrical definition of the problem. */
   CSolver ****solver_container;                 /*!< \brief Container vector with all the solutions. */
   CNumerics *****numerics_container;            /*!< \brief Description of the numerical method (the way in which the equations are solved). */
+  CNumerics ******numerics_thread_container;    /*!< \brief Copies of the numerics for the additional threads of the hybrid MPI+threads mode. */
   CConfig **config_container;                   /*!< \brief Definition of the particular problem. */
   CSurfaceMovement **surface_movement;          /*!< \brief Surface movement classes of the problem. */
   CVolumetricMovement **grid_movement;          /*!< \brief Volume grid movement classes of the problem. */
@@ -550,5 +550,136 @@ public:
 
 
 
+/*!
+ * \derived class CLookUpTable
+ * \brief Child class for the look-up table model, the thermodynamic state of another
+ *        model is tabulated on a (rho, e) and a (P, T) grid and interpolated with bicubic
+ *        (Catmull-Rom) polynomials. The grids are uniform in (log(rho), e) and (log(P), T),
+ *        they are refined until the relative error at the centers of the cells is below the
+ *        tolerance, the cells that do not meet it (phase boundaries, invalid states) and
+ *        the states outside of the tables use the tabulated model.
+ * \version 5.0.0 "Raven"
+ */
+class CLookUpTable : public CFluidModel {
+
+protected:
+  CFluidModel *Base_Model;        /*!< \brief Tabulated model, it is used outside of the tables. */
+  su2double *Table[2];            /*!< \brief Thermodynamic states at the points of the (rho, e) and (P, T) tables. */
+  bool *Cell_Valid[2];            /*!< \brief Cells that are interpolated (meet the tolerance). */
+  unsigned long nPoints[2];       /*!< \brief Number of points per direction of the tables. */
+  su2double Coord_Min[2][2],      /*!< \brief Coordinates of the first point of the tables. */
+  Coord_Delta[2][2],              /*!< \brief Spacing of the points of the tables. */
+  Max_Error[2];                   /*!< \brief Relative error of the tables (at the centers of the valid cells). */
+
+private:
+
+  /*!
+   * \brief Set the state of the tabulated model at a point of a table.
+   * \param[in] iTable - 0 for the (rho, e) table, 1 for the (P, T) table.
+   * \param[in] x - log(rho) or log(P).
+   * \param[in] y - e or T.
+   */
+  void SetBase_State(unsigned short iTable, su2double x, su2double y);
+
+  /*!
+   * \brief Copy the state of the tabulated model.
+   * \param[out] val_state - Thermodynamic state, NULL to copy it to this model.
+   * \return <code>TRUE</code> if the state is physical (finite, positive pressure, temperature, density and speed of sound).
+   */
+  bool GetBase_State(su2double *val_state);
+
+  /*!
+   * \brief Fill a table between the given limits, the limits are extended by one cell for the cubic stencils.
+   * \param[in] iTable - 0 for the (rho, e) table, 1 for the (P, T) table.
+   * \param[in] Min - Lower limits of the coordinates.
+   * \param[in] Max - Upper limits of the coordinates.
+   * \param[in] val_nPoints - Number of points per direction.
+   */
+  void SetTable(unsigned short iTable, su2double *Min, su2double *Max, unsigned long val_nPoints);
+
+  /*!
+   * \brief Compare the table with the tabulated model at the centers of the cells, the cells
+   *        above the tolerance are not interpolated.
+   * \param[in] iTable - 0 for the (rho, e) table, 1 for the (P, T) table.
+   * \param[in] tolerance - Relative error bound.
+   * \return Maximum relative error of all the cells (also the ones above the tolerance).
+   */
+  su2double CheckTable(unsigned short iTable, su2double tolerance);
+
+  /*!
+   * \brief Interpolate the thermodynamic state.
+   * \param[in] iTable - 0 for the (rho, e) table, 1 for the (P, T) table.
+   * \param[in] x - log(rho) or log(P).
+   * \param[in] y - e or T.
+   * \param[out] val_state - Thermodynamic state, NULL to set it in this model.
+   * \return <code>FALSE</code> if the point is outside of the table or in a cell that is not interpolated.
+   */
+  bool Interpolate(unsigned short iTable, su2double x, su2double y, su2double *val_state);
+
+public:
+
+    /*!
+     * \brief Constructor of the class.
+     * \param[in] base_model - Dimensionless model that is tabulated, it is owned by the look-up table.
+     * \param[in] config - Definition of the particular problem.
+     */
+    CLookUpTable(CFluidModel *base_model, CConfig *config);
+
+    /*!
+     * \brief Destructor of the class.
+     */
+    virtual ~CLookUpTable(void);
+
+    /*!
+     * \brief Set the Dimensionless State using Density and Internal Energy (interpolated)
+     * \param[in] rho - first thermodynamic variable.
+     * \param[in] e - second thermodynamic variable.
+     */
+    void SetTDState_rhoe (su2double rho, su2double e );
+
+    /*!
+     * \brief Set the Dimensionless State using Pressure and Temperature (interpolated)
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] T - second thermodynamic variable.
+     */
+    void SetTDState_PT (su2double P, su2double T );
+
+    /*!
+     * \brief Set the Dimensionless State using Pressure and Density (tabulated model)
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] rho - second thermodynamic variable.
+     */
+    void SetTDState_Prho (su2double P, su2double rho );
+
+    /*!
+     * \brief Set the Dimensionless Energy using Pressure and Density (tabulated model)
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] rho - second thermodynamic variable.
+     */
+    void SetEnergy_Prho (su2double P, su2double rho );
+
+    /*!
+     * \brief Set the Dimensionless State using Enthalpy and Entropy (tabulated model)
+     * \param[in] h - first thermodynamic variable (h).
+     * \param[in] s - second thermodynamic variable (s).
+     */
+    void SetTDState_hs (su2double h, su2double s );
+
+    /*!
+     * \brief Set the Dimensionless State using Density and Temperature (tabulated model)
+     * \param[in] rho - first thermodynamic variable (rho).
+     * \param[in] T - second thermodynamic variable (T).
+     */
+    void SetTDState_rhoT (su2double rho, su2double T );
+
+    /*!
+     * \brief Set the Dimensionless State using Pressure and Entropy (tabulated model)
+     * \param[in] P - first thermodynamic variable (P).
+     * \param[in] s - second thermodynamic variable (s).
+     */
+    void SetTDState_Ps (su2double P, su2double s );
+
+};
+
 #include "fluid_model.inl"
 
@@ -117,6 +117,19 @@ public:
   void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config, 
               unsigned short iRKStep, unsigned short RunTime_EqSystem, unsigned long Iteration);
   
+  /*!
+   * \brief Do the implicit time integration with the Jacobian free Newton-Krylov method, the
+   *        products with the Jacobian are finite differences of the residual of the space integration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void Time_Integration_NewtonKrylov(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
+                                     unsigned short iMesh, unsigned short RunTime_EqSystem);
+  
   /*! 
    * \brief Do the time integration (explicit or implicit) of the numerical system on a FEM framework.
    * \author R. Sanchez
@@ -684,4 +697,59 @@ public:
 
 };
 
+/*!
+ * \class CNewtonKrylovProduct
+ * \brief Matrix free product with the Jacobian of the implicit system, by finite
+ *        differences of the full residual of the space integration (Jacobian free Newton-Krylov).
+ *
+ * The product is (V/dt) v + (R(U + eps v) - R(U)) / eps, where R is the residual of the
+ * second order space integration, whose residual R(U) must be in the solver when the product
+ * is constructed. The solution and the right hand side of the solver are restored after each product.
+ * \version 5.0.0 "Raven"
+ */
+class CNewtonKrylovProduct : public CMatrixVectorProduct {
+private:
+  CIntegration *integration;   /*!< \brief Integration that evaluates the residual. */
+  CGeometry *geometry;         /*!< \brief Geometrical definition of the problem. */
+  CSolver **solver_container;  /*!< \brief Container vector with all the solutions. */
+  CSolver *solver;             /*!< \brief Solver of the system. */
+  CNumerics **numerics;        /*!< \brief Description of the numerical method. */
+  CConfig *config;             /*!< \brief Definition of the particular problem. */
+  unsigned short iMesh,        /*!< \brief Index of the mesh. */
+  RunTime_EqSystem;            /*!< \brief System of equations which is solved. */
+  CSysVector *Residual_Base,   /*!< \brief Residual of the current solution. */
+  *Residual_Aux,               /*!< \brief Right hand side of the system while the residual is evaluated. */
+  *Solution_Base;              /*!< \brief Current solution. */
+  su2double Mean_Solution;     /*!< \brief Mean magnitude of the unknowns, to scale the step. */
+  unsigned long nUnknown;      /*!< \brief Total number of unknowns (all the ranks). */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] integration_ref - Integration that evaluates the residual.
+   * \param[in] geometry_ref - Geometrical definition of the problem.
+   * \param[in] solver_container_ref - Container vector with all the solutions.
+   * \param[in] numerics_ref - Description of the numerical method.
+   * \param[in] config_ref - Definition of the particular problem.
+   * \param[in] val_iMesh - Index of the mesh in multigrid computations.
+   * \param[in] val_RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  CNewtonKrylovProduct(CIntegration *integration_ref, CGeometry *geometry_ref, CSolver **solver_container_ref,
+                       CNumerics **numerics_ref, CConfig *config_ref, unsigned short val_iMesh,
+                       unsigned short val_RunTime_EqSystem);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CNewtonKrylovProduct(void);
+
+  /*!
+   * \brief Product with the Jacobian of the implicit system.
+   * \param[in] u - CSysVector that is being multiplied.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "integration_structure.inl"
@@ -46,8 +46,21 @@
 #include "../../Common/include/config_structure.hpp"
 #include "../../Common/include/gauss_structure.hpp"
 #include "../../Common/include/element_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 #include "variable_structure.hpp"
 
+/*--- The batched convective kernels (a few edges at once in SIMD lanes) are
+ only used with the plain double datatype, the AD and complex types keep the
+ edge by edge kernels. ---*/
+
+#if !defined COMPLEX_TYPE && \
+    !defined ADOLC_FORWARD_TYPE && \
+    !defined ADOLC_REVERSE_TYPE && \
+    !defined CODI_FORWARD_TYPE && \
+    !defined CODI_REVERSE_TYPE
+#define HAVE_BATCHED_NUMERICS
+#endif
+
 using namespace std;
 
 /*!
@@ -1067,6 +1080,61 @@ public:
                       su2double *val_soundspeed, su2double *val_normal,
                       su2double **val_invp_tensor);
 
+  /*!
+   * \brief Projected inviscid flux of a batch of EDGE_BATCH_SIZE edges (see GetInviscidProjFlux), the
+   *        values of the edges are interleaved, component k of edge l is at [k*EDGE_BATCH_SIZE+l].
+   * \param[in] val_density - Density of the edges.
+   * \param[in] val_velocity - Velocity of the edges.
+   * \param[in] val_pressure - Pressure of the edges.
+   * \param[in] val_enthalpy - Enthalpy of the edges.
+   * \param[in] val_normal - Normal vectors, the norm of the vectors is the area of the faces.
+   * \param[out] val_Proj_Flux - Projected fluxes of the edges.
+   */
+  template<unsigned short NDIM>
+  void GetInviscidProjFlux_Batch(const su2double *val_density, const su2double *val_velocity,
+                                 const su2double *val_pressure, const su2double *val_enthalpy,
+                                 const su2double *val_normal, su2double *val_Proj_Flux);
+
+  /*!
+   * \brief Projected inviscid Jacobian of a batch of EDGE_BATCH_SIZE edges (see GetInviscidProjJac),
+   *        entry (i,j) of edge l is at [(i*nVar+j)*EDGE_BATCH_SIZE+l].
+   * \param[in] val_velocity - Velocity of the edges.
+   * \param[in] val_energy - Energy of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[in] val_scale - Scale of the projection.
+   * \param[out] val_Proj_Jac_Tensor - Projected inviscid Jacobians of the edges.
+   */
+  template<unsigned short NDIM>
+  void GetInviscidProjJac_Batch(const su2double *val_velocity, const su2double *val_energy,
+                                const su2double *val_normal, su2double val_scale,
+                                su2double *val_Proj_Jac_Tensor);
+
+  /*!
+   * \brief Matrix P of a batch of EDGE_BATCH_SIZE edges (see GetPMatrix), interleaved as GetInviscidProjJac_Batch.
+   * \param[in] val_density - Density of the edges.
+   * \param[in] val_velocity - Velocity of the edges.
+   * \param[in] val_soundspeed - Sound speed of the edges.
+   * \param[in] val_normal - Unit normal vectors of the edges.
+   * \param[out] val_p_tensor - P matrices of the edges.
+   */
+  template<unsigned short NDIM>
+  void GetPMatrix_Batch(const su2double *val_density, const su2double *val_velocity,
+                        const su2double *val_soundspeed, const su2double *val_normal,
+                        su2double *val_p_tensor);
+
+  /*!
+   * \brief Matrix P^{-1} of a batch of EDGE_BATCH_SIZE edges (see GetPMatrix_inv), interleaved as GetInviscidProjJac_Batch.
+   * \param[in] val_density - Density of the edges.
+   * \param[in] val_velocity - Velocity of the edges.
+   * \param[in] val_soundspeed - Sound speed of the edges.
+   * \param[in] val_normal - Unit normal vectors of the edges.
+   * \param[out] val_invp_tensor - Inverse of the P matrices of the edges.
+   */
+  template<unsigned short NDIM>
+  void GetPMatrix_inv_Batch(const su2double *val_density, const su2double *val_velocity,
+                            const su2double *val_soundspeed, const su2double *val_normal,
+                            su2double *val_invp_tensor);
+
   /*!
    * \brief Computation of the matrix P^{-1} (artificial compresibility), this matrix diagonalize the conservative Jacobians
    *        in the form $P^{-1}(A.Normal)P=Lambda$.
@@ -1140,6 +1208,28 @@ public:
   virtual void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i,
                                su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Check if the numerics can compute the convective residual of a batch of edges.
+   * \return <code>TRUE</code> if ComputeResidual_Batch is implemented and can be used.
+   */
+  virtual bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the convective residual and Jacobians of a batch of EDGE_BATCH_SIZE edges at once.
+   *        The values of the edges are interleaved, component k of edge l is at [k*EDGE_BATCH_SIZE+l]
+   *        and entry (i,j) of the Jacobian of edge l is at [(i*nVar+j)*EDGE_BATCH_SIZE+l].
+   * \param[in] val_v_i - Primitive variables at the points i of the edges (the first nDim+4).
+   * \param[in] val_v_j - Primitive variables at the points j of the edges (the first nDim+4).
+   * \param[in] val_normal - Normal vectors of the edges, the norm of the vectors is the area of the faces.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                     su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                     CConfig *config);
+  
   /*!
    * \overload
    * \param[out] val_residual - Pointer to the total residual.
@@ -1473,6 +1563,22 @@ private:
   Density_j, Energy_j, SoundSpeed_j, Pressure_j, Enthalpy_j, R, RoeDensity, RoeEnthalpy, RoeSoundSpeed,
   ProjVelocity, ProjVelocity_i, ProjVelocity_j, RoeSoundSpeed2, kappa;
   unsigned short iDim, iVar, jVar, kVar;
+  bool batched;
+  
+  /*!
+   * \brief Batched Roe flux for a fixed number of dimensions, each step is vectorized over the edges of the batch.
+   * \param[in] val_v_i - Primitive variables at the points i of the edges.
+   * \param[in] val_v_j - Primitive variables at the points j of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short NDIM>
+  void ComputeBatch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                    su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                    CConfig *config);
   
 public:
   
@@ -1497,6 +1603,26 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Check if the Roe flux of a batch of edges can be computed at once (not with grid movement, nor with the AD and complex types).
+   * \return <code>TRUE</code> if ComputeResidual_Batch can be used.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the Roe flux of a batch of EDGE_BATCH_SIZE edges, see CNumerics::ComputeResidual_Batch for the layout.
+   * \param[in] val_v_i - Primitive variables at the points i of the edges.
+   * \param[in] val_v_j - Primitive variables at the points j of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                             su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                             CConfig *config);
 };
 
 
@@ -1825,6 +1951,22 @@ private:
   ProjVelocity, ProjVelocity_i, ProjVelocity_j;
   unsigned short iDim, iVar, jVar, kVar;
   su2double mL, mR, mLP, mRM, mF, pLP, pRM, pF, Phi;
+  bool batched;
+  
+  /*!
+   * \brief Batched AUSM flux for a fixed number of dimensions, each step is vectorized over the edges of the batch.
+   * \param[in] val_v_i - Primitive variables at the points i of the edges.
+   * \param[in] val_v_j - Primitive variables at the points j of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short NDIM>
+  void ComputeBatch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                    su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                    CConfig *config);
   
 public:
   
@@ -1849,6 +1991,26 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Check if the AUSM flux of a batch of edges can be computed at once (not with the AD and complex types).
+   * \return <code>TRUE</code> if ComputeResidual_Batch can be used.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the AUSM flux of a batch of EDGE_BATCH_SIZE edges, see CNumerics::ComputeResidual_Batch for the layout.
+   * \param[in] val_v_i - Primitive variables at the points i of the edges.
+   * \param[in] val_v_j - Primitive variables at the points j of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                             su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                             CConfig *config);
 };
 
 /*!
@@ -1876,6 +2038,32 @@ private:
   su2double Omega, RHO, OmegaSM;
   su2double *dSm_dU, *dPI_dU, *drhoStar_dU, *dpStar_dU, *dEStar_dU;
   
+  bool batched;
+  su2double **Batch_Jacobian_i, **Batch_Jacobian_j;
+  
+  /*!
+   * \brief Compute the Jacobians of the HLLC flux from the states of the edge (set by the computation of the flux).
+   * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i.
+   * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j.
+   */
+  void ComputeJacobian(su2double **val_Jacobian_i, su2double **val_Jacobian_j);
+  
+  /*!
+   * \brief Batched HLLC flux for a fixed number of dimensions, the flux is vectorized over the edges of
+   *        the batch, the Jacobians (one branch per wave configuration) are computed edge by edge.
+   * \param[in] val_v_i - Primitive variables at the points i of the edges.
+   * \param[in] val_v_j - Primitive variables at the points j of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short NDIM>
+  void ComputeBatch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                    su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                    CConfig *config);
+  
 public:
   
   /*!
@@ -1899,6 +2087,26 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Check if the HLLC flux of a batch of edges can be computed at once (not with grid movement, nor with the AD and complex types).
+   * \return <code>TRUE</code> if ComputeResidual_Batch can be used.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the HLLC flux of a batch of EDGE_BATCH_SIZE edges, see CNumerics::ComputeResidual_Batch for the layout.
+   * \param[in] val_v_i - Primitive variables at the points i of the edges.
+   * \param[in] val_v_j - Primitive variables at the points j of the edges.
+   * \param[in] val_normal - Normal vectors of the edges.
+   * \param[out] val_residual - Residuals of the edges.
+   * \param[out] val_Jacobian_i - Jacobians at the points i of the edges (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobians at the points j of the edges (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                             su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                             CConfig *config);
 
 };
 
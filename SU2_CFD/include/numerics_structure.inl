@@ -96,6 +96,12 @@ inline void CNumerics::ComputeResidual(su2double **val_Jacobian_i, su2double **v
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, 
                                    CConfig *config) { }
 
+inline bool CNumerics::GetBatched(void) { return false; }
+
+inline void CNumerics::ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                             su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                             CConfig *config) { }
+
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                                    su2double **val_JacobianMeanFlow_i, su2double **val_JacobianMeanFlow_j, CConfig *config) { }
 
@@ -450,3 +456,9 @@ inline void CNumerics::ComputeResidual(su2double **val_Jacobian_i, su2double *va
 
 inline void CNumerics::ComputeResidual(su2double **val_Jacobian_i, su2double *val_Jacobian_mui, su2double ***val_Jacobian_gradi, 
                   su2double **val_Jacobian_j, su2double *val_Jacobian_muj, su2double ***val_Jacobian_gradj, CConfig *config) { }
+
+inline bool CUpwRoe_Flow::GetBatched(void) { return batched; }
+
+inline bool CUpwAUSM_Flow::GetBatched(void) { return batched; }
+
+inline bool CUpwHLLC_Flow::GetBatched(void) { return batched; }
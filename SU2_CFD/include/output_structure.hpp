@@ -329,6 +329,15 @@ public:
    * \param[in] val_iZone - iZone index.
    */
   void SetRestart_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
+
+  /*!
+   * \brief Write a native SU2 restart file (binary) in parallel with collective MPI-IO.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Solver container of the zone.
+   * \param[in] val_iZone - iZone index.
+   */
+  void SetRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
   
   /*!
    * \brief Write the x, y, & z coordinates to a CGNS output file.
@@ -353,7 +362,17 @@ public:
    * \param[in] val_iZone - iZone index.
    */
   void SetCGNS_Solution(CConfig *config, CGeometry *geometry, unsigned short val_iZone);
-  
+
+  /*!
+   * \brief Write the coordinates, connectivity and solution data to a CGNS volume file in parallel,
+   *        each rank writes its slice of the linearly partitioned points and elements with ranged calls.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   */
+  void SetCGNS_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone);
+
   /*!
    * \brief Write a Paraview ASCII solution file.
    * \param[in] config - Definition of the particular problem.
@@ -372,6 +391,17 @@ public:
    */
   void SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool new_file);
 
+  /*!
+   * \brief Write the solution data and connectivity to Paraview XML files in parallel, each rank
+   *        writes its own piece (.vtu with appended binary data) and the master the list of pieces (.pvtu).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Flag controlling whether this is a volume or surface file.
+   */
+  void SetParaview_XML_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+
   /*!
    * \brief Write a Tecplot ASCII solution file.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -422,10 +452,10 @@ public:
   void SetSU2_MeshASCII(CConfig *config, CGeometry *geometry);
   
   /*!
-   * \brief Write the nodal coordinates and connectivity to a Tecplot binary mesh file.
+   * \brief Write the nodal coordinates, connectivity and markers to a binary SU2 mesh file,
+   *        with a header of the offsets of the sections and an index of the blocks of elements.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] val_iZone - iZone index.
    */
   void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry);
 
@@ -114,6 +114,10 @@ protected:
   
   unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
   
+  passivedouble *Restart_Data;       /*!< \brief Values of the restart file for the points of the rank, ordered by local index. */
+  unsigned short nRestart_Fields;    /*!< \brief Number of fields of the restart file (without the PointID). */
+  vector<string> Restart_Fields;     /*!< \brief Names of the fields of the restart file (with the PointID). */
+  
 public:
   
   CSysVector LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
@@ -461,6 +465,38 @@ public:
    */
   void Restart_OldGeometry(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Read a native SU2 restart file, in ASCII or binary format depending on the configuration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read a native SU2 restart file in ASCII format, keeping the values of the points of the rank in <i>Restart_Data</i>.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read a native SU2 restart file in binary format, each rank reads the records of its points with collective MPI-IO.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read the general flow conditions at the end of a restart file (angle of attack, sideslip, thrust and iteration).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, string val_filename);
+  
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -504,6 +540,13 @@ public:
   virtual void Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_thread - Index of the thread.
+   * \param[in] val_numerics - Copy of the numerics [term] for the thread.
+   */
+  virtual void SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics);
+  
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1299,6 +1342,15 @@ public:
    */
   virtual void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] mat_vec - Matrix free product with the Jacobian of the implicit system.
+   */
+  virtual void ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, CMatrixVectorProduct & mat_vec);
+  
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3840,6 +3892,31 @@ protected:
 
   CFluidModel  *FluidModel;  /*!< \brief fluid model used in the solver */
   
+  unsigned short nThread;         /*!< \brief Number of threads sharing the edge loops (hybrid MPI+threads mode). */
+  CNumerics ***ThreadNumerics;    /*!< \brief Copy of the numerics [thread][term], thread 0 uses the numerics of the driver. */
+  su2double **Thread_Vector_i,    /*!< \brief Auxiliary nDim vector of each thread (thread 0 uses Vector_i). */
+  **Thread_Vector_j,              /*!< \brief Auxiliary nDim vector of each thread (thread 0 uses Vector_j). */
+  **Thread_Primitive_i,           /*!< \brief Auxiliary nPrimVar vector of each thread (thread 0 uses Primitive_i). */
+  **Thread_Primitive_j,           /*!< \brief Auxiliary nPrimVar vector of each thread (thread 0 uses Primitive_j). */
+  **Thread_Secondary_i,           /*!< \brief Auxiliary nSecondaryVar vector of each thread (thread 0 uses Secondary_i). */
+  **Thread_Secondary_j,           /*!< \brief Auxiliary nSecondaryVar vector of each thread (thread 0 uses Secondary_j). */
+  **Thread_Residual,              /*!< \brief Auxiliary nVar vector of each thread (thread 0 uses Res_Conv). */
+  ***Thread_Jacobian_i,           /*!< \brief Auxiliary Jacobian of each thread (thread 0 uses Jacobian_i). */
+  ***Thread_Jacobian_j,           /*!< \brief Auxiliary Jacobian of each thread (thread 0 uses Jacobian_j). */
+  **Thread_Batch;                 /*!< \brief Interleaved primitives, normals, residuals and Jacobians of a batch of edges of each thread (batched convective numerics). */
+  
+  bool Overlap_MPI,               /*!< \brief The halo exchanges of the gradients and limiters are only posted, they are completed by Upwind_Residual. */
+  Pending_MPI_Gradient,           /*!< \brief Halo exchange of the gradients of the primitive variables in flight. */
+  Pending_MPI_Limiter;            /*!< \brief Halo exchange of the limiters of the primitive variables in flight. */
+  
+  su2double *Storage_Solution,    /*!< \brief Contiguous (point-major) block of the solution of all the points. */
+  *Storage_Solution_Old,          /*!< \brief Contiguous (point-major) block of the old solution of all the points. */
+  *Storage_Limiter,               /*!< \brief Contiguous (point-major) block of the limiter of all the points. */
+  *Storage_Primitive,             /*!< \brief Contiguous (point-major) block of the primitive variables of all the points. */
+  *Storage_Gradient_Primitive,    /*!< \brief Contiguous (point-major) block of the primitive gradients of all the points. */
+  *Storage_Limiter_Primitive,     /*!< \brief Contiguous (point-major) block of the primitive limiters of all the points. */
+  **Storage_Gradient_Rows;        /*!< \brief Row pointers of the primitive gradients of all the points. */
+  
   su2double **AveragedVelocity,
             **AveragedNormal,
             **AveragedGridVel,
@@ -3946,6 +4023,27 @@ public:
    */
   void Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Pack the limiters of the primitive variables of the send points and post the halo exchange.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Initiate_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Wait for the halo exchange of the limiters of the primitive variables and store them in the halo points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Complete the halo exchanges of the gradients and limiters that are in flight.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Overlap(CGeometry *geometry, CConfig *config);
+  
   //  /*!
   //   * \brief Impose the send-receive boundary condition.
   //   * \param[in] geometry - Geometrical definition of the problem.
@@ -4034,6 +4132,33 @@ public:
   void Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                          CConfig *config, unsigned short iMesh, unsigned short iRKStep);
   
+  /*!
+   * \brief Set the copy of the numerics used by an additional thread in the edge loops.
+   * \param[in] val_thread - Index of the thread.
+   * \param[in] val_numerics - Copy of the numerics [term] for the thread.
+   */
+  void SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics);
+  
+  /*!
+   * \brief Allocate the auxiliary vectors of the additional threads of the edge loops.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetThreadWorkspace(CConfig *config);
+  
+  /*!
+   * \brief Move the solution, primitive variables, gradients and limiters of all the points
+   *        to contiguous (point-major) blocks, one allocation per field.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetContiguous_Storage(CConfig *config);
+  
+  /*!
+   * \brief Check if the edge loops can be shared among the threads.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \return <code>TRUE</code> if there are colored edges and a copy of the numerics for each thread.
+   */
+  bool GetThreaded_EdgeLoop(CGeometry *geometry);
+  
   /*!
    * \brief Compute the spatial integration using a upwind scheme.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4159,6 +4284,20 @@ public:
    */
   void Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Pack the gradients of the primitive variables of the send points and post the halo exchange.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Initiate_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Wait for the halo exchange of the gradients of the primitive variables and store them in the halo points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the limiter of the primitive variables.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4828,6 +4967,25 @@ public:
    */
   void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config);
   
+  /*!
+   * \brief Update the solution using an implicit Euler scheme, with the matrix free
+   *        product of the Jacobian (Newton-Krylov) and the assembled Jacobian as preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] mat_vec - Matrix free product with the Jacobian of the implicit system.
+   */
+  void ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, CMatrixVectorProduct & mat_vec);
+  
+  /*!
+   * \brief Build and solve the implicit system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] mat_vec - Product with the Jacobian of the implicit system (NULL to use the assembled Jacobian).
+   */
+  void Implicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, CMatrixVectorProduct *mat_vec);
+  
   /*!
    * \brief Compute the pressure forces and all the adimensional coefficients.
    * \param[in] geometry - Geometrical definition of the problem.
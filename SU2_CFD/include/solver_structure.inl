@@ -35,6 +35,8 @@
 
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+inline void CSolver::SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics) { }
+
 inline void CSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) { }
 
 inline void CSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) { }
@@ -853,6 +855,9 @@ inline void CSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
 
 inline void CSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) { }
 
+inline void CSolver::ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, CMatrixVectorProduct & mat_vec) {
+  ImplicitEuler_Iteration(geometry, solver_container, config); }
+
 inline void CSolver::ImplicitNewmark_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) { }
 
 inline void CSolver::ImplicitNewmark_Update(CGeometry *geometry, CSolver **solver_container, CConfig *config) { }
@@ -990,6 +995,10 @@ inline su2double CEulerSolver::GetModVelocity_Inf(void) {
 
 inline CFluidModel* CEulerSolver::GetFluidModel(void) { return FluidModel;}
 
+inline void CEulerSolver::SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics) { ThreadNumerics[val_thread] = val_numerics; }
+
+inline bool CEulerSolver::GetThreaded_EdgeLoop(CGeometry *geometry) { return ((nThread > 1) && (geometry->GetnEdgeColor() > 0) && (ThreadNumerics[nThread-1] != NULL)); }
+
 inline su2double CEulerSolver::GetDensity_Energy_Inf(void) { return Density_Inf*Energy_Inf; }
 
 inline su2double CEulerSolver::GetDensity_Velocity_Inf(unsigned short val_dim) { return Density_Inf*Velocity_Inf[val_dim]; }
@@ -77,6 +77,7 @@ protected:
   su2double *Res_TruncError,  /*!< \brief Truncation error for multigrid cycle. */
   *Residual_Old,    /*!< \brief Auxiliar structure for residual smoothing. */
   *Residual_Sum;    /*!< \brief Auxiliar structure for residual smoothing. */
+  bool Contiguous_Solution;  /*!< \brief Solution, Solution_Old and Limiter are stored in contiguous blocks owned by the solver. */
   static unsigned short nDim;    /*!< \brief Number of dimension of the problem. */
   unsigned short nVar;    /*!< \brief Number of variables of the problem,
                            note that this variable cannnot be static, it is possible to
@@ -115,6 +116,24 @@ public:
    */
   virtual ~CVariable(void);
   
+  /*!
+   * \brief Move the solution, old solution and limiter of the point to the contiguous
+   *        (point-major) blocks of the solver. The values are copied and the arrays of
+   *        the point are released, from then on the solver owns the storage.
+   * \param[in] val_solution - Position of the point in the solution block (nVar values).
+   * \param[in] val_solution_old - Position of the point in the old solution block (nVar values).
+   * \param[in] val_limiter - Position of the point in the limiter block (nVar values).
+   */
+  void SetContiguous_Solution(su2double *val_solution, su2double *val_solution_old, su2double *val_limiter);
+  
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_primitive - Position of the point in the primitive variable block.
+   * \param[in] val_gradient - Row pointers of the point in the primitive gradient block.
+   * \param[in] val_limiter - Position of the point in the primitive limiter block.
+   */
+  virtual void SetContiguous_Primitive(su2double *val_primitive, su2double **val_gradient, su2double *val_limiter);
+  
   /*!
    * \brief Set the value of the solution.
    * \param[in] val_solution - Solution of the problem.
@@ -2657,6 +2676,8 @@ protected:
   su2double **Gradient_Secondary;  /*!< \brief Gradient of the primitive variables (T, vx, vy, vz, P, rho). */
   su2double *Limiter_Secondary;   /*!< \brief Limiter of the primitive variables (T, vx, vy, vz, P, rho). */
   
+  bool Contiguous_Primitive;  /*!< \brief Primitive, Gradient_Primitive and Limiter_Primitive are stored in contiguous blocks owned by the solver. */
+  
 public:
   
   /*!
@@ -2690,6 +2711,15 @@ public:
    */
   virtual ~CEulerVariable(void);
   
+  /*!
+   * \brief Move the primitive variables, their gradient and their limiter to the
+   *        contiguous (point-major) blocks of the solver.
+   * \param[in] val_primitive - Position of the point in the primitive variable block (nPrimVar values).
+   * \param[in] val_gradient - Row pointers of the point (nPrimVarGrad rows of nDim values) in the gradient block.
+   * \param[in] val_limiter - Position of the point in the primitive limiter block (nPrimVarGrad values).
+   */
+  void SetContiguous_Primitive(su2double *val_primitive, su2double **val_gradient, su2double *val_limiter);
+  
   /*!
    * \brief Set to zero the gradient of the primitive variables.
    */
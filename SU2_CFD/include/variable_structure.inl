@@ -455,6 +455,8 @@ inline su2double **CVariable::GetGradient_Primitive(void) { return NULL; }
 
 inline su2double *CVariable::GetLimiter_Primitive(void) { return NULL; }
 
+inline void CVariable::SetContiguous_Primitive(su2double *val_primitive, su2double **val_gradient, su2double *val_limiter) { }
+
 inline void CVariable::SetGradient_SecondaryZero(unsigned short val_secondaryvar) { }
 
 inline void CVariable::AddGradient_Secondary(unsigned short val_var, unsigned short val_dim, su2double val_value) { }
@@ -37,10 +37,10 @@
 CDriver::CDriver(char* confFile,
                  unsigned short val_nZone,
                  unsigned short val_nDim,
-                 SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), nDim(val_nDim), StopCalc(false), fsi(false) {
+                 SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), nDim(val_nDim), nThread(SU2_OMP_GetMaxThreads()), StopCalc(false), fsi(false) {
 
 
-  unsigned short jZone, iSol;
+  unsigned short jZone, iSol, iThread;
 
   int rank = MASTER_NODE;
 #ifdef HAVE_MPI
@@ -58,6 +58,7 @@ CDriver::CDriver(char* confFile,
   geometry_container            = NULL;
   solver_container              = NULL;
   numerics_container            = NULL;
+  numerics_thread_container     = NULL;
   config_container              = NULL;
   surface_movement              = NULL;
   grid_movement                 = NULL;
@@ -71,6 +72,7 @@ CDriver::CDriver(char* confFile,
   solver_container       = new CSolver***[nZone];
   integration_container  = new CIntegration**[nZone];
   numerics_container     = new CNumerics****[nZone];
+  numerics_thread_container = new CNumerics*****[nZone];
   config_container       = new CConfig*[nZone];
   geometry_container     = new CGeometry**[nZone];
   surface_movement       = new CSurfaceMovement*[nZone];
@@ -83,6 +85,7 @@ CDriver::CDriver(char* confFile,
     solver_container[iZone]       = NULL;
     integration_container[iZone]  = NULL;
     numerics_container[iZone]     = NULL;
+    numerics_thread_container[iZone] = NULL;
     config_container[iZone]       = NULL;
     geometry_container[iZone]     = NULL;
     surface_movement[iZone]       = NULL;
@@ -264,6 +267,24 @@ CDriver::CDriver(char* confFile,
 
     if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
 
+    /*--- In the hybrid MPI+threads mode, the edge loops of the flow solver are
+     shared among the threads. The numerics classes store the states of the edge
+     internally, so each additional thread gets its own copy of them. ---*/
+
+    if (nThread > 1) {
+      numerics_thread_container[iZone] = new CNumerics****[nThread-1];
+      for (iThread = 1; iThread < nThread; iThread++) {
+        numerics_thread_container[iZone][iThread-1] = new CNumerics***[config_container[iZone]->GetnMGLevels()+1];
+        Numerics_Preprocessing(numerics_thread_container[iZone][iThread-1], solver_container[iZone],
+                               geometry_container[iZone], config_container[iZone]);
+        for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+          if (solver_container[iZone][iMesh][FLOW_SOL] != NULL)
+            solver_container[iZone][iMesh][FLOW_SOL]->SetThreadNumerics(iThread, numerics_thread_container[iZone][iThread-1][iMesh][FLOW_SOL]);
+        }
+      }
+      if (rank == MASTER_NODE) cout << "Numerics Preprocessing for " << nThread << " threads per rank." << endl;
+    }
+
   }
 
   /*--- Definition of the interface and transfer conditions between different zones.
@@ -413,8 +434,17 @@ void CDriver::Postprocessing() {
      Numerics_Postprocessing(numerics_container[iZone], solver_container[iZone],
      geometry_container[iZone], config_container[iZone]);
     delete [] numerics_container[iZone];
+    if (numerics_thread_container[iZone] != NULL) {
+      for (unsigned short iThread = 1; iThread < nThread; iThread++) {
+        Numerics_Postprocessing(numerics_thread_container[iZone][iThread-1], solver_container[iZone],
+                                geometry_container[iZone], config_container[iZone]);
+        delete [] numerics_thread_container[iZone][iThread-1];
+      }
+      delete [] numerics_thread_container[iZone];
+    }
   }
   delete [] numerics_container;
+  delete [] numerics_thread_container;
   if (rank == MASTER_NODE) cout << "Deleted CNumerics container." << endl;
   
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -550,10 +580,15 @@ void CDriver::Geometrical_Preprocessing() {
     if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
     geometry_container[iZone][MESH_0]->SetPoint_Connectivity();
 
-    /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+    /*--- Renumbering points using Reverse Cuthill McKee or Hilbert curve ordering ---*/
 
-    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-    geometry_container[iZone][MESH_0]->SetRCM_Ordering(config_container[iZone]);
+    if (rank == MASTER_NODE) {
+      switch (config_container[iZone]->GetKind_Point_Ordering()) {
+        case RCM_ORDERING:     cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl; break;
+        case HILBERT_ORDERING: cout << "Renumbering points (Hilbert Curve Ordering)." << endl; break;
+      }
+    }
+    geometry_container[iZone][MESH_0]->SetPoint_Ordering(config_container[iZone]);
 
     /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -578,6 +613,13 @@ void CDriver::Geometrical_Preprocessing() {
     geometry_container[iZone][MESH_0]->SetEdges();
     geometry_container[iZone][MESH_0]->SetVertex(config_container[iZone]);
 
+    /*--- Group the edges in colors for the threaded edge loops ---*/
+
+    if (nThread > 1) {
+      if (rank == MASTER_NODE) cout << "Coloring the edges for " << nThread << " threads per rank." << endl;
+      geometry_container[iZone][MESH_0]->SetEdgeColoring();
+    }
+
     /*--- Compute cell center of gravity ---*/
 
     if (rank == MASTER_NODE) cout << "Computing centers of gravity." << endl;
@@ -635,6 +677,7 @@ void CDriver::Geometrical_Preprocessing() {
 
       geometry_container[iZone][iMGlevel]->SetEdges();
       geometry_container[iZone][iMGlevel]->SetVertex(geometry_container[iZone][iMGlevel-1], config_container[iZone]);
+      if (nThread > 1) geometry_container[iZone][iMGlevel]->SetEdgeColoring();
 
       /*--- Create the control volume structures ---*/
 
@@ -2450,8 +2493,22 @@ void CDriver::StartSolver() {
     historyFile_FSI.close();
   }
 
+  /*--- Time spent by this rank in the iterations, without the waits for the
+   other ranks, used to measure the balance of the partitioning. ---*/
+
+  su2double Compute_Time = 0.0;
+#ifdef HAVE_MPI
+  double StartTime = 0.0, StartWait = 0.0;
+#endif
+  unsigned long Profile_Iter = config_container[ZONE_0]->GetPartition_Profile_Iter();
+
   while ( ExtIter < config_container[ZONE_0]->GetnExtIter() ) {
 
+#ifdef HAVE_MPI
+    StartTime = MPI_Wtime();
+    StartWait = SU2_MPI::GetWait_Time();
+#endif
+
     /*--- Perform some external iteration preprocessing. ---*/
 
     PreprocessExtIter(ExtIter);
@@ -2477,6 +2534,16 @@ void CDriver::StartSolver() {
       Run();      // In the FSIDriver case, mesh and solution updates are already included into the Run function
     }
 
+#ifdef HAVE_MPI
+    Compute_Time += (MPI_Wtime() - StartTime) - (SU2_MPI::GetWait_Time() - StartWait);
+#endif
+
+    /*--- Write the partition profile, the measured cost of each rank is used
+     to weight the partitioning of the next run (single zone problems). ---*/
+
+    if ((nZone == 1) && (ExtIter+1 == Profile_Iter))
+      geometry_container[ZONE_0][MESH_0]->SetPartition_Profile(config_container[ZONE_0], Compute_Time);
+
     /*--- Monitor the computations after each iteration. ---*/
 
     Monitor(ExtIter);
@@ -0,0 +1,387 @@
+/*!
+ * fluid_model_lut.cpp
+ * \brief Source of the look-up table model.
+ * \author SU2 Developers
+ * \version 5.0.0 "Raven"
+ *
+ * SU2 Lead Developers: Dr. Francisco Palacios (Francisco.D.Palacios@boeing.com).
+ *                      Dr. Thomas D. Economon (economon@stanford.edu).
+ *
+ * SU2 Developers: Prof. Juan J. Alonso's group at Stanford University.
+ *                 Prof. Piero Colonna's group at Delft University of Technology.
+ *                 Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *                 Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *                 Prof. Rafael Palacios' group at Imperial College London.
+ *                 Prof. Edwin van der Weide's group at the University of Twente.
+ *                 Prof. Vincent Terrapon's group at the University of Liege.
+ *
+ * Copyright (C) 2012-2017 SU2, the open-source CFD code.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/fluid_model.hpp"
+
+/*--- Variables of the tabulated state ---*/
+
+enum LUT_STATE {
+  LUT_DENSITY = 0, LUT_ENERGY = 1, LUT_PRESSURE = 2, LUT_TEMPERATURE = 3,
+  LUT_ENTROPY = 4, LUT_SOUNDSPEED2 = 5, LUT_DPDRHO_E = 6, LUT_DPDE_RHO = 7,
+  LUT_DTDRHO_E = 8, LUT_DTDE_RHO = 9, LUT_CP = 10, LUT_NSTATE = 11
+};
+
+/*--- Inputs of the (rho, e) and (P, T) tables, they are not checked ---*/
+
+static const unsigned short LUT_Input[2][2] = {{LUT_DENSITY, LUT_ENERGY}, {LUT_PRESSURE, LUT_TEMPERATURE}};
+
+CLookUpTable::CLookUpTable(CFluidModel *base_model, CConfig *config) : CFluidModel() {
+
+  unsigned short iTable;
+  unsigned long iPoint, jPoint, nSample = 33, nTable;
+  su2double Min[2][2], Max[2][2], Margin, x, y, State[LUT_NSTATE], Error[2],
+  tolerance = config->GetLUT_Tolerance();
+  unsigned long max_points = config->GetLUT_MaxPoints();
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  Base_Model = base_model; cerr << "DBG ctor" << endl;
+
+  for (iTable = 0; iTable < 2; iTable++) {
+    Table[iTable] = NULL; Cell_Valid[iTable] = NULL;
+    nPoints[iTable] = 0; Max_Error[iTable] = 0.0;
+  }
+
+  /*--- (P, T) limits, dimensionless ---*/
+
+  Min[1][0] = log(config->GetLUT_Pressure_Limits(0)/config->GetPressure_Ref());
+  Max[1][0] = log(config->GetLUT_Pressure_Limits(1)/config->GetPressure_Ref());
+  Min[1][1] = config->GetLUT_Temperature_Limits(0)/config->GetTemperature_Ref();
+  Max[1][1] = config->GetLUT_Temperature_Limits(1)/config->GetTemperature_Ref();
+
+  /*--- (rho, e) limits, range of the states of the (P, T) limits, with a margin ---*/
+
+  Min[0][0] = Min[0][1] = 1E300; Max[0][0] = Max[0][1] = -1E300;
+
+  for (iPoint = 0; iPoint < nSample; iPoint++) {
+    for (jPoint = 0; jPoint < nSample; jPoint++) {
+      x = Min[1][0] + (Max[1][0]-Min[1][0])*su2double(iPoint)/su2double(nSample-1);
+      y = Min[1][1] + (Max[1][1]-Min[1][1])*su2double(jPoint)/su2double(nSample-1);
+      SetBase_State(1, x, y);
+      if (!GetBase_State(State)) continue;
+      Min[0][0] = min(Min[0][0], log(State[LUT_DENSITY]));  Max[0][0] = max(Max[0][0], log(State[LUT_DENSITY]));
+      Min[0][1] = min(Min[0][1], State[LUT_ENERGY]);        Max[0][1] = max(Max[0][1], State[LUT_ENERGY]);
+    }
+  }
+
+  if (Max[0][0] < Min[0][0]) {
+    cout << "The look-up table limits do not contain physical states of the tabulated fluid model." << endl;
+    exit(EXIT_FAILURE);
+  }
+
+  cerr << "DBG range " << Min[0][0] << " " << Max[0][0] << " " << Min[0][1] << " " << Max[0][1] << endl;
+  Margin = 0.05*(Max[0][0]-Min[0][0]); Min[0][0] -= Margin; Max[0][0] += Margin;
+  Margin = 0.05*(Max[0][1]-Min[0][1]); Min[0][1] -= Margin; Max[0][1] += Margin;
+
+  /*--- Build the tables, the number of points is doubled until the error
+   at the centers of the cells is below the tolerance (or the maximum is
+   reached), the cells above the tolerance are not interpolated. ---*/
+
+  for (iTable = 0; iTable < 2; iTable++) {
+    nTable = min(nSample, max_points);
+    while (true) {
+      cerr << "DBG table " << iTable << " " << nTable << endl;
+      SetTable(iTable, Min[iTable], Max[iTable], nTable);
+      cerr << "DBG check" << endl;
+      Error[iTable] = CheckTable(iTable, tolerance);
+      if (Error[iTable] <= tolerance || 2*nTable-1 > max_points) break;
+      nTable = 2*nTable-1;
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Look-up tables (rho, e) and (P, T): " << nPoints[0] << "x" << nPoints[0] << " and ";
+    cout << nPoints[1] << "x" << nPoints[1] << " points, interpolation error " << Max_Error[0] << " and " << Max_Error[1];
+    cout << " (" << Error[0] << " and " << Error[1] << " in the cells that use the tabulated model)." << endl;
+  }
+
+}
+
+CLookUpTable::~CLookUpTable(void) {
+
+  unsigned short iTable;
+
+  for (iTable = 0; iTable < 2; iTable++) {
+    if (Table[iTable] != NULL) delete [] Table[iTable];
+    if (Cell_Valid[iTable] != NULL) delete [] Cell_Valid[iTable];
+  }
+  if (Base_Model != NULL) delete Base_Model;
+
+}
+
+void CLookUpTable::SetBase_State(unsigned short iTable, su2double x, su2double y) {
+
+  if (iTable == 0) Base_Model->SetTDState_rhoe(exp(x), y);
+  else Base_Model->SetTDState_PT(exp(x), y);
+
+}
+
+bool CLookUpTable::GetBase_State(su2double *val_state) {
+
+  unsigned short iState;
+  su2double State[LUT_NSTATE];
+  bool physical = true;
+
+  State[LUT_DENSITY]     = Base_Model->GetDensity();
+  State[LUT_ENERGY]      = Base_Model->GetStaticEnergy();
+  State[LUT_PRESSURE]    = Base_Model->GetPressure();
+  State[LUT_TEMPERATURE] = Base_Model->GetTemperature();
+  State[LUT_ENTROPY]     = Base_Model->GetEntropy();
+  State[LUT_SOUNDSPEED2] = Base_Model->GetSoundSpeed2();
+  State[LUT_DPDRHO_E]    = Base_Model->GetdPdrho_e();
+  State[LUT_DPDE_RHO]    = Base_Model->GetdPde_rho();
+  State[LUT_DTDRHO_E]    = Base_Model->GetdTdrho_e();
+  State[LUT_DTDE_RHO]    = Base_Model->GetdTde_rho();
+  State[LUT_CP]          = Base_Model->GetCp();
+
+  for (iState = 0; iState < LUT_NSTATE; iState++)
+    physical = physical && (fabs(State[iState]) <= 1E300);
+  physical = physical && (State[LUT_DENSITY] > 0.0) && (State[LUT_PRESSURE] > 0.0) &&
+             (State[LUT_TEMPERATURE] > 0.0) && (State[LUT_SOUNDSPEED2] > 0.0);
+
+  if (val_state == NULL) {
+    Density      = State[LUT_DENSITY];      StaticEnergy = State[LUT_ENERGY];
+    Pressure     = State[LUT_PRESSURE];     Temperature  = State[LUT_TEMPERATURE];
+    Entropy      = State[LUT_ENTROPY];      SoundSpeed2  = State[LUT_SOUNDSPEED2];
+    dPdrho_e     = State[LUT_DPDRHO_E];     dPde_rho     = State[LUT_DPDE_RHO];
+    dTdrho_e     = State[LUT_DTDRHO_E];     dTde_rho     = State[LUT_DTDE_RHO];
+    Cp           = State[LUT_CP];
+  }
+  else {
+    for (iState = 0; iState < LUT_NSTATE; iState++) val_state[iState] = State[iState];
+  }
+
+  return physical;
+
+}
+
+void CLookUpTable::SetTable(unsigned short iTable, su2double *Min, su2double *Max, unsigned long val_nPoints) {
+
+  unsigned long iPoint, jPoint, iCell, jCell, nCell = val_nPoints-1;
+  unsigned short iStencil, jStencil;
+  bool *Point_Valid = new bool [val_nPoints*val_nPoints], valid;
+
+  nPoints[iTable] = val_nPoints;
+
+  /*--- The first and last cells are only used by the cubic stencils ---*/
+
+  for (unsigned short iDim = 0; iDim < 2; iDim++) {
+    Coord_Delta[iTable][iDim] = (Max[iDim]-Min[iDim])/su2double(val_nPoints-3);
+    Coord_Min[iTable][iDim] = Min[iDim]-Coord_Delta[iTable][iDim];
+  }
+
+  if (Table[iTable] != NULL) delete [] Table[iTable];
+  if (Cell_Valid[iTable] != NULL) delete [] Cell_Valid[iTable];
+  Table[iTable] = new su2double [val_nPoints*val_nPoints*LUT_NSTATE];
+  Cell_Valid[iTable] = new bool [nCell*nCell];
+
+  /*--- States of the tabulated model, along lines of constant x
+   (the iterative models start from the previous state) ---*/
+
+  for (iPoint = 0; iPoint < val_nPoints; iPoint++)
+    for (jPoint = 0; jPoint < val_nPoints; jPoint++) {
+      SetBase_State(iTable, Coord_Min[iTable][0]+su2double(iPoint)*Coord_Delta[iTable][0],
+                    Coord_Min[iTable][1]+su2double(jPoint)*Coord_Delta[iTable][1]);
+      Point_Valid[iPoint*val_nPoints+jPoint] = GetBase_State(&Table[iTable][(iPoint*val_nPoints+jPoint)*LUT_NSTATE]);
+    }
+
+  /*--- A cell can be interpolated if the points of its stencil are physical ---*/
+
+  for (iCell = 0; iCell < nCell; iCell++)
+    for (jCell = 0; jCell < nCell; jCell++) {
+      valid = (iCell >= 1 && iCell+2 < val_nPoints && jCell >= 1 && jCell+2 < val_nPoints);
+      for (iStencil = 0; iStencil < 4 && valid; iStencil++)
+        for (jStencil = 0; jStencil < 4 && valid; jStencil++)
+          valid = Point_Valid[(iCell+iStencil-1)*val_nPoints+jCell+jStencil-1];
+      Cell_Valid[iTable][iCell*nCell+jCell] = valid;
+    }
+
+  delete [] Point_Valid;
+
+}
+
+su2double CLookUpTable::CheckTable(unsigned short iTable, su2double tolerance) {
+
+  unsigned long iPoint, iCell, jCell, nPoint = nPoints[iTable]*nPoints[iTable], nCell = nPoints[iTable]-1;
+  unsigned short iState;
+  su2double Scale[LUT_NSTATE], State[LUT_NSTATE], Exact[LUT_NSTATE], x, y, Error, Max_Error_All = 0.0;
+  su2double *Values = Table[iTable];
+
+  /*--- The error of each variable is relative to its maximum magnitude in the table ---*/
+
+  for (iState = 0; iState < LUT_NSTATE; iState++) Scale[iState] = 0.0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iState = 0; iState < LUT_NSTATE; iState++)
+      if (fabs(Values[iPoint*LUT_NSTATE+iState]) <= 1E300)
+        Scale[iState] = max(Scale[iState], fabs(Values[iPoint*LUT_NSTATE+iState]));
+  for (iState = 0; iState < LUT_NSTATE; iState++)
+    if (Scale[iState] == 0.0) Scale[iState] = 1.0;
+
+  Max_Error[iTable] = 0.0;
+
+  for (iCell = 0; iCell < nCell; iCell++)
+    for (jCell = 0; jCell < nCell; jCell++) {
+
+      /*--- Center of the cell ---*/
+
+      x = Coord_Min[iTable][0]+(su2double(iCell)+0.5)*Coord_Delta[iTable][0];
+      y = Coord_Min[iTable][1]+(su2double(jCell)+0.5)*Coord_Delta[iTable][1];
+
+      if (!Interpolate(iTable, x, y, State)) continue;
+
+      SetBase_State(iTable, x, y);
+      if (GetBase_State(Exact)) {
+        Error = 0.0;
+        for (iState = 0; iState < LUT_NSTATE; iState++)
+          if (iState != LUT_Input[iTable][0] && iState != LUT_Input[iTable][1])
+            Error = max(Error, fabs(State[iState]-Exact[iState])/Scale[iState]);
+      }
+      else Error = 1E300;
+
+      Max_Error_All = max(Max_Error_All, Error);
+
+      if (Error > tolerance) Cell_Valid[iTable][iCell*nCell+jCell] = false;
+      else Max_Error[iTable] = max(Max_Error[iTable], Error);
+
+    }
+
+  return Max_Error_All;
+
+}
+
+bool CLookUpTable::Interpolate(unsigned short iTable, su2double x, su2double y, su2double *val_state) {
+
+  unsigned long n = nPoints[iTable], iCell, jCell;
+  unsigned short iStencil, jStencil, iState;
+  su2double fx, fy, tx, ty, Weight_x[4], Weight_y[4], Weight, State[LUT_NSTATE], *Values;
+
+  /*--- Cell of the point, the cells at the boundary are only used by the stencils ---*/
+
+  fx = (x-Coord_Min[iTable][0])/Coord_Delta[iTable][0];
+  fy = (y-Coord_Min[iTable][1])/Coord_Delta[iTable][1];
+
+  if (!(fx >= 1.0 && fx < su2double(n-2) && fy >= 1.0 && fy < su2double(n-2))) return false;
+
+  iCell = (unsigned long)(SU2_TYPE::Int(fx)); jCell = (unsigned long)(SU2_TYPE::Int(fy));
+  if (!Cell_Valid[iTable][iCell*(n-1)+jCell]) return false;
+
+  /*--- Catmull-Rom weights of the 4 points of the stencil in each direction ---*/
+
+  tx = fx-su2double(iCell); ty = fy-su2double(jCell);
+
+  Weight_x[0] = 0.5*tx*(tx*(2.0-tx)-1.0);   Weight_y[0] = 0.5*ty*(ty*(2.0-ty)-1.0);
+  Weight_x[1] = 0.5*(tx*tx*(3.0*tx-5.0)+2.0); Weight_y[1] = 0.5*(ty*ty*(3.0*ty-5.0)+2.0);
+  Weight_x[2] = 0.5*tx*(tx*(4.0-3.0*tx)+1.0); Weight_y[2] = 0.5*ty*(ty*(4.0-3.0*ty)+1.0);
+  Weight_x[3] = 0.5*tx*tx*(tx-1.0);          Weight_y[3] = 0.5*ty*ty*(ty-1.0);
+
+  for (iState = 0; iState < LUT_NSTATE; iState++) State[iState] = 0.0;
+
+  for (iStencil = 0; iStencil < 4; iStencil++)
+    for (jStencil = 0; jStencil < 4; jStencil++) {
+      Weight = Weight_x[iStencil]*Weight_y[jStencil];
+      Values = &Table[iTable][((iCell+iStencil-1)*n+jCell+jStencil-1)*LUT_NSTATE];
+      for (iState = 0; iState < LUT_NSTATE; iState++)
+        State[iState] += Weight*Values[iState];
+    }
+
+  if (val_state != NULL) {
+    for (iState = 0; iState < LUT_NSTATE; iState++) val_state[iState] = State[iState];
+    return true;
+  }
+
+  /*--- Set the state, the inputs are set by the caller ---*/
+
+  if (iTable == 0) { Pressure = State[LUT_PRESSURE]; Temperature = State[LUT_TEMPERATURE]; }
+  else { Density = State[LUT_DENSITY]; StaticEnergy = State[LUT_ENERGY]; }
+
+  Entropy  = State[LUT_ENTROPY];  SoundSpeed2 = State[LUT_SOUNDSPEED2];
+  dPdrho_e = State[LUT_DPDRHO_E]; dPde_rho    = State[LUT_DPDE_RHO];
+  dTdrho_e = State[LUT_DTDRHO_E]; dTde_rho    = State[LUT_DTDE_RHO];
+  Cp       = State[LUT_CP];
+
+  return true;
+
+}
+
+void CLookUpTable::SetTDState_rhoe (su2double rho, su2double e ) {
+
+  if (rho > 0.0 && Interpolate(0, log(rho), e, NULL)) {
+    Density = rho; StaticEnergy = e;
+  }
+  else {
+    Base_Model->SetTDState_rhoe(rho, e);
+    GetBase_State(NULL);
+  }
+
+}
+
+void CLookUpTable::SetTDState_PT (su2double P, su2double T ) {
+
+  if (P > 0.0 && Interpolate(1, log(P), T, NULL)) {
+    Pressure = P; Temperature = T;
+  }
+  else {
+    Base_Model->SetTDState_PT(P, T);
+    GetBase_State(NULL);
+  }
+
+}
+
+void CLookUpTable::SetTDState_Prho (su2double P, su2double rho ) {
+
+  Base_Model->SetTDState_Prho(P, rho);
+  GetBase_State(NULL);
+
+}
+
+void CLookUpTable::SetEnergy_Prho (su2double P, su2double rho ) {
+
+  Base_Model->SetEnergy_Prho(P, rho);
+  StaticEnergy = Base_Model->GetStaticEnergy();
+
+}
+
+void CLookUpTable::SetTDState_hs (su2double h, su2double s ) {
+
+  Base_Model->SetTDState_hs(h, s);
+  GetBase_State(NULL);
+
+}
+
+void CLookUpTable::SetTDState_rhoT (su2double rho, su2double T ) {
+
+  Base_Model->SetTDState_rhoT(rho, T);
+  GetBase_State(NULL);
+
+}
+
+void CLookUpTable::SetTDState_Ps (su2double P, su2double s ) {
+
+  Base_Model->SetTDState_Ps(P, s);
+  GetBase_State(NULL);
+
+}
@@ -356,6 +356,21 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+void CIntegration::Time_Integration_NewtonKrylov(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
+                                                 unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  
+  unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  
+  /*--- The residual of the current solution must be in the solver, the product
+   with the Jacobian is built around it, and the assembled Jacobian (first order)
+   is the preconditioner of the linear system ---*/
+  
+  CNewtonKrylovProduct mat_vec(this, geometry, solver_container, numerics, config, iMesh, RunTime_EqSystem);
+  
+  solver_container[MainSolver]->ImplicitNewtonKrylov_Iteration(geometry, solver_container, config, mat_vec);
+  
+}
+
 void CIntegration::Time_Integration_FEM(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
                                     unsigned short RunTime_EqSystem, unsigned long Iteration) {
 
@@ -996,3 +1011,136 @@ void CIntegration::Convergence_Monitoring_FSI(CGeometry *fea_geometry, CConfig *
   }
   
 }
+
+CNewtonKrylovProduct::CNewtonKrylovProduct(CIntegration *integration_ref, CGeometry *geometry_ref, CSolver **solver_container_ref,
+                                           CNumerics **numerics_ref, CConfig *config_ref, unsigned short val_iMesh,
+                                           unsigned short val_RunTime_EqSystem) {
+
+  unsigned long iPoint, nPoint, nPointDomain;
+  unsigned short iVar, nVar;
+  su2double *Solution, Sum_Solution = 0.0;
+
+  integration      = integration_ref;
+  geometry         = geometry_ref;
+  solver_container = solver_container_ref;
+  numerics         = numerics_ref;
+  config           = config_ref;
+  iMesh            = val_iMesh;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  solver           = solver_container[config->GetContainerPosition(RunTime_EqSystem)];
+
+  nPoint       = geometry->GetnPoint();
+  nPointDomain = geometry->GetnPointDomain();
+  nVar         = solver->GetnVar();
+
+  /*--- The residual of the current solution (just computed by the space
+   integration) is the base of the finite differences. ---*/
+
+  Residual_Base = new CSysVector(solver->LinSysRes);
+  Residual_Aux  = new CSysVector(solver->LinSysRes);
+  Solution_Base = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Solution = solver->node[iPoint]->GetSolution();
+    for (iVar = 0; iVar < nVar; iVar++) {
+      (*Solution_Base)[iPoint*nVar+iVar] = Solution[iVar];
+      if (iPoint < nPointDomain) Sum_Solution += fabs(Solution[iVar]);
+    }
+  }
+
+  /*--- Size of the system and mean magnitude of the solution, to scale the
+   differentiation step ---*/
+
+  nUnknown = nPointDomain*nVar;
+
+#ifdef HAVE_MPI
+  su2double MySum_Solution = Sum_Solution;
+  unsigned long MynUnknown = nUnknown;
+  SU2_MPI::Allreduce(&MySum_Solution, &Sum_Solution, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MynUnknown, &nUnknown, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  Mean_Solution = Sum_Solution/su2double(nUnknown);
+
+}
+
+CNewtonKrylovProduct::~CNewtonKrylovProduct(void) {
+
+  delete Residual_Base;
+  delete Residual_Aux;
+  delete Solution_Base;
+
+}
+
+void CNewtonKrylovProduct::operator()(const CSysVector & u, CSysVector & v) const {
+
+  unsigned long iPoint, nPoint, nPointDomain, index;
+  unsigned short iVar, nVar;
+  su2double Eps, Norm_u, Delta;
+
+  nPoint       = geometry->GetnPoint();
+  nPointDomain = geometry->GetnPointDomain();
+  nVar         = solver->GetnVar();
+
+  Norm_u = u.norm();
+  if (Norm_u == 0.0) { v = su2double(0.0); return; }
+
+  /*--- Differentiation step (Knoll and Keyes), scaled such that the perturbation
+   of each unknown is relative to the mean magnitude of the solution ---*/
+
+  Eps = config->GetNewton_Krylov_Eps()*(Mean_Solution*sqrt(su2double(nUnknown))/Norm_u + 1.0);
+
+  /*--- The right hand side of the linear system is stored in the residual
+   of the solver, keep it while the residual is evaluated ---*/
+
+  *Residual_Aux = solver->LinSysRes;
+
+  /*--- Perturbed solution, including the halo points ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) {
+      index = iPoint*nVar+iVar;
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[index] + Eps*u[index]);
+    }
+
+  /*--- Full residual of the perturbed solution (reconstruction, limiters,
+   convective, viscous and source terms, boundary conditions). The time
+   integration is set to explicit meanwhile, so that the residual routines
+   do not modify the Jacobian, which is the preconditioner. ---*/
+
+  config->SetKind_TimeIntScheme_Flow(EULER_EXPLICIT);
+  solver->Preprocessing(geometry, solver_container, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+  integration->Space_Integration(geometry, solver_container, numerics, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
+  config->SetKind_TimeIntScheme_Flow(EULER_IMPLICIT);
+
+  /*--- Product with the Jacobian of the implicit system, the pseudo time
+   term plus the derivative of the residual ---*/
+
+  v = su2double(0.0);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (solver->node[iPoint]->GetDelta_Time() != 0.0) {
+      Delta = geometry->node[iPoint]->GetVolume() / solver->node[iPoint]->GetDelta_Time();
+      for (iVar = 0; iVar < nVar; iVar++) {
+        index = iPoint*nVar+iVar;
+        v[index] = Delta*u[index] + (solver->LinSysRes[index] - (*Residual_Base)[index])/Eps;
+      }
+    }
+    else {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        index = iPoint*nVar+iVar;
+        v[index] = u[index];
+      }
+    }
+  }
+
+  solver->Jacobian.SendReceive_Solution(v, geometry, config);
+
+  /*--- Restore the solution and the right hand side ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[iPoint*nVar+iVar]);
+
+  solver->LinSysRes = *Residual_Aux;
+
+}
@@ -132,6 +132,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
   unsigned short iPreSmooth, iPostSmooth, iRKStep, iRKLimit = 1;
   
   bool startup_multigrid = (config[iZone]->GetRestart_Flow() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (Iteration == 0));
+  bool newton_krylov = (config[iZone]->GetNewton_Krylov() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (iMesh == MESH_0));
   unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
   
   /*--- Do a presmoothing on the grid iMesh to be restricted to the grid iMesh+1 ---*/
@@ -170,9 +171,13 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
       
       Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
       
-      /*--- Time integration, update solution using the old solution plus the solution increment ---*/
+      /*--- Time integration, update solution using the old solution plus the solution increment
+       (on the finest grid the Newton-Krylov method uses the matrix free product of the full residual) ---*/
       
-      Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
+      if (newton_krylov)
+        Time_Integration_NewtonKrylov(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+      else
+        Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
       
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
       
@@ -235,7 +240,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
         }
         
         Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
-        Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
+        if (newton_krylov)
+          Time_Integration_NewtonKrylov(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+        else
+          Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
         
         solver_container[iZone][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iMesh);
         
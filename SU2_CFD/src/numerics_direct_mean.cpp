@@ -784,6 +784,14 @@ CUpwAUSM_Flow::CUpwAUSM_Flow(unsigned short val_nDim, unsigned short val_nVar, C
   Gamma = config->GetGamma();
   Gamma_Minus_One = Gamma - 1.0;
   
+  /*--- Batched flux (SIMD lanes) with the plain double datatype, the flux
+   does not depend on the grid velocity ---*/
+  
+  batched = false;
+#ifdef HAVE_BATCHED_NUMERICS
+  batched = true;
+#endif
+  
   Diff_U = new su2double [nVar];
   Velocity_i = new su2double [nDim];
   Velocity_j = new su2double [nDim];
@@ -946,6 +954,163 @@ void CUpwAUSM_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   }
 }
 
+template<unsigned short NDIM>
+void CUpwAUSM_Flow::ComputeBatch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                 su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                 CConfig *config) {
+  
+  const unsigned short NVAR = NDIM+2, B = EDGE_BATCH_SIZE;
+  unsigned short iLane, iVar, jVar;
+  
+  /*--- Values of the edges of the batch, interleaved as the input ---*/
+  
+  su2double Area_b[B], UnitNormal_b[NDIM*B], Energy_b_i[B], Energy_b_j[B],
+  RoeDensity_b[B], RoeVelocity_b[NDIM*B], RoeSoundSpeed_b[B], Lambda_b[NVAR*B],
+  P_b[NVAR*NVAR*B], invP_b[NVAR*NVAR*B];
+  
+  const su2double *Velocity_b_i = &val_v_i[B], *Pressure_b_i = &val_v_i[(NDIM+1)*B],
+  *Density_b_i = &val_v_i[(NDIM+2)*B], *Enthalpy_b_i = &val_v_i[(NDIM+3)*B];
+  const su2double *Velocity_b_j = &val_v_j[B], *Pressure_b_j = &val_v_j[(NDIM+1)*B],
+  *Density_b_j = &val_v_j[(NDIM+2)*B], *Enthalpy_b_j = &val_v_j[(NDIM+3)*B];
+  
+  /*--- AUSM flux of each edge, same operations as ComputeResidual, the
+   subsonic/supersonic splittings are selected per edge ---*/
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double Area = 0.0, sq_vel, SoundSpeed_i, SoundSpeed_j, ProjVelocity_i = 0.0, ProjVelocity_j = 0.0,
+    mL, mR, mLP, mRM, mF, pLP, pRM, pF, Phi, mLP_sup, mRM_sup, pLP_sup, pRM_sup;
+    su2double Density_i = Density_b_i[iLane], Pressure_i = Pressure_b_i[iLane], Enthalpy_i = Enthalpy_b_i[iLane],
+    Density_j = Density_b_j[iLane], Pressure_j = Pressure_b_j[iLane], Enthalpy_j = Enthalpy_b_j[iLane];
+    unsigned short iDim, iVar;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Area += val_normal[iDim*B+iLane]*val_normal[iDim*B+iLane];
+    Area = sqrt(Area);
+    Area_b[iLane] = Area;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      UnitNormal_b[iDim*B+iLane] = val_normal[iDim*B+iLane]/Area;
+    
+    sq_vel = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      sq_vel += Velocity_b_i[iDim*B+iLane]*Velocity_b_i[iDim*B+iLane];
+    Energy_b_i[iLane] = Enthalpy_i - Pressure_i/Density_i;
+    SoundSpeed_i = sqrt(fabs(Gamma*Gamma_Minus_One*(Energy_b_i[iLane]-0.5*sq_vel)));
+    
+    sq_vel = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      sq_vel += Velocity_b_j[iDim*B+iLane]*Velocity_b_j[iDim*B+iLane];
+    Energy_b_j[iLane] = Enthalpy_j - Pressure_j/Density_j;
+    SoundSpeed_j = sqrt(fabs(Gamma*Gamma_Minus_One*(Energy_b_j[iLane]-0.5*sq_vel)));
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      ProjVelocity_i += Velocity_b_i[iDim*B+iLane]*UnitNormal_b[iDim*B+iLane];
+      ProjVelocity_j += Velocity_b_j[iDim*B+iLane]*UnitNormal_b[iDim*B+iLane];
+    }
+    
+    mL  = ProjVelocity_i/SoundSpeed_i;
+    mR  = ProjVelocity_j/SoundSpeed_j;
+    
+    /*--- Both splittings are evaluated and selected, without branches ---*/
+    
+    mLP = 0.25*(mL+1.0)*(mL+1.0);     mLP_sup = 0.5*(mL+fabs(mL));
+    mRM = -0.25*(mR-1.0)*(mR-1.0);    mRM_sup = 0.5*(mR-fabs(mR));
+    pLP = 0.25*Pressure_i*(mL+1.0)*(mL+1.0)*(2.0-mL);    pLP_sup = 0.5*Pressure_i*(mL+fabs(mL))/mL;
+    pRM = 0.25*Pressure_j*(mR-1.0)*(mR-1.0)*(2.0+mR);    pRM_sup = 0.5*Pressure_j*(mR-fabs(mR))/mR;
+    
+    mLP = (fabs(mL) <= 1.0)? mLP : mLP_sup;
+    mRM = (fabs(mR) <= 1.0)? mRM : mRM_sup;
+    mF = mLP + mRM;
+    
+    pLP = (fabs(mL) <= 1.0)? pLP : pLP_sup;
+    pRM = (fabs(mR) <= 1.0)? pRM : pRM_sup;
+    pF = pLP + pRM;
+    Phi = fabs(mF);
+    
+    val_residual[iLane] = 0.5*(mF*((Density_i*SoundSpeed_i)+(Density_j*SoundSpeed_j))-Phi*((Density_j*SoundSpeed_j)-(Density_i*SoundSpeed_i)));
+    for (iDim = 0; iDim < NDIM; iDim++)
+      val_residual[(iDim+1)*B+iLane] = 0.5*(mF*((Density_i*SoundSpeed_i*Velocity_b_i[iDim*B+iLane])+(Density_j*SoundSpeed_j*Velocity_b_j[iDim*B+iLane]))
+                                            -Phi*((Density_j*SoundSpeed_j*Velocity_b_j[iDim*B+iLane])-(Density_i*SoundSpeed_i*Velocity_b_i[iDim*B+iLane])))+UnitNormal_b[iDim*B+iLane]*pF;
+    val_residual[(NVAR-1)*B+iLane] = 0.5*(mF*((Density_i*SoundSpeed_i*Enthalpy_i)+(Density_j*SoundSpeed_j*Enthalpy_j))-Phi*((Density_j*SoundSpeed_j*Enthalpy_j)-(Density_i*SoundSpeed_i*Enthalpy_i)));
+    
+    for (iVar = 0; iVar < NVAR; iVar++)
+      val_residual[iVar*B+iLane] *= Area;
+    
+  }
+  
+  if (!implicit) return;
+  
+  /*--- Roe's Jacobian for AUSM, mean Roe variables and eigenvalues ---*/
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double R, sq_vel = 0.0, RoeEnthalpy, RoeSoundSpeed, ProjVelocity = 0.0;
+    unsigned short iDim, iVar;
+    
+    R = sqrt(fabs(Density_b_j[iLane]/Density_b_i[iLane]));
+    RoeDensity_b[iLane] = R*Density_b_i[iLane];
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      RoeVelocity_b[iDim*B+iLane] = (R*Velocity_b_j[iDim*B+iLane]+Velocity_b_i[iDim*B+iLane])/(R+1);
+      sq_vel += RoeVelocity_b[iDim*B+iLane]*RoeVelocity_b[iDim*B+iLane];
+    }
+    RoeEnthalpy = (R*Enthalpy_b_j[iLane]+Enthalpy_b_i[iLane])/(R+1);
+    RoeSoundSpeed = sqrt(fabs((Gamma-1)*(RoeEnthalpy-0.5*sq_vel)));
+    RoeSoundSpeed_b[iLane] = RoeSoundSpeed;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      ProjVelocity += RoeVelocity_b[iDim*B+iLane]*UnitNormal_b[iDim*B+iLane];
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Lambda_b[iDim*B+iLane] = ProjVelocity;
+    Lambda_b[(NVAR-2)*B+iLane] = ProjVelocity + RoeSoundSpeed;
+    Lambda_b[(NVAR-1)*B+iLane] = ProjVelocity - RoeSoundSpeed;
+    
+    for (iVar = 0; iVar < NVAR; iVar++)
+      Lambda_b[iVar*B+iLane] = fabs(Lambda_b[iVar*B+iLane]);
+    
+  }
+  
+  GetPMatrix_Batch<NDIM>(RoeDensity_b, RoeVelocity_b, RoeSoundSpeed_b, UnitNormal_b, P_b);
+  GetPMatrix_inv_Batch<NDIM>(RoeDensity_b, RoeVelocity_b, RoeSoundSpeed_b, UnitNormal_b, invP_b);
+  
+  /*--- Jacobians of the inviscid flux, scale = 0.5 because val_residual ~ 0.5*(fc_i+fc_j)*Normal ---*/
+  
+  GetInviscidProjJac_Batch<NDIM>(Velocity_b_i, Energy_b_i, val_normal, 0.5, val_Jacobian_i);
+  GetInviscidProjJac_Batch<NDIM>(Velocity_b_j, Energy_b_j, val_normal, 0.5, val_Jacobian_j);
+  
+  for (iVar = 0; iVar < NVAR; iVar++) {
+    for (jVar = 0; jVar < NVAR; jVar++) {
+      
+      SU2_OMP(simd)
+      for (iLane = 0; iLane < B; iLane++) {
+        
+        su2double Proj_ModJac_Tensor_ij = 0.0;
+        
+        /*--- Compute |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
+        
+        for (unsigned short kVar = 0; kVar < NVAR; kVar++)
+          Proj_ModJac_Tensor_ij += P_b[(iVar*NVAR+kVar)*B+iLane]*Lambda_b[kVar*B+iLane]*invP_b[(kVar*NVAR+jVar)*B+iLane];
+        
+        val_Jacobian_i[(iVar*NVAR+jVar)*B+iLane] += 0.5*Proj_ModJac_Tensor_ij*Area_b[iLane];
+        val_Jacobian_j[(iVar*NVAR+jVar)*B+iLane] -= 0.5*Proj_ModJac_Tensor_ij*Area_b[iLane];
+      }
+    }
+  }
+  
+}
+
+void CUpwAUSM_Flow::ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                          su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                          CConfig *config) {
+  
+  if (nDim == 2) ComputeBatch<2>(val_v_i, val_v_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  else ComputeBatch<3>(val_v_i, val_v_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  
+}
+
 CUpwHLLC_Flow::CUpwHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -967,6 +1132,21 @@ CUpwHLLC_Flow::CUpwHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, C
   Velocity_j        = new su2double [nDim];
   RoeVelocity       = new su2double [nDim];  
   
+  /*--- Batched flux (SIMD lanes) with the plain double datatype, the
+   Jacobians of the edges of a batch are computed in auxiliary blocks ---*/
+  
+  batched = false;
+#ifdef HAVE_BATCHED_NUMERICS
+  batched = !grid_movement;
+#endif
+  
+  Batch_Jacobian_i = new su2double* [nVar];
+  Batch_Jacobian_j = new su2double* [nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Batch_Jacobian_i[iVar] = new su2double [nVar];
+    Batch_Jacobian_j[iVar] = new su2double [nVar];
+  }
+  
 }
 
 CUpwHLLC_Flow::~CUpwHLLC_Flow(void) {
@@ -982,6 +1162,13 @@ CUpwHLLC_Flow::~CUpwHLLC_Flow(void) {
   delete [] Velocity_j;
   delete [] RoeVelocity;
   
+  for (iVar = 0; iVar < nVar; iVar++) {
+    delete [] Batch_Jacobian_i[iVar];
+    delete [] Batch_Jacobian_j[iVar];
+  }
+  delete [] Batch_Jacobian_i;
+  delete [] Batch_Jacobian_j;
+  
 }
 
 void CUpwHLLC_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
@@ -1162,7 +1349,11 @@ if (sM > 0.0) {
     val_residual[iVar] *= Area;
 
 
-  if (implicit) {
+  if (implicit) ComputeJacobian(val_Jacobian_i, val_Jacobian_j);
+
+}
+
+void CUpwHLLC_Flow::ComputeJacobian(su2double **val_Jacobian_i, su2double **val_Jacobian_j) {
 
   if (sM > 0.0) {
 
@@ -1454,6 +1645,165 @@ if (sM > 0.0) {
   }
 }
 
+template<unsigned short NDIM>
+void CUpwHLLC_Flow::ComputeBatch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                 su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                 CConfig *config) {
+  
+  const unsigned short NVAR = NDIM+2, B = EDGE_BATCH_SIZE;
+  unsigned short iLane, iDim, iVar, jVar;
+  
+  /*--- Values of the edges of the batch that are needed by the Jacobians ---*/
+  
+  su2double Area_b[B], UnitNormal_b[NDIM*B], Energy_b_i[B], Energy_b_j[B], sq_vel_b_i[B], sq_vel_b_j[B],
+  ProjVelocity_b_i[B], ProjVelocity_b_j[B], sL_b[B], sR_b[B], sM_b[B], pStar_b[B], RHO_b[B],
+  IntermediateState_b[NVAR*B];
+  
+  const su2double *Velocity_b_i = &val_v_i[B], *Pressure_b_i = &val_v_i[(NDIM+1)*B],
+  *Density_b_i = &val_v_i[(NDIM+2)*B], *Enthalpy_b_i = &val_v_i[(NDIM+3)*B];
+  const su2double *Velocity_b_j = &val_v_j[B], *Pressure_b_j = &val_v_j[(NDIM+1)*B],
+  *Density_b_j = &val_v_j[(NDIM+2)*B], *Enthalpy_b_j = &val_v_j[(NDIM+3)*B];
+  
+  /*--- HLLC flux of each edge, same operations as ComputeResidual. The four
+   wave configurations are reduced to a selection of the upwind side (left if
+   sM > 0) and a selection between its state and its star state. ---*/
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double Area = 0.0, sq_vel_i = 0.0, sq_vel_j = 0.0, SoundSpeed_i, SoundSpeed_j, ProjVelocity_i = 0.0, ProjVelocity_j = 0.0,
+    ProjInterfaceVel = 0.0, sqrtDensity_i, sqrtDensity_j, Rrho, sq_velRoe = 0.0, RoeProjVelocity, RoeVelocity, RoeEnthalpy,
+    RoeSoundSpeed, sL, sR, sM, RHO, pStar;
+    su2double Density_i = Density_b_i[iLane], Pressure_i = Pressure_b_i[iLane], Enthalpy_i = Enthalpy_b_i[iLane],
+    Density_j = Density_b_j[iLane], Pressure_j = Pressure_b_j[iLane], Enthalpy_j = Enthalpy_b_j[iLane];
+    su2double Density_k, Pressure_k, Enthalpy_k, Energy_k, ProjVelocity_k, s_k, rhoSK, Flux, Star, sStar;
+    unsigned short iDim, iVar;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Area += val_normal[iDim*B+iLane] * val_normal[iDim*B+iLane];
+    Area = sqrt(Area);
+    Area_b[iLane] = Area;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      UnitNormal_b[iDim*B+iLane] = val_normal[iDim*B+iLane] / Area;
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      sq_vel_i += Velocity_b_i[iDim*B+iLane] * Velocity_b_i[iDim*B+iLane];
+      sq_vel_j += Velocity_b_j[iDim*B+iLane] * Velocity_b_j[iDim*B+iLane];
+    }
+    sq_vel_b_i[iLane] = sq_vel_i; sq_vel_b_j[iLane] = sq_vel_j;
+    
+    Energy_b_i[iLane] = Enthalpy_i - Pressure_i / Density_i;
+    Energy_b_j[iLane] = Enthalpy_j - Pressure_j / Density_j;
+    
+    SoundSpeed_i = sqrt( (Enthalpy_i - 0.5 * sq_vel_i) * Gamma_Minus_One );
+    SoundSpeed_j = sqrt( (Enthalpy_j - 0.5 * sq_vel_j) * Gamma_Minus_One );
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      ProjVelocity_i += Velocity_b_i[iDim*B+iLane] * UnitNormal_b[iDim*B+iLane];
+      ProjVelocity_j += Velocity_b_j[iDim*B+iLane] * UnitNormal_b[iDim*B+iLane];
+    }
+    ProjVelocity_b_i[iLane] = ProjVelocity_i; ProjVelocity_b_j[iLane] = ProjVelocity_j;
+    
+    /*--- Roe's averaging ---*/
+    
+    sqrtDensity_i = sqrt(Density_i); sqrtDensity_j = sqrt(Density_j);
+    Rrho = ( sqrtDensity_i + sqrtDensity_j );
+    
+    RoeProjVelocity = - ProjInterfaceVel;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      RoeVelocity = ( Velocity_b_i[iDim*B+iLane] * sqrtDensity_i + Velocity_b_j[iDim*B+iLane] * sqrtDensity_j ) / Rrho;
+      sq_velRoe       += RoeVelocity * RoeVelocity;
+      RoeProjVelocity += RoeVelocity * UnitNormal_b[iDim*B+iLane];
+    }
+    RoeEnthalpy = ( sqrtDensity_j * Enthalpy_j + sqrtDensity_i * Enthalpy_i) / Rrho;
+    RoeSoundSpeed = sqrt( Gamma_Minus_One * ( RoeEnthalpy - 0.5 * sq_velRoe  ) ) - ProjInterfaceVel;
+    
+    /*--- Speed of the waves, of the contact surface and star pressure ---*/
+    
+    sL = min( RoeProjVelocity - RoeSoundSpeed, ProjVelocity_i - SoundSpeed_i);
+    sR = max( RoeProjVelocity + RoeSoundSpeed, ProjVelocity_j + SoundSpeed_j);
+    
+    RHO = Density_j * (sR - ProjVelocity_j) - Density_i * (sL - ProjVelocity_i);
+    sM = ( Pressure_i - Pressure_j - Density_i * ProjVelocity_i * ( sL - ProjVelocity_i ) + Density_j * ProjVelocity_j * ( sR - ProjVelocity_j ) ) / RHO;
+    pStar = Density_j * ( ProjVelocity_j - sR ) * ( ProjVelocity_j - sM ) + Pressure_j;
+    
+    sL_b[iLane] = sL; sR_b[iLane] = sR; sM_b[iLane] = sM; pStar_b[iLane] = pStar; RHO_b[iLane] = RHO;
+    
+    /*--- Upwind side (left if sM > 0) and star state (if sStar is not positive) ---*/
+    
+    sStar = ((sM > 0.0)? sL : -sR);
+    
+    Density_k      = ((sM > 0.0)? Density_i : Density_j);
+    Pressure_k     = ((sM > 0.0)? Pressure_i : Pressure_j);
+    Enthalpy_k     = ((sM > 0.0)? Enthalpy_i : Enthalpy_j);
+    Energy_k       = ((sM > 0.0)? Energy_b_i[iLane] : Energy_b_j[iLane]);
+    ProjVelocity_k = ((sM > 0.0)? ProjVelocity_i : ProjVelocity_j);
+    s_k            = ((sM > 0.0)? sL : sR);
+    
+    rhoSK = ( s_k - ProjVelocity_k ) / ( s_k - sM );
+    
+    IntermediateState_b[iLane] = rhoSK * Density_k;
+    Flux = Density_k * ProjVelocity_k;
+    Star = sM * IntermediateState_b[iLane];
+    val_residual[iLane] = ((sStar > 0.0)? Flux : Star) * Area;
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      su2double Velocity_k = ((sM > 0.0)? Velocity_b_i[iDim*B+iLane] : Velocity_b_j[iDim*B+iLane]);
+      IntermediateState_b[(iDim+1)*B+iLane] = rhoSK * ( Density_k * Velocity_k + ( pStar - Pressure_k ) / ( s_k - ProjVelocity_k ) * UnitNormal_b[iDim*B+iLane] ) ;
+      Flux = Density_k * Velocity_k * ProjVelocity_k + Pressure_k * UnitNormal_b[iDim*B+iLane];
+      Star = sM * IntermediateState_b[(iDim+1)*B+iLane] + pStar * UnitNormal_b[iDim*B+iLane];
+      val_residual[(iDim+1)*B+iLane] = ((sStar > 0.0)? Flux : Star) * Area;
+    }
+    
+    IntermediateState_b[(NVAR-1)*B+iLane] = rhoSK * ( Density_k * Energy_k - ( Pressure_k * ProjVelocity_k - pStar * sM ) / ( s_k - ProjVelocity_k ) );
+    Flux = Enthalpy_k * Density_k * ProjVelocity_k;
+    Star = sM * ( IntermediateState_b[(NVAR-1)*B+iLane] + pStar ) + pStar * ProjInterfaceVel;
+    val_residual[(NVAR-1)*B+iLane] = ((sStar > 0.0)? Flux : Star) * Area;
+    
+  }
+  
+  if (!implicit) return;
+  
+  /*--- The Jacobians have a different expression for each wave configuration,
+   they are computed edge by edge from the states of the flux ---*/
+  
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Velocity_i[iDim] = Velocity_b_i[iDim*B+iLane];
+      Velocity_j[iDim] = Velocity_b_j[iDim*B+iLane];
+      UnitNormal[iDim] = UnitNormal_b[iDim*B+iLane];
+    }
+    Density_i = Density_b_i[iLane];   Density_j = Density_b_j[iLane];
+    Pressure_i = Pressure_b_i[iLane]; Pressure_j = Pressure_b_j[iLane];
+    Enthalpy_i = Enthalpy_b_i[iLane]; Enthalpy_j = Enthalpy_b_j[iLane];
+    Energy_i = Energy_b_i[iLane];     Energy_j = Energy_b_j[iLane];
+    sq_vel_i = sq_vel_b_i[iLane];     sq_vel_j = sq_vel_b_j[iLane];
+    ProjVelocity_i = ProjVelocity_b_i[iLane]; ProjVelocity_j = ProjVelocity_b_j[iLane];
+    sL = sL_b[iLane]; sR = sR_b[iLane]; sM = sM_b[iLane]; pStar = pStar_b[iLane]; RHO = RHO_b[iLane];
+    for (iVar = 0; iVar < NVAR; iVar++)
+      IntermediateState[iVar] = IntermediateState_b[iVar*B+iLane];
+    Area = Area_b[iLane];
+    
+    ComputeJacobian(Batch_Jacobian_i, Batch_Jacobian_j);
+    
+    for (iVar = 0; iVar < NVAR; iVar++)
+      for (jVar = 0; jVar < NVAR; jVar++) {
+        val_Jacobian_i[(iVar*NVAR+jVar)*B+iLane] = Batch_Jacobian_i[iVar][jVar];
+        val_Jacobian_j[(iVar*NVAR+jVar)*B+iLane] = Batch_Jacobian_j[iVar][jVar];
+      }
+  }
+  
+}
+
+void CUpwHLLC_Flow::ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                          su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                          CConfig *config) {
+  
+  if (nDim == 2) ComputeBatch<2>(val_v_i, val_v_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  else ComputeBatch<3>(val_v_i, val_v_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  
 }
 
 CUpwGeneralHLLC_Flow::CUpwGeneralHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
@@ -2344,6 +2694,13 @@ CUpwRoe_Flow::CUpwRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CCo
   Gamma = config->GetGamma();
   Gamma_Minus_One = Gamma - 1.0;
   
+  /*--- Batched flux (SIMD lanes) with the plain double datatype ---*/
+  
+  batched = false;
+#ifdef HAVE_BATCHED_NUMERICS
+  batched = !grid_movement;
+#endif
+  
   Diff_U = new su2double [nVar];
   Velocity_i = new su2double [nDim];
   Velocity_j = new su2double [nDim];
@@ -2453,9 +2810,11 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   if (RoeSoundSpeed2 <= 0.0) {
     for (iVar = 0; iVar < nVar; iVar++) {
       val_residual[iVar] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++) {
-        val_Jacobian_i[iVar][iVar] = 0.0;
-        val_Jacobian_j[iVar][iVar] = 0.0;
+      if (implicit) {
+        for (jVar = 0; jVar < nVar; jVar++) {
+          val_Jacobian_i[iVar][jVar] = 0.0;
+          val_Jacobian_j[iVar][jVar] = 0.0;
+        }
       }
     }
     AD::SetPreaccOut(val_residual, nVar);
@@ -2574,6 +2933,161 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
 }
 
+template<unsigned short NDIM>
+void CUpwRoe_Flow::ComputeBatch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                CConfig *config) {
+  
+  const unsigned short NVAR = NDIM+2, B = EDGE_BATCH_SIZE;
+  unsigned short iLane, iVar, jVar;
+  
+  /*--- Values of the edges of the batch, interleaved as the input ---*/
+  
+  su2double Area_b[B], UnitNormal_b[NDIM*B], Energy_b_i[B], Energy_b_j[B], Diff_U_b[NVAR*B], Valid_b[B],
+  RoeDensity_b[B], RoeVelocity_b[NDIM*B], RoeSoundSpeed_b[B], Lambda_b[NVAR*B],
+  ProjFlux_b_i[NVAR*B], ProjFlux_b_j[NVAR*B], P_b[NVAR*NVAR*B], invP_b[NVAR*NVAR*B];
+  
+  const su2double *Velocity_b_i = &val_v_i[B], *Pressure_b_i = &val_v_i[(NDIM+1)*B],
+  *Density_b_i = &val_v_i[(NDIM+2)*B], *Enthalpy_b_i = &val_v_i[(NDIM+3)*B];
+  const su2double *Velocity_b_j = &val_v_j[B], *Pressure_b_j = &val_v_j[(NDIM+1)*B],
+  *Density_b_j = &val_v_j[(NDIM+2)*B], *Enthalpy_b_j = &val_v_j[(NDIM+3)*B];
+  
+  Delta = config->GetEntropyFix_Coeff();
+  
+  /*--- Roe averages and eigenvalues of each edge, same operations as ComputeResidual.
+   Instead of returning early, the edges with a negative Roe sound speed are
+   flagged and their flux is set to zero at the end. ---*/
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double Area = 0.0, R, sq_vel = 0.0, RoeEnthalpy, RoeSoundSpeed2, RoeSoundSpeed, ProjVelocity = 0.0, MaxLambda;
+    su2double Density_i = Density_b_i[iLane], Density_j = Density_b_j[iLane];
+    unsigned short iDim, iVar;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Area += val_normal[iDim*B+iLane]*val_normal[iDim*B+iLane];
+    Area = sqrt(Area);
+    Area_b[iLane] = Area;
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      UnitNormal_b[iDim*B+iLane] = val_normal[iDim*B+iLane]/Area;
+    
+    Energy_b_i[iLane] = Enthalpy_b_i[iLane] - Pressure_b_i[iLane]/Density_i;
+    Energy_b_j[iLane] = Enthalpy_b_j[iLane] - Pressure_b_j[iLane]/Density_j;
+    
+    /*--- Difference of the conservative variables ---*/
+    
+    Diff_U_b[iLane] = Density_j-Density_i;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Diff_U_b[(iDim+1)*B+iLane] = Density_j*Velocity_b_j[iDim*B+iLane]-Density_i*Velocity_b_i[iDim*B+iLane];
+    Diff_U_b[(NDIM+1)*B+iLane] = Density_j*Energy_b_j[iLane]-Density_i*Energy_b_i[iLane];
+    
+    /*--- Roe-averaged variables at interface between i & j ---*/
+    
+    R = sqrt(fabs(Density_j/Density_i));
+    RoeDensity_b[iLane] = R*Density_i;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      RoeVelocity_b[iDim*B+iLane] = (R*Velocity_b_j[iDim*B+iLane]+Velocity_b_i[iDim*B+iLane])/(R+1);
+      sq_vel += RoeVelocity_b[iDim*B+iLane]*RoeVelocity_b[iDim*B+iLane];
+    }
+    RoeEnthalpy = (R*Enthalpy_b_j[iLane]+Enthalpy_b_i[iLane])/(R+1);
+    
+    RoeSoundSpeed2 = (Gamma-1)*(RoeEnthalpy-0.5*sq_vel);
+    Valid_b[iLane] = (RoeSoundSpeed2 > 0.0)? 1.0 : 0.0;
+    RoeSoundSpeed = sqrt((RoeSoundSpeed2 > 0.0)? RoeSoundSpeed2 : 1.0);
+    RoeSoundSpeed_b[iLane] = RoeSoundSpeed;
+    
+    /*--- Flow eigenvalues with Mavriplis' entropy correction ---*/
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      ProjVelocity += RoeVelocity_b[iDim*B+iLane]*UnitNormal_b[iDim*B+iLane];
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Lambda_b[iDim*B+iLane] = ProjVelocity;
+    Lambda_b[(NVAR-2)*B+iLane] = ProjVelocity + RoeSoundSpeed;
+    Lambda_b[(NVAR-1)*B+iLane] = ProjVelocity - RoeSoundSpeed;
+    
+    MaxLambda = fabs(ProjVelocity) + RoeSoundSpeed;
+    for (iVar = 0; iVar < NVAR; iVar++)
+      Lambda_b[iVar*B+iLane] = max(fabs(Lambda_b[iVar*B+iLane]), Delta*MaxLambda);
+    
+  }
+  
+  /*--- Projected fluxes, P, inverse P and the Jacobians of the inviscid
+   flux (scaled by kappa) of the batch ---*/
+  
+  GetInviscidProjFlux_Batch<NDIM>(Density_b_i, Velocity_b_i, Pressure_b_i, Enthalpy_b_i, val_normal, ProjFlux_b_i);
+  GetInviscidProjFlux_Batch<NDIM>(Density_b_j, Velocity_b_j, Pressure_b_j, Enthalpy_b_j, val_normal, ProjFlux_b_j);
+  
+  GetPMatrix_Batch<NDIM>(RoeDensity_b, RoeVelocity_b, RoeSoundSpeed_b, UnitNormal_b, P_b);
+  GetPMatrix_inv_Batch<NDIM>(RoeDensity_b, RoeVelocity_b, RoeSoundSpeed_b, UnitNormal_b, invP_b);
+  
+  if (implicit) {
+    GetInviscidProjJac_Batch<NDIM>(Velocity_b_i, Energy_b_i, val_normal, kappa, val_Jacobian_i);
+    GetInviscidProjJac_Batch<NDIM>(Velocity_b_j, Energy_b_j, val_normal, kappa, val_Jacobian_j);
+  }
+  
+  /*--- Roe's flux approximation ---*/
+  
+  for (iVar = 0; iVar < NVAR; iVar++) {
+    
+    SU2_OMP(simd)
+    for (iLane = 0; iLane < B; iLane++)
+      val_residual[iVar*B+iLane] = kappa*(ProjFlux_b_i[iVar*B+iLane]+ProjFlux_b_j[iVar*B+iLane]);
+    
+    for (jVar = 0; jVar < NVAR; jVar++) {
+      
+      SU2_OMP(simd)
+      for (iLane = 0; iLane < B; iLane++) {
+        
+        su2double Proj_ModJac_Tensor_ij = 0.0;
+        
+        /*--- Compute |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
+        
+        for (unsigned short kVar = 0; kVar < NVAR; kVar++)
+          Proj_ModJac_Tensor_ij += P_b[(iVar*NVAR+kVar)*B+iLane]*Lambda_b[kVar*B+iLane]*invP_b[(kVar*NVAR+jVar)*B+iLane];
+        
+        val_residual[iVar*B+iLane] -= (1.0-kappa)*Proj_ModJac_Tensor_ij*Diff_U_b[jVar*B+iLane]*Area_b[iLane];
+        
+        if (implicit) {
+          val_Jacobian_i[(iVar*NVAR+jVar)*B+iLane] += (1.0-kappa)*Proj_ModJac_Tensor_ij*Area_b[iLane];
+          val_Jacobian_j[(iVar*NVAR+jVar)*B+iLane] -= (1.0-kappa)*Proj_ModJac_Tensor_ij*Area_b[iLane];
+        }
+      }
+    }
+  }
+  
+  /*--- Edges with a negative Roe sound speed (the jump of the variables is
+   too large), no flux ---*/
+  
+  for (iVar = 0; iVar < NVAR; iVar++) {
+    SU2_OMP(simd)
+    for (iLane = 0; iLane < B; iLane++)
+      val_residual[iVar*B+iLane] = (Valid_b[iLane] > 0.0)? val_residual[iVar*B+iLane] : 0.0;
+  }
+  
+  if (implicit) {
+    for (iVar = 0; iVar < NVAR*NVAR; iVar++) {
+      SU2_OMP(simd)
+      for (iLane = 0; iLane < B; iLane++) {
+        val_Jacobian_i[iVar*B+iLane] = (Valid_b[iLane] > 0.0)? val_Jacobian_i[iVar*B+iLane] : 0.0;
+        val_Jacobian_j[iVar*B+iLane] = (Valid_b[iLane] > 0.0)? val_Jacobian_j[iVar*B+iLane] : 0.0;
+      }
+    }
+  }
+  
+}
+
+void CUpwRoe_Flow::ComputeResidual_Batch(const su2double *val_v_i, const su2double *val_v_j, const su2double *val_normal,
+                                         su2double *val_residual, su2double *val_Jacobian_i, su2double *val_Jacobian_j,
+                                         CConfig *config) {
+  
+  if (nDim == 2) ComputeBatch<2>(val_v_i, val_v_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  else ComputeBatch<3>(val_v_i, val_v_j, val_normal, val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  
+}
+
 
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
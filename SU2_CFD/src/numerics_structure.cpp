@@ -657,6 +657,279 @@ void CNumerics::GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
   }
 }
 
+template<unsigned short NDIM>
+void CNumerics::GetInviscidProjFlux_Batch(const su2double *val_density, const su2double *val_velocity,
+                                          const su2double *val_pressure, const su2double *val_enthalpy,
+                                          const su2double *val_normal, su2double *val_Proj_Flux) {
+  
+  const unsigned short B = EDGE_BATCH_SIZE;
+  unsigned short iLane;
+  
+  /*--- Same operations as GetInviscidProjFlux, the edges of the batch are
+   independent and the loop over them is vectorized ---*/
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double *Flux = &val_Proj_Flux[iLane];
+    su2double rho = val_density[iLane], p = val_pressure[iLane], h = val_enthalpy[iLane], rhoU, n;
+    unsigned short iDim, jDim;
+    
+    rhoU = rho*val_velocity[iLane]; n = val_normal[iLane];
+    Flux[0] = rhoU*n;
+    for (jDim = 0; jDim < NDIM; jDim++)
+      Flux[(jDim+1)*B] = (jDim == 0)? (rhoU*val_velocity[iLane]+p)*n : rhoU*val_velocity[jDim*B+iLane]*n;
+    Flux[(NDIM+1)*B] = rhoU*h*n;
+    
+    for (iDim = 1; iDim < NDIM; iDim++) {
+      rhoU = rho*val_velocity[iDim*B+iLane]; n = val_normal[iDim*B+iLane];
+      Flux[0] += rhoU*n;
+      for (jDim = 0; jDim < NDIM; jDim++)
+        Flux[(jDim+1)*B] += (jDim == iDim)? (rhoU*val_velocity[jDim*B+iLane]+p)*n : rhoU*val_velocity[jDim*B+iLane]*n;
+      Flux[(NDIM+1)*B] += rhoU*h*n;
+    }
+    
+  }
+  
+}
+
+template<unsigned short NDIM>
+void CNumerics::GetInviscidProjJac_Batch(const su2double *val_velocity, const su2double *val_energy,
+                                         const su2double *val_normal, su2double val_scale,
+                                         su2double *val_Proj_Jac_Tensor) {
+  
+  const unsigned short NVAR = NDIM+2, B = EDGE_BATCH_SIZE;
+  unsigned short iLane;
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double *Jac = &val_Proj_Jac_Tensor[iLane];
+    su2double sqvel = 0.0, proj_vel = 0.0, phi, a1, a2, u[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0};
+    unsigned short iDim, jDim;
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      u[iDim] = val_velocity[iDim*B+iLane]; n[iDim] = val_normal[iDim*B+iLane];
+      sqvel    += u[iDim]*u[iDim];
+      proj_vel += u[iDim]*n[iDim];
+    }
+    
+    phi = 0.5*Gamma_Minus_One*sqvel;
+    a1 = Gamma*val_energy[iLane]-phi;
+    a2 = Gamma-1.0;
+    
+    Jac[0] = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Jac[(iDim+1)*B] = val_scale*n[iDim];
+    Jac[(NDIM+1)*B] = 0.0;
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Jac[((iDim+1)*NVAR)*B] = val_scale*(n[iDim]*phi - u[iDim]*proj_vel);
+      for (jDim = 0; jDim < NDIM; jDim++)
+        Jac[((iDim+1)*NVAR+jDim+1)*B] = val_scale*(n[jDim]*u[iDim]-a2*n[iDim]*u[jDim]);
+      Jac[((iDim+1)*NVAR+iDim+1)*B] += val_scale*proj_vel;
+      Jac[((iDim+1)*NVAR+NDIM+1)*B] = val_scale*a2*n[iDim];
+    }
+    
+    Jac[((NDIM+1)*NVAR)*B] = val_scale*proj_vel*(phi-a1);
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Jac[((NDIM+1)*NVAR+iDim+1)*B] = val_scale*(n[iDim]*a1-a2*u[iDim]*proj_vel);
+    Jac[((NDIM+1)*NVAR+NDIM+1)*B] = val_scale*Gamma*proj_vel;
+    
+  }
+  
+}
+
+template<unsigned short NDIM>
+void CNumerics::GetPMatrix_Batch(const su2double *val_density, const su2double *val_velocity,
+                                 const su2double *val_soundspeed, const su2double *val_normal,
+                                 su2double *val_p_tensor) {
+  
+  const unsigned short NVAR = NDIM+2, B = EDGE_BATCH_SIZE;
+  unsigned short iLane;
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double *P = &val_p_tensor[iLane];
+    su2double rho = val_density[iLane], c = val_soundspeed[iLane], u[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0};
+    su2double sqvel, rhooc, rhoxc;
+    
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+      u[iDim] = val_velocity[iDim*B+iLane]; n[iDim] = val_normal[iDim*B+iLane];
+    }
+    
+    rhooc = rho / c;
+    rhoxc = rho * c;
+    
+    if (NDIM == 2) {
+    
+      sqvel = u[0]*u[0]+u[1]*u[1];
+    
+      P[(0*NVAR+0)*B] = 1.0;
+      P[(0*NVAR+1)*B]=0.0;
+      P[(0*NVAR+2)*B]=0.5*rhooc;
+      P[(0*NVAR+3)*B]=0.5*rhooc;
+    
+      P[(1*NVAR+0)*B]=u[0];
+      P[(1*NVAR+1)*B]=rho*n[1];
+      P[(1*NVAR+2)*B]=0.5*(u[0]*rhooc+n[0]*rho);
+      P[(1*NVAR+3)*B]=0.5*(u[0]*rhooc-n[0]*rho);
+    
+      P[(2*NVAR+0)*B]=u[1];
+      P[(2*NVAR+1)*B]=-rho*n[0];
+      P[(2*NVAR+2)*B]=0.5*(u[1]*rhooc+n[1]*rho);
+      P[(2*NVAR+3)*B]=0.5*(u[1]*rhooc-n[1]*rho);
+    
+      P[(3*NVAR+0)*B]=0.5*sqvel;
+      P[(3*NVAR+1)*B]=rho*u[0]*n[1]-rho*u[1]*n[0];
+      P[(3*NVAR+2)*B]=0.5*(0.5*sqvel*rhooc+rho*u[0]*n[0]+rho*u[1]*n[1]+rhoxc/Gamma_Minus_One);
+      P[(3*NVAR+3)*B]=0.5*(0.5*sqvel*rhooc-rho*u[0]*n[0]-rho*u[1]*n[1]+rhoxc/Gamma_Minus_One);
+    
+    }
+    else {
+    
+      sqvel = u[0]*u[0]+u[1]*u[1]+u[2]*u[2];
+    
+      P[(0*NVAR+0)*B]=n[0];
+      P[(0*NVAR+1)*B]=n[1];
+      P[(0*NVAR+2)*B]=n[2];
+      P[(0*NVAR+3)*B]=0.5*rhooc;
+      P[(0*NVAR+4)*B]=0.5*rhooc;
+    
+      P[(1*NVAR+0)*B]=u[0]*n[0];
+      P[(1*NVAR+1)*B]=u[0]*n[1]-rho*n[2];
+      P[(1*NVAR+2)*B]=u[0]*n[2]+rho*n[1];
+      P[(1*NVAR+3)*B]=0.5*(u[0]*rhooc+rho*n[0]);
+      P[(1*NVAR+4)*B]=0.5*(u[0]*rhooc-rho*n[0]);
+    
+      P[(2*NVAR+0)*B]=u[1]*n[0]+rho*n[2];
+      P[(2*NVAR+1)*B]=u[1]*n[1];
+      P[(2*NVAR+2)*B]=u[1]*n[2]-rho*n[0];
+      P[(2*NVAR+3)*B]=0.5*(u[1]*rhooc+rho*n[1]);
+      P[(2*NVAR+4)*B]=0.5*(u[1]*rhooc-rho*n[1]);
+    
+      P[(3*NVAR+0)*B]=u[2]*n[0]-rho*n[1];
+      P[(3*NVAR+1)*B]=u[2]*n[1]+rho*n[0];
+      P[(3*NVAR+2)*B]=u[2]*n[2];
+      P[(3*NVAR+3)*B]=0.5*(u[2]*rhooc+rho*n[2]);
+      P[(3*NVAR+4)*B]=0.5*(u[2]*rhooc-rho*n[2]);
+    
+      P[(4*NVAR+0)*B]=0.5*sqvel*n[0]+rho*u[1]*n[2]-rho*u[2]*n[1];
+      P[(4*NVAR+1)*B]=0.5*sqvel*n[1]-rho*u[0]*n[2]+rho*u[2]*n[0];
+      P[(4*NVAR+2)*B]=0.5*sqvel*n[2]+rho*u[0]*n[1]-rho*u[1]*n[0];
+      P[(4*NVAR+3)*B]=0.5*(0.5*sqvel*rhooc+rho*(u[0]*n[0]+u[1]*n[1]+u[2]*n[2])+rhoxc/Gamma_Minus_One);
+      P[(4*NVAR+4)*B]=0.5*(0.5*sqvel*rhooc-rho*(u[0]*n[0]+u[1]*n[1]+u[2]*n[2])+rhoxc/Gamma_Minus_One);
+    
+    }
+    
+  }
+  
+}
+
+template<unsigned short NDIM>
+void CNumerics::GetPMatrix_inv_Batch(const su2double *val_density, const su2double *val_velocity,
+                                     const su2double *val_soundspeed, const su2double *val_normal,
+                                     su2double *val_invp_tensor) {
+  
+  const unsigned short NVAR = NDIM+2, B = EDGE_BATCH_SIZE;
+  unsigned short iLane;
+  
+  SU2_OMP(simd)
+  for (iLane = 0; iLane < B; iLane++) {
+    
+    su2double *invP = &val_invp_tensor[iLane];
+    su2double rho = val_density[iLane], c = val_soundspeed[iLane], u[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0};
+    su2double rhoxc, c2, gm1, k0orho, k1orho, gm1_o_c2, gm1_o_rhoxc, sqvel;
+    
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+      u[iDim] = val_velocity[iDim*B+iLane]; n[iDim] = val_normal[iDim*B+iLane];
+    }
+    
+    rhoxc = rho * c;
+    c2 = c * c;
+    gm1 = Gamma_Minus_One;
+    k0orho = n[0] / rho;
+    k1orho = n[1] / rho;
+    gm1_o_c2 = gm1/c2;
+    gm1_o_rhoxc = gm1/rhoxc;
+    
+    if (NDIM == 3) {
+    
+      sqvel = u[0]*u[0]+u[1]*u[1]+u[2]*u[2];
+
+      invP[(0*NVAR+0)*B]=n[0]-n[2]*u[1] / rho+n[1]*u[2] / rho-n[0]*0.5*gm1*sqvel/c2;
+      invP[(0*NVAR+1)*B]=n[0]*gm1*u[0]/c2;
+      invP[(0*NVAR+2)*B]=n[2] / rho+n[0]*gm1*u[1]/c2;
+      invP[(0*NVAR+3)*B]=-n[1] / rho+n[0]*gm1*u[2]/c2;
+      invP[(0*NVAR+4)*B]=-n[0]*gm1/c2;
+
+      invP[(1*NVAR+0)*B]=n[1]+n[2]*u[0] / rho-n[0]*u[2] / rho-n[1]*0.5*gm1*sqvel/c2;
+      invP[(1*NVAR+1)*B]=-n[2] / rho+n[1]*gm1*u[0]/c2;
+      invP[(1*NVAR+2)*B]=n[1]*gm1*u[1]/c2;
+      invP[(1*NVAR+3)*B]=n[0] / rho+n[1]*gm1*u[2]/c2;
+      invP[(1*NVAR+4)*B]=-n[1]*gm1/c2;
+
+      invP[(2*NVAR+0)*B]=n[2]-n[1]*u[0] / rho+n[0]*u[1] / rho-n[2]*0.5*gm1*sqvel/c2;
+      invP[(2*NVAR+1)*B]=n[1] / rho+n[2]*gm1*u[0]/c2;
+      invP[(2*NVAR+2)*B]=-n[0] / rho+n[2]*gm1*u[1]/c2;
+      invP[(2*NVAR+3)*B]=n[2]*gm1*u[2]/c2;
+      invP[(2*NVAR+4)*B]=-n[2]*gm1/c2;
+
+      invP[(3*NVAR+0)*B]=-(n[0]*u[0]+n[1]*u[1]+n[2]*u[2]) / rho+0.5*gm1*sqvel/rhoxc;
+      invP[(3*NVAR+1)*B]=n[0] / rho-gm1*u[0]/rhoxc;
+      invP[(3*NVAR+2)*B]=n[1] / rho-gm1*u[1]/rhoxc;
+      invP[(3*NVAR+3)*B]=n[2] / rho-gm1*u[2]/rhoxc;
+      invP[(3*NVAR+4)*B]=Gamma_Minus_One/rhoxc;
+
+      invP[(4*NVAR+0)*B]=(n[0]*u[0]+n[1]*u[1]+n[2]*u[2]) / rho+0.5*gm1*sqvel/rhoxc;
+      invP[(4*NVAR+1)*B]=-n[0] / rho-gm1*u[0]/rhoxc;
+      invP[(4*NVAR+2)*B]=-n[1] / rho-gm1*u[1]/rhoxc;
+      invP[(4*NVAR+3)*B]=-n[2] / rho-gm1*u[2]/rhoxc;
+      invP[(4*NVAR+4)*B]=Gamma_Minus_One/rhoxc;
+    
+    }
+    if (NDIM == 2) {
+    
+      sqvel = u[0]*u[0]+u[1]*u[1];
+
+      invP[(0*NVAR+0)*B] = 1.0-0.5*gm1_o_c2*sqvel;
+      invP[(0*NVAR+1)*B]=gm1_o_c2*u[0];
+      invP[(0*NVAR+2)*B]=gm1_o_c2*u[1];
+      invP[(0*NVAR+3)*B]=-gm1_o_c2;
+
+      invP[(1*NVAR+0)*B]=-k1orho*u[0]+k0orho*u[1];
+      invP[(1*NVAR+1)*B]=k1orho;
+      invP[(1*NVAR+2)*B]=-k0orho;
+      invP[(1*NVAR+3)*B]=0.0;
+
+      invP[(2*NVAR+0)*B]=-k0orho*u[0]-k1orho*u[1]+0.5*gm1_o_rhoxc*sqvel;
+      invP[(2*NVAR+1)*B]=k0orho-gm1_o_rhoxc*u[0];
+      invP[(2*NVAR+2)*B]=k1orho-gm1_o_rhoxc*u[1];
+      invP[(2*NVAR+3)*B]=gm1_o_rhoxc;
+
+      invP[(3*NVAR+0)*B]=k0orho*u[0]+k1orho*u[1]+0.5*gm1_o_rhoxc*sqvel;
+      invP[(3*NVAR+1)*B]=-k0orho-gm1_o_rhoxc*u[0];
+      invP[(3*NVAR+2)*B]=-k1orho-gm1_o_rhoxc*u[1];
+      invP[(3*NVAR+3)*B]=gm1_o_rhoxc;
+    
+    }
+    
+  }
+  
+}
+
+/*--- The batched kernels are instantiated for 2D and 3D problems ---*/
+
+template void CNumerics::GetInviscidProjFlux_Batch<2>(const su2double*, const su2double*, const su2double*, const su2double*, const su2double*, su2double*);
+template void CNumerics::GetInviscidProjFlux_Batch<3>(const su2double*, const su2double*, const su2double*, const su2double*, const su2double*, su2double*);
+template void CNumerics::GetInviscidProjJac_Batch<2>(const su2double*, const su2double*, const su2double*, su2double, su2double*);
+template void CNumerics::GetInviscidProjJac_Batch<3>(const su2double*, const su2double*, const su2double*, su2double, su2double*);
+template void CNumerics::GetPMatrix_Batch<2>(const su2double*, const su2double*, const su2double*, const su2double*, su2double*);
+template void CNumerics::GetPMatrix_Batch<3>(const su2double*, const su2double*, const su2double*, const su2double*, su2double*);
+template void CNumerics::GetPMatrix_inv_Batch<2>(const su2double*, const su2double*, const su2double*, const su2double*, su2double*);
+template void CNumerics::GetPMatrix_inv_Batch<3>(const su2double*, const su2double*, const su2double*, const su2double*, su2double*);
+
 void CNumerics::GetPMatrix_inv(su2double **val_invp_tensor, su2double *val_density, su2double *val_velocity,
     su2double *val_soundspeed, su2double *val_chi, su2double *val_kappa, su2double *val_normal) {
 
@@ -513,3 +513,234 @@ void COutput::SetCGNS_Solution(CConfig *config, CGeometry *geometry, unsigned sh
 #endif
   
 }
+
+void COutput::SetCGNS_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone) {
+  
+#ifdef HAVE_CGNS
+  
+  /*--- local CGNS variables ---*/
+  int cgns_file, cgns_base_par, cgns_zone_par, cgns_flow, cgns_section, cgns_coord, cgns_field, cgns_err;
+  cgsize_t isize[3][1], elem_start, elem_end, range_min, range_max;
+  
+  unsigned short iVar, iType, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  
+  unsigned long iPoint, iNode, iExtIter = config->GetExtIter();
+  unsigned long nGlobal_Poin_CGNS, nGlobal_Elem_CGNS = 0;
+  
+  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
+  
+  int iProcessor;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  char cstr[200], buffer[50];
+  string filename;
+  
+  /*--- Write file name with extension ---*/
+  
+  if (adjoint) filename = config->GetAdj_FileName();
+  else filename = config->GetFlow_FileName();
+  
+  strcpy (cstr, filename.c_str());
+  
+  /*--- Special cases where a number needs to be appended to the file name. ---*/
+  
+  if ((Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS ||
+       Kind_Solver == ADJ_EULER || Kind_Solver == ADJ_NAVIER_STOKES || Kind_Solver == ADJ_RANS ||
+       Kind_Solver == DISC_ADJ_EULER || Kind_Solver == DISC_ADJ_NAVIER_STOKES || Kind_Solver == DISC_ADJ_RANS) &&
+      (val_nZone > 1) ) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    strcat(cstr, buffer);
+  }
+  
+  if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady() && config->GetUnsteady_Simulation() != HARMONIC_BALANCE) {
+    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d.cgns", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d.cgns", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d.cgns", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d.cgns", SU2_TYPE::Int(iExtIter));
+    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d.cgns", SU2_TYPE::Int(iExtIter));
+  }
+  else { SPRINTF (buffer, ".cgns"); }
+  
+  strcat(cstr, buffer);
+  
+  /*--- Volume elements of this rank, one CGNS section per element type. The
+   nodes are global indices (starting at 1) of the points after the linear
+   partitioning, which is also the CGNS numbering of the vertices. ---*/
+  
+  const unsigned short nType = 6;
+  int *Conn_Type[nType];
+  unsigned long nElem_Type[nType];
+  unsigned short nNodes_Type[nType];
+  ElementType_t CGNS_Type[nType];
+  const char *Section_Name[nType];
+  const char *Coord_Name[3] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+  
+  Conn_Type[0] = Conn_Tria_Par; nElem_Type[0] = nParallel_Tria; nNodes_Type[0] = N_POINTS_TRIANGLE;      CGNS_Type[0] = TRI_3;   Section_Name[0] = "Triangle Elements";
+  Conn_Type[1] = Conn_Quad_Par; nElem_Type[1] = nParallel_Quad; nNodes_Type[1] = N_POINTS_QUADRILATERAL; CGNS_Type[1] = QUAD_4;  Section_Name[1] = "Quadrilateral Elements";
+  Conn_Type[2] = Conn_Tetr_Par; nElem_Type[2] = nParallel_Tetr; nNodes_Type[2] = N_POINTS_TETRAHEDRON;   CGNS_Type[2] = TETRA_4; Section_Name[2] = "Tetrahedral Elements";
+  Conn_Type[3] = Conn_Hexa_Par; nElem_Type[3] = nParallel_Hexa; nNodes_Type[3] = N_POINTS_HEXAHEDRON;    CGNS_Type[3] = HEXA_8;  Section_Name[3] = "Hexahedral Elements";
+  Conn_Type[4] = Conn_Pris_Par; nElem_Type[4] = nParallel_Pris; nNodes_Type[4] = N_POINTS_PRISM;         CGNS_Type[4] = PENTA_6; Section_Name[4] = "Prism Elements";
+  Conn_Type[5] = Conn_Pyra_Par; nElem_Type[5] = nParallel_Pyra; nNodes_Type[5] = N_POINTS_PYRAMID;       CGNS_Type[5] = PYRA_5;  Section_Name[5] = "Pyramid Elements";
+  
+  /*--- First global index of the points, and of the elements of each type,
+   of every rank (the last entry holds the global numbers). ---*/
+  
+  unsigned long *Point_Offset = new unsigned long[size+1];
+  unsigned long *Elem_Offset  = new unsigned long[(size+1)*nType];
+  
+  Point_Offset[0] = 0;
+  for (iType = 0; iType < nType; iType++) Elem_Offset[iType] = 0;
+#ifndef HAVE_MPI
+  Point_Offset[1] = nParallel_Poin;
+  for (iType = 0; iType < nType; iType++) Elem_Offset[nType+iType] = nElem_Type[iType];
+#else
+  SU2_MPI::Allgather(&nParallel_Poin, 1, MPI_UNSIGNED_LONG, &Point_Offset[1], 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(nElem_Type, nType, MPI_UNSIGNED_LONG, &Elem_Offset[nType], nType, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#endif
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    Point_Offset[iProcessor+1] += Point_Offset[iProcessor];
+    for (iType = 0; iType < nType; iType++)
+      Elem_Offset[(iProcessor+1)*nType+iType] += Elem_Offset[iProcessor*nType+iType];
+  }
+  nGlobal_Poin_CGNS = Point_Offset[size];
+  
+  /*--- The sections are numbered one after the other, as required by CGNS
+   (the element numbers are unique in a zone). ---*/
+  
+  unsigned long Section_Begin[nType];
+  for (iType = 0; iType < nType; iType++) {
+    Section_Begin[iType] = nGlobal_Elem_CGNS;
+    nGlobal_Elem_CGNS += Elem_Offset[size*nType+iType];
+  }
+  
+  /*--- The master creates the file with the zone, the (empty) sections sized
+   for all the elements and the solution node. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    cgns_err = cg_open(cstr, CG_MODE_WRITE, &cgns_file);
+    if (cgns_err) cg_error_print();
+    
+    cgns_err = cg_base_write(cgns_file, "SU2 Base", nDim, nDim, &cgns_base_par);
+    if (cgns_err) cg_error_print();
+    
+    isize[0][0] = (cgsize_t)nGlobal_Poin_CGNS;   // vertex size
+    isize[1][0] = (cgsize_t)nGlobal_Elem_CGNS;   // cell size
+    isize[2][0] = 0;                             // boundary vertex size (zero if elements not sorted)
+    
+    cgns_err = cg_zone_write(cgns_file, cgns_base_par, "SU2 Zone", isize[0], Unstructured, &cgns_zone_par);
+    if (cgns_err) cg_error_print();
+    
+    for (iType = 0; iType < nType; iType++) {
+      if (Elem_Offset[size*nType+iType] == 0) continue;
+      elem_start = (cgsize_t)(Section_Begin[iType]+1);
+      elem_end   = (cgsize_t)(Section_Begin[iType]+Elem_Offset[size*nType+iType]);
+      cgns_err = cg_section_partial_write(cgns_file, cgns_base_par, cgns_zone_par, Section_Name[iType],
+                                          CGNS_Type[iType], elem_start, elem_end, 0, &cgns_section);
+      if (cgns_err) cg_error_print();
+    }
+    
+    cgns_err = cg_sol_write(cgns_file, cgns_base_par, cgns_zone_par, "Solution", Vertex, &cgns_flow);
+    if (cgns_err) cg_error_print();
+    
+    cgns_err = cg_close(cgns_file);
+    if (cgns_err) cg_error_print();
+    
+  }
+  
+#ifdef HAVE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  
+  /*--- Each rank writes its range of the coordinates, of the elements and of
+   the solution fields. The ADF files of the bundled library can not be opened
+   by several processes at once, so the ranks take turns. ---*/
+  
+  passivedouble *Buffer_Data = new passivedouble[nParallel_Poin];
+  cgsize_t *Buffer_Conn = NULL;
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (rank == iProcessor) {
+      
+      cgns_err = cg_open(cstr, CG_MODE_MODIFY, &cgns_file);
+      if (cgns_err) cg_error_print();
+      
+      /*--- A single base, zone and solution were written above ---*/
+      
+      cgns_base_par = 1; cgns_zone_par = 1; cgns_flow = 1;
+      
+      range_min = (cgsize_t)(Point_Offset[rank]+1);
+      range_max = (cgsize_t)(Point_Offset[rank+1]);
+      
+      /*--- The coordinates are the first variables ---*/
+      
+      if (nParallel_Poin > 0) {
+        for (iVar = 0; iVar < nDim; iVar++) {
+          for (iPoint = 0; iPoint < nParallel_Poin; iPoint++)
+            Buffer_Data[iPoint] = SU2_TYPE::GetValue(Parallel_Data[iVar][iPoint]);
+          cgns_err = cg_coord_partial_write(cgns_file, cgns_base_par, cgns_zone_par, RealDouble, Coord_Name[iVar],
+                                            &range_min, &range_max, Buffer_Data, &cgns_coord);
+          if (cgns_err) cg_error_print();
+        }
+      }
+      
+      /*--- Connectivity, the sections are numbered in the order they were created ---*/
+      
+      cgns_section = 0;
+      for (iType = 0; iType < nType; iType++) {
+        if (Elem_Offset[size*nType+iType] == 0) continue;
+        cgns_section++;
+        if (nElem_Type[iType] == 0) continue;
+        
+        Buffer_Conn = new cgsize_t[nElem_Type[iType]*nNodes_Type[iType]];
+        for (iNode = 0; iNode < nElem_Type[iType]*nNodes_Type[iType]; iNode++)
+          Buffer_Conn[iNode] = (cgsize_t)Conn_Type[iType][iNode];
+        
+        elem_start = (cgsize_t)(Section_Begin[iType]+Elem_Offset[rank*nType+iType]+1);
+        elem_end   = elem_start + (cgsize_t)nElem_Type[iType] - 1;
+        cgns_err = cg_elements_partial_write(cgns_file, cgns_base_par, cgns_zone_par, cgns_section,
+                                             elem_start, elem_end, Buffer_Conn);
+        if (cgns_err) cg_error_print();
+        
+        delete [] Buffer_Conn;
+      }
+      
+      /*--- Solution fields, with the names of the variables registered for output ---*/
+      
+      if (nParallel_Poin > 0) {
+        for (iVar = nDim; iVar < nVar_Par; iVar++) {
+          for (iPoint = 0; iPoint < nParallel_Poin; iPoint++)
+            Buffer_Data[iPoint] = SU2_TYPE::GetValue(Parallel_Data[iVar][iPoint]);
+          cgns_err = cg_field_partial_write(cgns_file, cgns_base_par, cgns_zone_par, cgns_flow, RealDouble,
+                                            Variable_Names[iVar].c_str(), &range_min, &range_max,
+                                            Buffer_Data, &cgns_field);
+          if (cgns_err) cg_error_print();
+        }
+      }
+      
+      cgns_err = cg_close(cgns_file);
+      if (cgns_err) cg_error_print();
+      
+    }
+#ifdef HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  }
+  
+  delete [] Buffer_Data;
+  delete [] Point_Offset;
+  delete [] Elem_Offset;
+  
+#else // Not built with CGNS support
+  
+  cout << "CGNS file requested but SU2 was built without CGNS support. No file written" << "\n"; 
+  
+#endif
+  
+}
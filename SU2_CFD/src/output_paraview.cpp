@@ -1731,3 +1731,349 @@ void COutput::SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsign
   if (SurfacePoint != NULL) delete [] SurfacePoint;
   
 }
+
+void COutput::SetParaview_XML_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
+
+  unsigned short iVar, iDim, iType, nType, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+
+  unsigned long iPoint, iElem, iNode, nPoint_Piece, nElem_Piece, nConn_Piece, nLocal_Poin, Global_Index;
+  unsigned long iExtIter = config->GetExtIter(), Point_Begin = 0, nGhost_Poin, Offset, nBytes;
+
+  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
+
+  int iProcessor;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  char cstr[200], buffer[50];
+  string filename, piecename;
+  ofstream Paraview_File;
+
+  /*--- Write file name without extension, the master writes the parallel
+   file (.pvtu) and each rank its own piece (_rank.vtu). ---*/
+
+  if (surf_sol) {
+    if (adjoint) filename = config->GetSurfAdjCoeff_FileName();
+    else filename = config->GetSurfFlowCoeff_FileName();
+  }
+  else {
+    if (adjoint) filename = config->GetAdj_FileName();
+    else filename = config->GetFlow_FileName();
+  }
+
+  if (Kind_Solver == FEM_ELASTICITY) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+
+  if (Kind_Solver == WAVE_EQUATION) {
+    if (surf_sol) filename = config->GetSurfWave_FileName().c_str();
+    else filename = config->GetWave_FileName().c_str();
+  }
+
+  if (Kind_Solver == HEAT_EQUATION) {
+    if (surf_sol) filename = config->GetSurfHeat_FileName().c_str();
+    else filename = config->GetHeat_FileName().c_str();
+  }
+
+  if (Kind_Solver == POISSON_EQUATION) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+
+  if (config->GetKind_SU2() == SU2_DOT) {
+    if (surf_sol) filename = config->GetSurfSens_FileName();
+    else filename = config->GetVolSens_FileName();
+  }
+
+  strcpy (cstr, filename.c_str());
+
+  /*--- Special cases where a number needs to be appended to the file name. ---*/
+
+  if ((Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS ||
+       Kind_Solver == ADJ_EULER || Kind_Solver == ADJ_NAVIER_STOKES || Kind_Solver == ADJ_RANS ||
+       Kind_Solver == DISC_ADJ_EULER || Kind_Solver == DISC_ADJ_NAVIER_STOKES || Kind_Solver == DISC_ADJ_RANS) &&
+      (val_nZone > 1) ) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    strcat(cstr, buffer);
+  }
+
+  if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady() && config->GetUnsteady_Simulation() != HARMONIC_BALANCE) {
+    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d", SU2_TYPE::Int(iExtIter));
+    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d", SU2_TYPE::Int(iExtIter));
+    strcat(cstr, buffer);
+  }
+
+  filename = cstr;
+
+  /*--- The pieces are referenced from the parallel file without the directory ---*/
+
+  piecename = filename;
+  if (piecename.find_last_of("/") != string::npos)
+    piecename = piecename.substr(piecename.find_last_of("/")+1);
+
+  /*--- Elements of this rank (volume or surface), the VTK cell types are the
+   SU2 element types. The nodes are global indices (starting at 1) of the
+   points after the linear partitioning. ---*/
+
+  int *Conn_Type[6];
+  unsigned long nElem_Type[6];
+  unsigned short nNodes_Type[6], VTK_Type[6];
+
+  if (surf_sol) {
+    nType = 3;
+    Conn_Type[0] = Conn_Line_Par;      nElem_Type[0] = nParallel_Line;      nNodes_Type[0] = N_POINTS_LINE;          VTK_Type[0] = LINE;
+    Conn_Type[1] = Conn_BoundTria_Par; nElem_Type[1] = nParallel_BoundTria; nNodes_Type[1] = N_POINTS_TRIANGLE;      VTK_Type[1] = TRIANGLE;
+    Conn_Type[2] = Conn_BoundQuad_Par; nElem_Type[2] = nParallel_BoundQuad; nNodes_Type[2] = N_POINTS_QUADRILATERAL; VTK_Type[2] = QUADRILATERAL;
+  } else {
+    nType = 6;
+    Conn_Type[0] = Conn_Tria_Par; nElem_Type[0] = nParallel_Tria; nNodes_Type[0] = N_POINTS_TRIANGLE;      VTK_Type[0] = TRIANGLE;
+    Conn_Type[1] = Conn_Quad_Par; nElem_Type[1] = nParallel_Quad; nNodes_Type[1] = N_POINTS_QUADRILATERAL; VTK_Type[1] = QUADRILATERAL;
+    Conn_Type[2] = Conn_Tetr_Par; nElem_Type[2] = nParallel_Tetr; nNodes_Type[2] = N_POINTS_TETRAHEDRON;   VTK_Type[2] = TETRAHEDRON;
+    Conn_Type[3] = Conn_Hexa_Par; nElem_Type[3] = nParallel_Hexa; nNodes_Type[3] = N_POINTS_HEXAHEDRON;    VTK_Type[3] = HEXAHEDRON;
+    Conn_Type[4] = Conn_Pris_Par; nElem_Type[4] = nParallel_Pris; nNodes_Type[4] = N_POINTS_PRISM;         VTK_Type[4] = PRISM;
+    Conn_Type[5] = Conn_Pyra_Par; nElem_Type[5] = nParallel_Pyra; nNodes_Type[5] = N_POINTS_PYRAMID;       VTK_Type[5] = PYRAMID;
+  }
+
+  su2double **Data_Par = Parallel_Data;
+  nLocal_Poin = nParallel_Poin;
+  if (surf_sol) { Data_Par = Parallel_Surf_Data; nLocal_Poin = nSurf_Poin_Par; }
+
+  /*--- First global index of the points of each rank ---*/
+
+  unsigned long *Point_Offset = new unsigned long[size+1];
+  Point_Offset[0] = 0;
+#ifndef HAVE_MPI
+  Point_Offset[1] = nLocal_Poin;
+#else
+  SU2_MPI::Allgather(&nLocal_Poin, 1, MPI_UNSIGNED_LONG, &Point_Offset[1], 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    Point_Offset[iProcessor+1] += Point_Offset[iProcessor];
+#endif
+  Point_Begin = Point_Offset[rank];
+
+  /*--- The elements of this rank may use points of the neighbouring ranks,
+   these are appended to the piece after the points of the rank (and flagged
+   as duplicate points for Paraview). ---*/
+
+  map<unsigned long, unsigned long> Ghost_Index;
+  map<unsigned long, unsigned long>::iterator it;
+
+  nElem_Piece = 0; nConn_Piece = 0;
+  for (iType = 0; iType < nType; iType++) {
+    for (iNode = 0; iNode < nElem_Type[iType]*nNodes_Type[iType]; iNode++) {
+      Global_Index = Conn_Type[iType][iNode]-1;
+      if ((Global_Index < Point_Begin) || (Global_Index >= Point_Begin+nLocal_Poin))
+        Ghost_Index[Global_Index] = 0;
+    }
+    nElem_Piece += nElem_Type[iType];
+    nConn_Piece += nElem_Type[iType]*nNodes_Type[iType];
+  }
+
+  nGhost_Poin = 0;
+  for (it = Ghost_Index.begin(); it != Ghost_Index.end(); it++)
+    it->second = nLocal_Poin + nGhost_Poin++;
+  nPoint_Piece = nLocal_Poin + nGhost_Poin;
+
+  /*--- Values of the points of the piece, the variables are contiguous ---*/
+
+  passivedouble *Piece_Data = new passivedouble[nPoint_Piece*nVar_Par];
+  for (iPoint = 0; iPoint < nLocal_Poin; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Piece_Data[iPoint*nVar_Par+iVar] = SU2_TYPE::GetValue(Data_Par[iVar][iPoint]);
+
+#ifdef HAVE_MPI
+
+  /*--- Request the values of the ghost points to their ranks. The map is
+   sorted by global index, so that the requests are grouped by rank. ---*/
+
+  int *nPoint_Send = new int[size], *nPoint_Recv = new int[size];
+  int *Send_Disp = new int[size], *Recv_Disp = new int[size];
+  unsigned long *Ghost_Send = new unsigned long[nGhost_Poin];
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) nPoint_Send[iProcessor] = 0;
+  iProcessor = 0; iPoint = 0;
+  for (it = Ghost_Index.begin(); it != Ghost_Index.end(); it++) {
+    while (it->first >= Point_Offset[iProcessor+1]) iProcessor++;
+    nPoint_Send[iProcessor]++;
+    Ghost_Send[iPoint++] = it->first;
+  }
+
+  MPI_Alltoall(nPoint_Send, 1, MPI_INT, nPoint_Recv, 1, MPI_INT, MPI_COMM_WORLD);
+
+  Send_Disp[0] = 0; Recv_Disp[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Send_Disp[iProcessor] = Send_Disp[iProcessor-1] + nPoint_Send[iProcessor-1];
+    Recv_Disp[iProcessor] = Recv_Disp[iProcessor-1] + nPoint_Recv[iProcessor-1];
+  }
+  unsigned long nPoint_Request = Recv_Disp[size-1] + nPoint_Recv[size-1];
+
+  unsigned long *Ghost_Recv = new unsigned long[nPoint_Request];
+  MPI_Alltoallv(Ghost_Send, nPoint_Send, Send_Disp, MPI_UNSIGNED_LONG,
+                Ghost_Recv, nPoint_Recv, Recv_Disp, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Answer with the values of the requested points ---*/
+
+  passivedouble *Reply_Data = new passivedouble[nPoint_Request*nVar_Par];
+  for (iPoint = 0; iPoint < nPoint_Request; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Reply_Data[iPoint*nVar_Par+iVar] = Piece_Data[(Ghost_Recv[iPoint]-Point_Begin)*nVar_Par+iVar];
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nPoint_Send[iProcessor] *= nVar_Par; Send_Disp[iProcessor] *= nVar_Par;
+    nPoint_Recv[iProcessor] *= nVar_Par; Recv_Disp[iProcessor] *= nVar_Par;
+  }
+  MPI_Alltoallv(Reply_Data, nPoint_Recv, Recv_Disp, MPI_DOUBLE,
+                &Piece_Data[nLocal_Poin*nVar_Par], nPoint_Send, Send_Disp, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  delete [] nPoint_Send; delete [] nPoint_Recv;
+  delete [] Send_Disp;   delete [] Recv_Disp;
+  delete [] Ghost_Send;  delete [] Ghost_Recv;
+  delete [] Reply_Data;
+
+#endif
+
+  /*--- Connectivity of the piece with the local numbering ---*/
+
+  long *Piece_Conn = new long[nConn_Piece], *Piece_Offset = new long[nElem_Piece];
+  unsigned char *Piece_Type = new unsigned char[nElem_Piece];
+
+  nConn_Piece = 0; nElem_Piece = 0;
+  for (iType = 0; iType < nType; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      for (iNode = 0; iNode < nNodes_Type[iType]; iNode++) {
+        Global_Index = Conn_Type[iType][iElem*nNodes_Type[iType]+iNode]-1;
+        if ((Global_Index >= Point_Begin) && (Global_Index < Point_Begin+nLocal_Poin))
+          Piece_Conn[nConn_Piece++] = Global_Index - Point_Begin;
+        else
+          Piece_Conn[nConn_Piece++] = Ghost_Index[Global_Index];
+      }
+      Piece_Offset[nElem_Piece] = nConn_Piece;
+      Piece_Type[nElem_Piece++] = VTK_Type[iType];
+    }
+  }
+
+  /*--- Data blocks of the appended section, each one is preceded by its
+   size in bytes. The coordinates are the first variables. ---*/
+
+  const char *Byte_Order = "LittleEndian";
+  int Endian_Test = 1;
+  if (*(char *)&Endian_Test == 0) Byte_Order = "BigEndian";
+
+  SPRINTF (buffer, "_%d.vtu", rank);
+  Paraview_File.open((filename+buffer).c_str(), ios::out | ios::binary);
+
+  Paraview_File << "<?xml version=\"1.0\"?>\n";
+  Paraview_File << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << Byte_Order << "\" header_type=\"UInt64\">\n";
+  Paraview_File << "<UnstructuredGrid>\n";
+  Paraview_File << "<Piece NumberOfPoints=\"" << nPoint_Piece << "\" NumberOfCells=\"" << nElem_Piece << "\">\n";
+
+  Offset = 0;
+  Paraview_File << "<PointData>\n";
+  for (iVar = nDim; iVar < nVar_Par; iVar++) {
+    Paraview_File << "<DataArray type=\"Float64\" Name=\"" << Variable_Names[iVar] << "\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+    Offset += sizeof(unsigned long) + nPoint_Piece*sizeof(passivedouble);
+  }
+  Paraview_File << "<DataArray type=\"UInt8\" Name=\"vtkGhostType\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned long) + nPoint_Piece*sizeof(unsigned char);
+  Paraview_File << "</PointData>\n";
+
+  Paraview_File << "<Points>\n";
+  Paraview_File << "<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned long) + 3*nPoint_Piece*sizeof(passivedouble);
+  Paraview_File << "</Points>\n";
+
+  Paraview_File << "<Cells>\n";
+  Paraview_File << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned long) + nConn_Piece*sizeof(long);
+  Paraview_File << "<DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Offset += sizeof(unsigned long) + nElem_Piece*sizeof(long);
+  Paraview_File << "<DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << Offset << "\"/>\n";
+  Paraview_File << "</Cells>\n";
+
+  Paraview_File << "</Piece>\n";
+  Paraview_File << "</UnstructuredGrid>\n";
+  Paraview_File << "<AppendedData encoding=\"raw\">\n_";
+
+  /*--- Each variable is written from a buffer of the points of the piece ---*/
+
+  passivedouble *Var_Buffer = new passivedouble[3*nPoint_Piece];
+
+  nBytes = nPoint_Piece*sizeof(passivedouble);
+  for (iVar = nDim; iVar < nVar_Par; iVar++) {
+    for (iPoint = 0; iPoint < nPoint_Piece; iPoint++)
+      Var_Buffer[iPoint] = Piece_Data[iPoint*nVar_Par+iVar];
+    Paraview_File.write((char *)&nBytes, sizeof(unsigned long));
+    Paraview_File.write((char *)Var_Buffer, nBytes);
+  }
+
+  unsigned char *Ghost_Type = new unsigned char[nPoint_Piece];
+  for (iPoint = 0; iPoint < nPoint_Piece; iPoint++)
+    Ghost_Type[iPoint] = (iPoint < nLocal_Poin)? 0 : 1;
+  nBytes = nPoint_Piece*sizeof(unsigned char);
+  Paraview_File.write((char *)&nBytes, sizeof(unsigned long));
+  Paraview_File.write((char *)Ghost_Type, nBytes);
+  delete [] Ghost_Type;
+
+  for (iPoint = 0; iPoint < nPoint_Piece; iPoint++) {
+    for (iDim = 0; iDim < 3; iDim++) Var_Buffer[iPoint*3+iDim] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Var_Buffer[iPoint*3+iDim] = Piece_Data[iPoint*nVar_Par+iDim];
+  }
+  nBytes = 3*nPoint_Piece*sizeof(passivedouble);
+  Paraview_File.write((char *)&nBytes, sizeof(unsigned long));
+  Paraview_File.write((char *)Var_Buffer, nBytes);
+
+  nBytes = nConn_Piece*sizeof(long);
+  Paraview_File.write((char *)&nBytes, sizeof(unsigned long));
+  Paraview_File.write((char *)Piece_Conn, nBytes);
+  nBytes = nElem_Piece*sizeof(long);
+  Paraview_File.write((char *)&nBytes, sizeof(unsigned long));
+  Paraview_File.write((char *)Piece_Offset, nBytes);
+  nBytes = nElem_Piece*sizeof(unsigned char);
+  Paraview_File.write((char *)&nBytes, sizeof(unsigned long));
+  Paraview_File.write((char *)Piece_Type, nBytes);
+
+  Paraview_File << "\n</AppendedData>\n";
+  Paraview_File << "</VTKFile>\n";
+  Paraview_File.close();
+
+  /*--- The master writes the parallel file with the list of pieces ---*/
+
+  if (rank == MASTER_NODE) {
+
+    Paraview_File.open((filename+".pvtu").c_str(), ios::out);
+    Paraview_File << "<?xml version=\"1.0\"?>\n";
+    Paraview_File << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << Byte_Order << "\" header_type=\"UInt64\">\n";
+    Paraview_File << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+    Paraview_File << "<PPointData>\n";
+    for (iVar = nDim; iVar < nVar_Par; iVar++)
+      Paraview_File << "<PDataArray type=\"Float64\" Name=\"" << Variable_Names[iVar] << "\"/>\n";
+    Paraview_File << "<PDataArray type=\"UInt8\" Name=\"vtkGhostType\"/>\n";
+    Paraview_File << "</PPointData>\n";
+    Paraview_File << "<PPoints>\n";
+    Paraview_File << "<PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n";
+    Paraview_File << "</PPoints>\n";
+    for (iProcessor = 0; iProcessor < size; iProcessor++)
+      Paraview_File << "<Piece Source=\"" << piecename << "_" << iProcessor << ".vtu\"/>\n";
+    Paraview_File << "</PUnstructuredGrid>\n";
+    Paraview_File << "</VTKFile>\n";
+    Paraview_File.close();
+
+  }
+
+  delete [] Var_Buffer;
+  delete [] Piece_Data;
+  delete [] Piece_Conn;
+  delete [] Piece_Offset;
+  delete [] Piece_Type;
+  delete [] Point_Offset;
+
+}
@@ -3755,14 +3755,14 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     }
     
     if ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
+      if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
         restart_file << "\t\"Pressure\"\t\"Temperature\"\t\"Pressure_Coefficient\"\t\"Mach\"";
       } else
         restart_file << "\t\"Pressure\"\t\"Temperature\"\t\"C<sub>p</sub>\"\t\"Mach\"";
     }
     
     if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
+      if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
         if (nDim == 2) restart_file << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Heat_Flux\"\t\"Y_Plus\"";
         if (nDim == 3) restart_file << "\t\"Laminar_Viscosity\"\t\"Skin_Friction_Coefficient_X\"\t\"Skin_Friction_Coefficient_Y\"\t\"Skin_Friction_Coefficient_Z\"\t\"Heat_Flux\"\t\"Y_Plus\"";
       } else {
@@ -3772,7 +3772,7 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     }
     
     if (Kind_Solver == RANS) {
-      if (config->GetOutput_FileFormat() == PARAVIEW) {
+      if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
         restart_file << "\t\"Eddy_Viscosity\"";
       } else
         restart_file << "\t\"<greek>m</greek><sub>t</sub>\"";
@@ -3995,6 +3995,7 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config) {
   else if ((config->GetOutput_FileFormat() == TECPLOT_BINARY) ||
            (config->GetOutput_FileFormat() == FIELDVIEW_BINARY))  SPRINTF (buffer, ".plt");
   else if (config->GetOutput_FileFormat() == PARAVIEW)  SPRINTF (buffer, ".vtk");
+  else if (config->GetOutput_FileFormat() == PARAVIEW_XML)  SPRINTF (buffer, ".csv");
   strcat(cstr, buffer);
   
   ConvHist_file->open(cstr, ios::out);
@@ -6155,7 +6156,16 @@ void COutput::SetForces_Breakdown(CGeometry ***geometry,
     Breakdown_file <<"-- Input conditions:"<< "\n";
     
     if (compressible) {
-      switch (config[val_iZone]->GetKind_FluidModel()) {
+      
+      unsigned short Kind_FluidModel = config[val_iZone]->GetKind_FluidModel();
+      
+      if (Kind_FluidModel == LUT_GAS) {
+        Breakdown_file << "Fluid Model: Look-up table, pressure " << config[val_iZone]->GetLUT_Pressure_Limits(0) << " to " << config[val_iZone]->GetLUT_Pressure_Limits(1);
+        Breakdown_file << " Pa, temperature " << config[val_iZone]->GetLUT_Temperature_Limits(0) << " to " << config[val_iZone]->GetLUT_Temperature_Limits(1) << " K." << "\n";
+        Kind_FluidModel = config[val_iZone]->GetKind_LUT_FluidModel();
+      }
+      
+      switch (Kind_FluidModel) {
           
         case STANDARD_AIR:
           Breakdown_file << "Fluid Model: STANDARD_AIR "<< "\n";
@@ -7113,13 +7123,22 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
     bool Wrt_Vol = config[iZone]->GetWrt_Vol_Sol();
     bool Wrt_Srf = config[iZone]->GetWrt_Srf_Sol();
     bool Wrt_Csv = config[iZone]->GetWrt_Csv_Sol();
+    bool Wrt_Binary_Restart = config[iZone]->GetWrt_Binary_Restart();
+    
+    /*--- Get the file output format ---*/
+    
+    unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
+    
+    /*--- The Paraview XML and CGNS files are written in parallel by all the ranks ---*/
+    
+    bool Wrt_Parallel_Sol = ((FileFormat == PARAVIEW_XML) || (FileFormat == CGNS_SOL)) && (Wrt_Vol || Wrt_Srf);
 
 #ifdef HAVE_MPI
     /*--- Do not merge the volume solutions if we are running in parallel.
      Force the use of SU2_SOL to merge the volume sols in this case. ---*/
     
     MPI_Comm_size(MPI_COMM_WORLD, &size);
-    if (size > SINGLE_NODE) {
+    if ((size > SINGLE_NODE) && (!Wrt_Parallel_Sol)) {
       Wrt_Vol = false;
       Wrt_Srf = false;
     }
@@ -7141,9 +7160,84 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
         
     }
     
-    /*--- Get the file output format ---*/
+    /*--- A binary restart file and the Paraview XML or CGNS files are written
+     by all the ranks, from the local data after a linear partitioning, so that
+     the solution is never merged in the master node. ---*/
     
-    unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
+    if (Wrt_Binary_Restart || Wrt_Parallel_Sol) {
+      
+      if (rank == MASTER_NODE) cout << "Loading solution output data locally on each rank." << endl;
+      
+      switch (config[iZone]->GetKind_Solver()) {
+        case EULER : case NAVIER_STOKES: case RANS :
+          LoadLocalData_Flow(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        case ADJ_EULER : case ADJ_NAVIER_STOKES : case ADJ_RANS :
+        case DISC_ADJ_EULER: case DISC_ADJ_NAVIER_STOKES: case DISC_ADJ_RANS:
+          LoadLocalData_AdjFlow(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        case FEM_ELASTICITY:
+          LoadLocalData_Elasticity(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        case POISSON_EQUATION: case WAVE_EQUATION: case HEAT_EQUATION:
+          LoadLocalData_Base(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        default: break;
+      }
+      
+      if (rank == MASTER_NODE) cout << "Sorting output data across all ranks." << endl;
+      SortOutputData(config[iZone], geometry[iZone][MESH_0]);
+      
+      if (Wrt_Binary_Restart) {
+        if (rank == MASTER_NODE) cout << "Writing SU2 native binary restart file." << endl;
+        SetRestart_Parallel_Binary(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+      }
+      
+      if (Wrt_Parallel_Sol) {
+        
+        /*--- Sort the connectivity into linearly partitioned chunks of elements,
+         and the surface data with its own renumbering. ---*/
+        
+        if (rank == MASTER_NODE) cout << "Preparing element connectivity across all ranks." << endl;
+        SortConnectivity(config[iZone], geometry[iZone][MESH_0], iZone);
+        if (Wrt_Srf && (FileFormat == PARAVIEW_XML)) SortOutputData_Surface(config[iZone], geometry[iZone][MESH_0]);
+        
+        if (Wrt_Vol) {
+          if (FileFormat == CGNS_SOL) {
+            if (rank == MASTER_NODE) cout << "Writing CGNS volume solution file." << endl;
+            SetCGNS_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone);
+          } else {
+            if (rank == MASTER_NODE) cout << "Writing Paraview XML volume solution files." << endl;
+            SetParaview_XML_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
+          }
+          DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], false);
+        }
+        
+        /*--- There is no CGNS surface solution file. ---*/
+        
+        if (Wrt_Srf && (FileFormat == CGNS_SOL)) {
+          DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], true);
+        }
+        
+        if (Wrt_Srf && (FileFormat == PARAVIEW_XML)) {
+          if (rank == MASTER_NODE) cout << "Writing Paraview XML surface solution files." << endl;
+          SetParaview_XML_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
+          DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], true);
+          DeallocateSurfaceData_Parallel(config[iZone], geometry[iZone][MESH_0]);
+        }
+        
+        Wrt_Vol = false; Wrt_Srf = false;
+        
+      }
+      
+      DeallocateData_Parallel(config[iZone], geometry[iZone][MESH_0]);
+      Variable_Names.clear();
+      
+      /*--- Nothing else to be merged if the restart file is already written ---*/
+      
+      if (Wrt_Binary_Restart && !Wrt_Vol && !Wrt_Srf) continue;
+      
+    }
     
     /*--- Merge the node coordinates and connectivity, if necessary. This
      is only performed if a volume solution file is requested, and it
@@ -7186,8 +7280,10 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
       
       /*--- Write a native restart file ---*/
       
-      if (rank == MASTER_NODE) cout << "Writing SU2 native restart file." << endl;
-      SetRestart(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0] , iZone);
+      if (!Wrt_Binary_Restart) {
+        if (rank == MASTER_NODE) cout << "Writing SU2 native restart file." << endl;
+        SetRestart(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0] , iZone);
+      }
       
       if (Wrt_Vol) {
         
@@ -7561,9 +7657,12 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
       
       if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
       
-      /*--- Write a .su2 ASCII file ---*/
+      /*--- Write a .su2 ASCII or binary file ---*/
       
-      if (su2_file) SetSU2_MeshASCII(config[iZone], geometry[iZone]);
+      if (su2_file) {
+        if (config[iZone]->GetMesh_Out_FileFormat() == SU2_BINARY) SetSU2_MeshBinary(config[iZone], geometry[iZone]);
+        else SetSU2_MeshASCII(config[iZone], geometry[iZone]);
+      }
       
       /*--- Deallocate connectivity ---*/
       
@@ -8889,13 +8988,13 @@ void COutput::WriteSurface_Analysis(CConfig *config, CGeometry *geometry, CSolve
 
   ofstream SurfFlow_file;
 
-  if (config->GetOutput_FileFormat() == PARAVIEW) strcpy (cstr, "surface_analysis.vtk");
+  if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) strcpy (cstr, "surface_analysis.vtk");
   else strcpy (cstr, "surface_analysis.dat");
   
   SurfFlow_file.precision(15);
   SurfFlow_file.open(cstr, ios::out);
 
-  if (config->GetOutput_FileFormat() == PARAVIEW) {
+  if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
     SurfFlow_file << "# vtk DataFile Version 3.0" << endl;
     SurfFlow_file << "vtk output" << endl;
     SurfFlow_file << "ASCII" << endl;
@@ -9580,7 +9679,7 @@ void COutput::WriteSurface_Analysis(CConfig *config, CGeometry *geometry, CSolve
       }
     }
 
-    if (config->GetOutput_FileFormat() == PARAVIEW) {
+    if ((config->GetOutput_FileFormat() == PARAVIEW) || (config->GetOutput_FileFormat() == PARAVIEW_XML)) {
       
       SurfFlow_file << "\nDATASET UNSTRUCTURED_GRID" << endl;
       SurfFlow_file <<"POINTS " << nAngle*nStation << " float" << endl;
@@ -10129,12 +10228,17 @@ void COutput::SetResult_Files_Parallel(CSolver ****solver_container,
       cout << "Sorting output data across all ranks." << endl;
     SortOutputData(config[iZone], geometry[iZone][MESH_0]);
     
-    /*--- Write parallel ASCII restart files. This will be replaced with
-     a binary alternative with MPI-IO soon. ---*/
+    /*--- Write parallel restart files, either ASCII or binary with MPI-IO. ---*/
     
-    if (rank == MASTER_NODE)
-      cout << "Writing SU2 native restart file." << endl;
-    SetRestart_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    if (config[iZone]->GetWrt_Binary_Restart()) {
+      if (rank == MASTER_NODE)
+        cout << "Writing SU2 native binary restart file." << endl;
+      SetRestart_Parallel_Binary(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    } else {
+      if (rank == MASTER_NODE)
+        cout << "Writing SU2 native restart file." << endl;
+      SetRestart_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    }
     
     /*--- Get the file output format ---*/
     
@@ -14585,7 +14689,6 @@ void COutput::SortOutputData_Surface(CConfig *config, CGeometry *geometry) {
     Conn_BoundTria_Par[iNode+0] = (int)Global2Renumber[Conn_BoundTria_Par[iNode+0]-1];
     Conn_BoundTria_Par[iNode+1] = (int)Global2Renumber[Conn_BoundTria_Par[iNode+1]-1];
     Conn_BoundTria_Par[iNode+2] = (int)Global2Renumber[Conn_BoundTria_Par[iNode+2]-1];
-    Conn_BoundTria_Par[iNode+2] = (int)Global2Renumber[Conn_BoundTria_Par[iNode+2]-1];
   }
   
   for (iElem = 0; iElem < nParallel_BoundQuad; iElem++) {
@@ -14753,6 +14856,151 @@ void COutput::SetRestart_Parallel(CConfig *config, CGeometry *geometry, CSolver
   
 }
 
+void COutput::SetRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone) {
+
+  /*--- Local variables ---*/
+
+  unsigned short nZone = geometry->GetnZone();
+  unsigned short iVar;
+  unsigned long iPoint, iExtIter = config->GetExtIter(), myPoint = 0, offset = 0, Header[2];
+  bool fem       = (config->GetKind_Solver() == FEM_ELASTICITY);
+  bool adjoint   = (config->GetContinuous_Adjoint() ||
+                    config->GetDiscrete_Adjoint());
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  char *Names;
+  passivedouble *Restart_Buffer, Restart_Meta[SU2_RESTART_META_SIZE];
+  string filename;
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  /*--- Retrieve filename from config ---*/
+
+  if ((config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint())) {
+    filename = config->GetRestart_AdjFileName();
+    filename = config->GetObjFunc_Extension(filename);
+  } else if (fem) {
+    filename = config->GetRestart_FEMFileName();
+  } else {
+    filename = config->GetRestart_FlowFileName();
+  }
+
+  /*--- Append the zone number if multizone problems ---*/
+  if (nZone > 1)
+    filename= config->GetMultizone_FileName(filename, val_iZone);
+
+  /*--- Unsteady problems require an iteration number to be appended. ---*/
+  if (config->GetUnsteady_Simulation() == HARMONIC_BALANCE) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(val_iZone));
+  } else if (config->GetWrt_Unsteady()) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  } else if ((fem) && (config->GetWrt_Dynamic())) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  }
+
+  /*--- After the linear partitioning, each rank owns a contiguous range of
+   global indices, its first point is the sum of the points of the previous
+   ranks. Only the original domain points are written. ---*/
+
+#ifdef HAVE_MPI
+  MPI_Scan(&nParallel_Poin, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  offset -= nParallel_Poin;
+#endif
+
+  for (iPoint = 0; iPoint < nParallel_Poin; iPoint++)
+    if (iPoint + offset < geometry->GetGlobal_nPointDomain()) myPoint++;
+
+  /*--- Records of the points, the variables of each point are contiguous ---*/
+
+  Restart_Buffer = new passivedouble[myPoint*nVar_Par];
+  for (iPoint = 0; iPoint < myPoint; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Restart_Buffer[iPoint*nVar_Par+iVar] = SU2_TYPE::GetValue(Parallel_Data[iVar][iPoint]);
+
+  /*--- Header (identifier, number of variables and of points), names of the
+   variables with a fixed length, and the general flow conditions. ---*/
+
+  Header[0] = nVar_Par;
+  Header[1] = geometry->GetGlobal_nPointDomain();
+
+  Names = new char[nVar_Par*SU2_BINARY_TAG_SIZE];
+  for (iPoint = 0; iPoint < nVar_Par*SU2_BINARY_TAG_SIZE; iPoint++) Names[iPoint] = '\0';
+  for (iVar = 0; iVar < nVar_Par; iVar++)
+    strncpy(&Names[iVar*SU2_BINARY_TAG_SIZE], Variable_Names[iVar].c_str(), SU2_BINARY_TAG_SIZE-1);
+
+  for (iVar = 0; iVar < SU2_RESTART_META_SIZE; iVar++) Restart_Meta[iVar] = 0.0;
+  Restart_Meta[0] = SU2_TYPE::GetValue(config->GetAoA() - config->GetAoA_Offset());
+  Restart_Meta[1] = SU2_TYPE::GetValue(config->GetAoS() - config->GetAoS_Offset());
+  Restart_Meta[2] = SU2_TYPE::GetValue(config->GetInitial_BCThrust());
+  Restart_Meta[3] = SU2_TYPE::GetValue(config->GetdCD_dCL());
+  if (adjoint) Restart_Meta[4] = SU2_TYPE::GetValue(solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0);
+  if (dual_time)
+    Restart_Meta[5] = config->GetExtIter() + 1;
+  else
+    Restart_Meta[5] = config->GetExtIter() + config->GetExtIter_OffSet() + 1;
+
+  unsigned long Data_Offset = SU2_BINARY_MAGIC_SIZE + 2*sizeof(unsigned long) + nVar_Par*SU2_BINARY_TAG_SIZE;
+
+#ifndef HAVE_MPI
+
+  ofstream restart_file;
+  restart_file.open(filename.c_str(), ios::out | ios::binary);
+  restart_file.write(SU2_RESTART_MAGIC, SU2_BINARY_MAGIC_SIZE);
+  restart_file.write((char *)Header, 2*sizeof(unsigned long));
+  restart_file.write(Names, nVar_Par*SU2_BINARY_TAG_SIZE);
+  restart_file.write((char *)Restart_Buffer, myPoint*nVar_Par*sizeof(passivedouble));
+  restart_file.write((char *)Restart_Meta, SU2_RESTART_META_SIZE*sizeof(passivedouble));
+  restart_file.close();
+
+#else
+
+  /*--- All the ranks open the file, which is truncated in case it exists ---*/
+
+  MPI_File fhw;
+  MPI_Status status;
+  MPI_Offset disp;
+  unsigned long Meta_Offset = Data_Offset + Header[1]*nVar_Par*sizeof(passivedouble);
+  int ierr;
+
+  ierr = MPI_File_open(MPI_COMM_WORLD, (char *)filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "Unable to open the restart file " << filename << "." << endl;
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  MPI_File_set_size(fhw, 0);
+
+  /*--- The master node writes the header and the general flow conditions ---*/
+
+  if (rank == MASTER_NODE) {
+    MPI_File_write_at(fhw, 0, (void *)SU2_RESTART_MAGIC, SU2_BINARY_MAGIC_SIZE, MPI_CHAR, &status);
+    disp = SU2_BINARY_MAGIC_SIZE;
+    MPI_File_write_at(fhw, disp, Header, 2, MPI_UNSIGNED_LONG, &status);
+    disp += 2*sizeof(unsigned long);
+    MPI_File_write_at(fhw, disp, Names, nVar_Par*SU2_BINARY_TAG_SIZE, MPI_CHAR, &status);
+    disp = Meta_Offset;
+    MPI_File_write_at(fhw, disp, Restart_Meta, SU2_RESTART_META_SIZE, MPI_DOUBLE, &status);
+  }
+
+  /*--- Collective write of the contiguous block of records of each rank ---*/
+
+  disp = Data_Offset + offset*nVar_Par*sizeof(passivedouble);
+  MPI_File_write_at_all(fhw, disp, Restart_Buffer, myPoint*nVar_Par, MPI_DOUBLE, &status);
+
+  MPI_File_close(&fhw);
+
+#endif
+
+  delete [] Restart_Buffer;
+  delete [] Names;
+
+}
+
 void COutput::DeallocateConnectivity_Parallel(CConfig *config, CGeometry *geometry, bool surf_sol) {
   
   /*--- Deallocate memory for connectivity data on each processor. ---*/
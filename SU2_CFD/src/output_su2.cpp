@@ -242,4 +242,192 @@ void COutput::SetSU2_MeshASCII(CConfig *config, CGeometry *geometry) {
   
 }
 
-void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) { }
+void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) {
+  
+  char cstr[MAX_STRING_SIZE], Tag[SU2_BINARY_TAG_SIZE];
+  unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, nElem, iNode, iChunk, nChunk, Chunk_Min = 0, Chunk_Max = 0,
+  Position, Header[SU2_BINARY_HEADER_SIZE], Marker_Header[2], Bound_Record[SU2_BINARY_BOUND_RECORD], Elem_Record[N_POINTS_HEXAHEDRON+1];
+  unsigned short iMarker, iDim, nDim = geometry->GetnDim(), iChar, iPeriodic, nPeriodic, iType, nMarker_;
+  passivedouble Angle_Offset[2], Transform[9], Coord;
+  su2double *center, *angles, *transl;
+  ofstream output_file;
+  ifstream input_file;
+  string text_line, Marker_Tag, str;
+  string::size_type position;
+  vector<unsigned long> Chunk_Index;
+  
+  /*--- The interior elements are written by type, in the same order as the ASCII file ---*/
+  
+  int *Conn_Type[6] = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+  unsigned long nElem_Type[6] = {nGlobal_Tria, nGlobal_Quad, nGlobal_Tetr, nGlobal_Hexa, nGlobal_Pris, nGlobal_Pyra};
+  unsigned long VTK_Type[6] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  unsigned short nNodes_Type[6] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+    N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  
+  /*--- Read the name of the output file ---*/
+  
+  str = config->GetMesh_Out_FileName();
+  strcpy (cstr, str.c_str());
+  output_file.open(cstr, ios::out | ios::binary);
+  
+  /*--- The header is written at the end, once the offsets of the sections are known ---*/
+  
+  for (iNode = 0; iNode < SU2_BINARY_HEADER_SIZE; iNode++) Header[iNode] = 0;
+  output_file.write(SU2_BINARY_MAGIC, SU2_BINARY_MAGIC_SIZE);
+  output_file.write((char *)Header, SU2_BINARY_HEADER_SIZE*sizeof(unsigned long));
+  Angle_Offset[0] = SU2_TYPE::GetValue(config->GetAoA_Offset());
+  Angle_Offset[1] = SU2_TYPE::GetValue(config->GetAoS_Offset());
+  output_file.write((char *)Angle_Offset, 2*sizeof(passivedouble));
+  
+  /*--- Write the node coordinates, contiguous by point ---*/
+  
+  Header[9] = output_file.tellp();
+  for (iPoint = 0; iPoint < nGlobal_Doma; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord = SU2_TYPE::GetValue(Coords[iDim][iPoint]);
+      output_file.write((char *)&Coord, sizeof(passivedouble));
+    }
+  }
+  
+  /*--- Write the connectivity, each element is the VTK type followed by its
+   nodes. The index of the blocks of elements keeps the position of the first
+   element and the range of the nodes of the block. ---*/
+  
+  Header[11] = output_file.tellp();
+  nElem = 0; Position = 0;
+  for (iType = 0; iType < 6; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+  
+      if (nElem % SU2_BINARY_CHUNK_SIZE == 0) {
+        if (nElem > 0) { Chunk_Index.push_back(Chunk_Min); Chunk_Index.push_back(Chunk_Max); }
+        Chunk_Index.push_back(Position);
+        Chunk_Min = nGlobal_Doma; Chunk_Max = 0;
+      }
+  
+      Elem_Record[0] = VTK_Type[iType];
+      for (iNode = 0; iNode < nNodes_Type[iType]; iNode++) {
+        Elem_Record[iNode+1] = Conn_Type[iType][iElem*nNodes_Type[iType]+iNode]-1;
+        Chunk_Min = min(Chunk_Min, Elem_Record[iNode+1]);
+        Chunk_Max = max(Chunk_Max, Elem_Record[iNode+1]);
+      }
+      output_file.write((char *)Elem_Record, (nNodes_Type[iType]+1)*sizeof(unsigned long));
+  
+      Position += nNodes_Type[iType]+1;
+      nElem++;
+    }
+  }
+  if (nElem > 0) { Chunk_Index.push_back(Chunk_Min); Chunk_Index.push_back(Chunk_Max); }
+  nChunk = Chunk_Index.size()/3;
+  
+  Header[10] = output_file.tellp();
+  for (iChunk = 0; iChunk < 3*nChunk; iChunk++)
+    output_file.write((char *)&Chunk_Index[iChunk], sizeof(unsigned long));
+  
+  /*--- Write the boundary information (read from the file written by
+   the geometry), each marker is the tag, the number of elements and the
+   SEND_TO value, followed by fixed size records of the elements ---*/
+  
+  Header[12] = output_file.tellp();
+  nMarker_ = 0;
+  
+  input_file.open("boundary.su2", ios::in);
+  
+  while (getline (input_file, text_line)) {
+  
+    position = text_line.find ("NMARK=",0);
+    if (position != string::npos) {
+  
+      text_line.erase (0,6); nMarker_ = atoi(text_line.c_str());
+  
+      for (iMarker = 0 ; iMarker < nMarker_; iMarker++) {
+  
+        getline (input_file, text_line);
+        text_line.erase (0,11);
+        for (iChar = 0; iChar < 20; iChar++) {
+          position = text_line.find( " ", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\r", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\n", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+        }
+        Marker_Tag = text_line.c_str();
+  
+        getline (input_file, text_line);
+        text_line.erase (0,13); nElem_Bound_ = atoi(text_line.c_str());
+  
+        for (iChar = 0; iChar < SU2_BINARY_TAG_SIZE; iChar++) Tag[iChar] = '\0';
+        strncpy(Tag, Marker_Tag.c_str(), SU2_BINARY_TAG_SIZE-1);
+        Marker_Header[0] = nElem_Bound_;
+        Marker_Header[1] = 0;
+        if (Marker_Tag == "SEND_RECEIVE") Marker_Header[1] = (long)config->GetMarker_All_SendRecv(iMarker);
+        output_file.write(Tag, SU2_BINARY_TAG_SIZE);
+        output_file.write((char *)Marker_Header, 2*sizeof(unsigned long));
+  
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+  
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+  
+          for (iNode = 0; iNode < SU2_BINARY_BOUND_RECORD; iNode++) Bound_Record[iNode] = 0;
+          bound_line >> Bound_Record[0];
+  
+          switch(Bound_Record[0]) {
+            case LINE: case VERTEX:
+              bound_line >> Bound_Record[1]; bound_line >> Bound_Record[2];
+              break;
+            case TRIANGLE:
+              bound_line >> Bound_Record[1]; bound_line >> Bound_Record[2]; bound_line >> Bound_Record[3];
+              break;
+            case QUADRILATERAL:
+              bound_line >> Bound_Record[1]; bound_line >> Bound_Record[2]; bound_line >> Bound_Record[3]; bound_line >> Bound_Record[4];
+              break;
+          }
+          output_file.write((char *)Bound_Record, SU2_BINARY_BOUND_RECORD*sizeof(unsigned long));
+        }
+      }
+    }
+  
+  }
+  
+  input_file.close();
+  
+  remove("boundary.su2");
+  
+  /*--- Write the periodic transformations (center, rotation, translation) ---*/
+  
+  Header[13] = output_file.tellp();
+  nPeriodic = config->GetnPeriodicIndex();
+  
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    center = config->GetPeriodicCenter(iPeriodic);
+    angles = config->GetPeriodicRotation(iPeriodic);
+    transl = config->GetPeriodicTranslate(iPeriodic);
+    for (iDim = 0; iDim < 3; iDim++) {
+      Transform[iDim]   = SU2_TYPE::GetValue(center[iDim]);
+      Transform[3+iDim] = SU2_TYPE::GetValue(angles[iDim]);
+      Transform[6+iDim] = SU2_TYPE::GetValue(transl[iDim]);
+    }
+    output_file.write((char *)Transform, 9*sizeof(passivedouble));
+  }
+  
+  /*--- Header with the sizes and the offsets of the sections ---*/
+  
+  Header[0] = SU2_BINARY_VERSION;
+  Header[1] = nDim;
+  Header[2] = nGlobal_Doma;
+  Header[3] = nGlobal_Doma;
+  if (geometry->GetGlobal_nPointDomain() != nGlobal_Doma)
+    Header[3] = geometry->GetGlobal_nPointDomain();
+  Header[4] = nElem;
+  Header[5] = SU2_BINARY_CHUNK_SIZE;
+  Header[6] = nChunk;
+  Header[7] = nMarker_;
+  Header[8] = nPeriodic;
+  
+  output_file.seekp(SU2_BINARY_MAGIC_SIZE);
+  output_file.write((char *)Header, SU2_BINARY_HEADER_SIZE*sizeof(unsigned long));
+  
+  output_file.close();
+  
+}
@@ -47,11 +47,9 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
 
   bool restart = config->GetRestart();
 
-  unsigned long iVertex, iPoint, index;
-  string text_line, mesh_filename;
-  ifstream restart_file;
+  unsigned long iVertex, iPoint;
+  string mesh_filename;
   string filename, AdjExt;
-  su2double dull_val;
   bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
 
@@ -149,29 +147,10 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
     mesh_filename = config->GetSolution_AdjFileName();
     filename = config->GetObjFunc_Extension(mesh_filename);
 
-    restart_file.open(filename.data(), ios::in);
+    /*--- Read the restart file (ASCII or binary), the values of the
+     points of this rank are kept in the restart data. ---*/
 
-    /*--- In case there is no file ---*/
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no adjoint restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    }
-
-    /*--- Read all lines in the restart file ---*/
-    long iPoint_Local; unsigned long iPoint_Global = 0; unsigned long iPoint_Global_Local = 0;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
+    Read_SU2_Restart(geometry, config, filename);
 
     /*--- Skip coordinates ---*/
     unsigned short skipVars = nDim;
@@ -186,54 +165,15 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
       }
     }
 
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-        
-        iPoint_Local = Global2Local[iPoint_Global];
-        
-        point_line >> index;
-        for (iVar = 0; iVar < skipVars; iVar++) { point_line >> dull_val;}
-        for (iVar = 0; iVar < nVar; iVar++) { point_line >> Solution[iVar];}
-        node[iPoint_Local] = new CDiscAdjVariable(Solution, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-      
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        Solution[iVar] = Restart_Data[iPoint*nRestart_Fields+skipVars+iVar];
+      node[iPoint] = new CDiscAdjVariable(Solution, nDim, nVar, config);
     }
 
-    /*--- Detect a wrong solution file ---*/
-    
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
-    }
+    /*--- Free memory needed for the restart data ---*/
+
+    delete [] Restart_Data; Restart_Data = NULL;
 
     /*--- Instantiate the variable class with an arbitrary solution
      at any halo/periodic nodes. The initial solution can be arbitrary,
@@ -242,9 +182,6 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
       node[iPoint] = new CDiscAdjVariable(Solution, nDim, nVar, config);
     }
 
-    /*--- Close the restart file ---*/
-    restart_file.close();
-
   }
 
   /*--- Store the direct solution ---*/
@@ -95,6 +95,19 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
  
   Secondary = NULL; Secondary_i = NULL; Secondary_j = NULL;
 
+  nThread = 1; ThreadNumerics = NULL;
+  Thread_Vector_i = NULL; Thread_Vector_j = NULL;
+  Thread_Primitive_i = NULL; Thread_Primitive_j = NULL;
+  Thread_Secondary_i = NULL; Thread_Secondary_j = NULL;
+  Thread_Residual = NULL; Thread_Jacobian_i = NULL; Thread_Jacobian_j = NULL;
+  Thread_Batch = NULL;
+
+  Overlap_MPI = false; Pending_MPI_Gradient = false; Pending_MPI_Limiter = false;
+
+  Storage_Solution = NULL; Storage_Solution_Old = NULL; Storage_Limiter = NULL;
+  Storage_Primitive = NULL; Storage_Gradient_Primitive = NULL;
+  Storage_Limiter_Primitive = NULL; Storage_Gradient_Rows = NULL;
+
   /*--- Fixed CL mode initialization (cauchy criteria) ---*/
   
   Cauchy_Value = 0;
@@ -160,11 +173,10 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
 
 CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
   
-  unsigned long iPoint, index, counter_local = 0, counter_global = 0, iVertex;
+  unsigned long iPoint, counter_local = 0, counter_global = 0, iVertex;
   unsigned short iVar, iDim, iMarker, nLineLets;
-  su2double StaticEnergy, Density, Velocity2, Pressure, Temperature, dull_val;
+  su2double StaticEnergy, Density, Velocity2, Pressure, Temperature;
   int Unst_RestartIter;
-  ifstream restart_file;
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
   bool restart = (config->GetRestart() || config->GetRestart_Flow());
@@ -173,11 +185,8 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     bool time_stepping = config->GetUnsteady_Simulation() == TIME_STEPPING;
     bool roe_turkel = (config->GetKind_Upwind_Flow() == TURKEL);
   bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
-  su2double AoA_, AoS_, BCThrust_;
   string filename = config->GetSolution_FlowFileName();
   string filename_ = config->GetSolution_FlowFileName();
-  string::size_type position;
-  unsigned long ExtIter_;
   bool rans = ((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS));
   unsigned short direct_diff = config->GetDirectDiff();
   unsigned short nMarkerTurboPerf = config->Get_nMarkerTurboPerf();
@@ -213,102 +222,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
       filename_ = config->GetUnsteady_FileName(filename_, Unst_RestartIter);
     }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename_.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename_.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    unsigned long iPoint_Global = 0;
-    string text_line;
-    
-    /*--- The first line is the header (General description) ---*/
-    
-    getline (restart_file, text_line);
-    
-    /*--- Space for the solution ---*/
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-    }
-    
-    /*--- Space for extra info (if any) ---*/
-    
-    while (getline (restart_file, text_line)) {
-      
-      /*--- Angle of attack ---*/
-      
-      position = text_line.find ("AOA=",0);
-      if (position != string::npos) {
-        text_line.erase (0,4); AoA_ = atof(text_line.c_str());
-        if (config->GetDiscard_InFiles() == false) {
-          if ((config->GetAoA() != AoA_) &&  (rank == MASTER_NODE)) {
-            cout.precision(6);
-            cout << fixed <<"WARNING: AoA in the solution file (" << AoA_ << " deg.) +" << endl;
-            cout << "         AoA offset in mesh file (" << config->GetAoA_Offset() << " deg.) = " << AoA_ + config->GetAoA_Offset() << " deg." << endl;
-          }
-          config->SetAoA(AoA_ + config->GetAoA_Offset());
-        }
-        else {
-          if ((config->GetAoA() != AoA_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: Discarding the AoA in the solution file." << endl;
-        }
-      }
-      
-      /*--- Sideslip angle ---*/
-      
-      position = text_line.find ("SIDESLIP_ANGLE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,15); AoS_ = atof(text_line.c_str());
-        if (config->GetDiscard_InFiles() == false) {
-          if ((config->GetAoS() != AoS_) &&  (rank == MASTER_NODE)) {
-            cout.precision(6);
-            cout << fixed <<"WARNING: AoS in the solution file (" << AoS_ << " deg.) +" << endl;
-            cout << "         AoS offset in mesh file (" << config->GetAoS_Offset() << " deg.) = " << AoS_ + config->GetAoS_Offset() << " deg." << endl;
-          }
-          config->SetAoS(AoS_ + config->GetAoS_Offset());
-        }
-        else {
-          if ((config->GetAoS() != AoS_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: Discarding the AoS in the solution file." << endl;
-        }
-      }
-      
-      /*--- BCThrust angle ---*/
-      
-      position = text_line.find ("INITIAL_BCTHRUST=",0);
-      if (position != string::npos) {
-        text_line.erase (0,17); BCThrust_ = atof(text_line.c_str());
-        if (config->GetDiscard_InFiles() == false) {
-          if ((config->GetInitial_BCThrust() != BCThrust_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: ACDC will use the initial BC Thrust provided in the solution file: " << BCThrust_ << " lbs." << endl;
-          config->SetInitial_BCThrust(BCThrust_);
-        }
-        else {
-          if ((config->GetInitial_BCThrust() != BCThrust_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: Discarding the BC Thrust in the solution file." << endl;
-        }
-      }
-      
-      /*--- External iteration ---*/
-      
-      position = text_line.find ("EXT_ITER=",0);
-      if (position != string::npos) {
-        text_line.erase (0,9); ExtIter_ = atoi(text_line.c_str());
-        if (!config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint())
-          config->SetExtIter_OffSet(ExtIter_);
-      }
-      
-    }
-    
-    /*--- Close the restart file... we will open this file again... ---*/
+    /*--- Read and store the restart metadata ---*/
     
-    restart_file.close();
+    Read_SU2_Restart_Metadata(geometry, config, filename_);
     
   }
 
@@ -567,6 +483,15 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     if (rank == MASTER_NODE) cout << "Explicit scheme. No Jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
   }
   
+  /*--- Auxiliary vectors of the additional threads for the edge loops ---*/
+  
+  SetThreadWorkspace(config);
+  
+  /*--- The halo exchanges are completed right away unless the
+   preprocessing overlaps them with the convective residual ---*/
+  
+  Overlap_MPI = false; Pending_MPI_Gradient = false; Pending_MPI_Limiter = false;
+  
   /*--- Define some auxiliary vectors for computing flow variable
    gradients by least squares, S matrix := inv(R)*traspose(inv(R)),
    c vector := transpose(WA)*(Wb) ---*/
@@ -968,86 +893,19 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
 
-        /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
-    
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    
-    /*--- Read all lines in the restart file ---*/
-    
-    long iPoint_Local;
-    unsigned long iPoint_Global_Local = 0, iPoint_Global = 0; string text_line;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-    
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    /*--- Solution ---*/
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-      
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-      
-      iPoint_Local = Global2Local[iPoint_Global];
-      
-      /*--- Load the solution for this node. Note that the first entry
-       on the restart file line is the global index, followed by the
-       node coordinates, and then the conservative variables. ---*/
-      
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3] >> Solution[4];
-
-        node[iPoint_Local] = new CEulerVariable(Solution, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-
-    }
+    /*--- Read the restart file (ASCII or binary), the values of the
+     points of this rank are kept in the restart data. ---*/
     
-    /*--- Detect a wrong solution file ---*/
+    Read_SU2_Restart(geometry, config, filename);
     
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
+    /*--- Load the solution of each point. Note that the first fields of
+     the restart file are the node coordinates, followed by the
+     conservative variables. ---*/
     
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        Solution[iVar] = Restart_Data[iPoint*nRestart_Fields+nDim+iVar];
+      node[iPoint] = new CEulerVariable(Solution, nDim, nVar, config);
     }
     
     /*--- Instantiate the variable class with an arbitrary solution
@@ -1057,9 +915,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
       node[iPoint] = new CEulerVariable(Solution, nDim, nVar, config);
     
-    /*--- Close the restart file ---*/
+    /*--- Free memory needed for the restart data ---*/
     
-    restart_file.close();
+    delete [] Restart_Data; Restart_Data = NULL;
     
   }
   
@@ -1109,6 +967,10 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 
 
   
+  /*--- Store the variables of all the points in contiguous blocks ---*/
+  
+  SetContiguous_Storage(config);
+  
   /*--- Define solver parameters needed for execution of destructor ---*/
   
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED ) space_centered = true;
@@ -1220,6 +1082,49 @@ CEulerSolver::~CEulerSolver(void) {
   if (Secondary_i != NULL)      delete [] Secondary_i;
   if (Secondary_j != NULL)      delete [] Secondary_j;
 
+  /*--- The vectors of thread 0 are the ones of the solver, deleted above ---*/
+
+  if (ThreadNumerics != NULL) delete [] ThreadNumerics;
+  for (unsigned short iThread = 1; iThread < nThread; iThread++) {
+    delete [] Thread_Vector_i[iThread];    delete [] Thread_Vector_j[iThread];
+    delete [] Thread_Primitive_i[iThread]; delete [] Thread_Primitive_j[iThread];
+    delete [] Thread_Secondary_i[iThread]; delete [] Thread_Secondary_j[iThread];
+    delete [] Thread_Residual[iThread];
+    if (Thread_Jacobian_i[iThread] != NULL) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        delete [] Thread_Jacobian_i[iThread][iVar];
+        delete [] Thread_Jacobian_j[iThread][iVar];
+      }
+      delete [] Thread_Jacobian_i[iThread];
+      delete [] Thread_Jacobian_j[iThread];
+    }
+  }
+  if (Thread_Vector_i    != NULL) delete [] Thread_Vector_i;
+  if (Thread_Vector_j    != NULL) delete [] Thread_Vector_j;
+  if (Thread_Primitive_i != NULL) delete [] Thread_Primitive_i;
+  if (Thread_Primitive_j != NULL) delete [] Thread_Primitive_j;
+  if (Thread_Secondary_i != NULL) delete [] Thread_Secondary_i;
+  if (Thread_Secondary_j != NULL) delete [] Thread_Secondary_j;
+  if (Thread_Residual    != NULL) delete [] Thread_Residual;
+  if (Thread_Jacobian_i  != NULL) delete [] Thread_Jacobian_i;
+  if (Thread_Jacobian_j  != NULL) delete [] Thread_Jacobian_j;
+  if (Thread_Batch != NULL) {
+    for (unsigned short iThread = 0; iThread < nThread; iThread++)
+      delete [] Thread_Batch[iThread];
+    delete [] Thread_Batch;
+  }
+
+  /*--- Contiguous blocks of the variables, the nodes are deleted afterwards
+   by CSolver and they do not release this storage ---*/
+
+  if (Storage_Solution           != NULL) delete [] Storage_Solution;
+  if (Storage_Solution_Old       != NULL) delete [] Storage_Solution_Old;
+  if (Storage_Limiter            != NULL) delete [] Storage_Limiter;
+  if (Storage_Primitive          != NULL) delete [] Storage_Primitive;
+  if (Storage_Gradient_Primitive != NULL) delete [] Storage_Gradient_Primitive;
+  if (Storage_Limiter_Primitive  != NULL) delete [] Storage_Limiter_Primitive;
+  if (Storage_Gradient_Rows      != NULL) delete [] Storage_Gradient_Rows;
+
   if (LowMach_Precontioner != NULL) {
     for (iVar = 0; iVar < nVar; iVar ++)
       delete [] LowMach_Precontioner[iVar];
@@ -1369,10 +1274,260 @@ CEulerSolver::~CEulerSolver(void) {
   
 }
 
+void CEulerSolver::SetThreadWorkspace(CConfig *config) {
+  
+  unsigned short iThread, iVar;
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  
+  nThread = SU2_OMP_GetMaxThreads();
+  
+  ThreadNumerics     = new CNumerics** [nThread];
+  Thread_Vector_i    = new su2double* [nThread];
+  Thread_Vector_j    = new su2double* [nThread];
+  Thread_Primitive_i = new su2double* [nThread];
+  Thread_Primitive_j = new su2double* [nThread];
+  Thread_Secondary_i = new su2double* [nThread];
+  Thread_Secondary_j = new su2double* [nThread];
+  Thread_Residual    = new su2double* [nThread];
+  Thread_Jacobian_i  = new su2double** [nThread];
+  Thread_Jacobian_j  = new su2double** [nThread];
+  Thread_Batch       = new su2double* [nThread];
+  
+  /*--- Thread 0 works with the auxiliary vectors of the solver, so that the
+   serial edge loops are not modified. The numerics of the other threads are
+   set by the driver (SetThreadNumerics). ---*/
+  
+  ThreadNumerics[0]     = NULL;
+  Thread_Vector_i[0]    = Vector_i;    Thread_Vector_j[0]    = Vector_j;
+  Thread_Primitive_i[0] = Primitive_i; Thread_Primitive_j[0] = Primitive_j;
+  Thread_Secondary_i[0] = Secondary_i; Thread_Secondary_j[0] = Secondary_j;
+  Thread_Residual[0]    = Res_Conv;
+  Thread_Jacobian_i[0]  = Jacobian_i;  Thread_Jacobian_j[0]  = Jacobian_j;
+  
+  for (iThread = 1; iThread < nThread; iThread++) {
+    ThreadNumerics[iThread]     = NULL;
+    Thread_Vector_i[iThread]    = new su2double [nDim];
+    Thread_Vector_j[iThread]    = new su2double [nDim];
+    Thread_Primitive_i[iThread] = new su2double [nPrimVar];
+    Thread_Primitive_j[iThread] = new su2double [nPrimVar];
+    Thread_Secondary_i[iThread] = new su2double [nSecondaryVar];
+    Thread_Secondary_j[iThread] = new su2double [nSecondaryVar];
+    Thread_Residual[iThread]    = new su2double [nVar];
+    Thread_Jacobian_i[iThread]  = NULL;
+    Thread_Jacobian_j[iThread]  = NULL;
+    if (implicit) {
+      Thread_Jacobian_i[iThread] = new su2double* [nVar];
+      Thread_Jacobian_j[iThread] = new su2double* [nVar];
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Thread_Jacobian_i[iThread][iVar] = new su2double [nVar];
+        Thread_Jacobian_j[iThread][iVar] = new su2double [nVar];
+      }
+    }
+  }
+  
+  /*--- Each thread (thread 0 included) packs the edges of a batch for the
+   batched convective numerics: the first nDim+4 primitive variables of the
+   points i and j, the normal, and the residual and Jacobians computed for them. ---*/
+  
+  for (iThread = 0; iThread < nThread; iThread++)
+    Thread_Batch[iThread] = new su2double [EDGE_BATCH_SIZE*(2*(nDim+4)+nDim+nVar+2*nVar*nVar)];
+  
+}
+
+void CEulerSolver::SetContiguous_Storage(CConfig *config) {
+  
+  unsigned long iPoint;
+  unsigned short iVar;
+  
+  Storage_Solution = NULL; Storage_Solution_Old = NULL; Storage_Limiter = NULL;
+  Storage_Primitive = NULL; Storage_Gradient_Primitive = NULL;
+  Storage_Limiter_Primitive = NULL; Storage_Gradient_Rows = NULL;
+  
+  if (!config->GetContiguous_Storage()) return;
+  
+  /*--- One allocation per field, with the values of each point stored
+   consecutively (point-major). The nodes keep their pointer accessors
+   (GetSolution, GetPrimitive, GetGradient_Primitive, ...), which now point
+   into these blocks, so that the edge loops read neighbouring memory. ---*/
+  
+  Storage_Solution           = new su2double [nPoint*nVar];
+  Storage_Solution_Old       = new su2double [nPoint*nVar];
+  Storage_Limiter            = new su2double [nPoint*nVar];
+  Storage_Primitive          = new su2double [nPoint*nPrimVar];
+  Storage_Gradient_Primitive = new su2double [nPoint*nPrimVarGrad*nDim];
+  Storage_Limiter_Primitive  = new su2double [nPoint*nPrimVarGrad];
+  Storage_Gradient_Rows      = new su2double* [nPoint*nPrimVarGrad];
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Storage_Gradient_Rows[iPoint*nPrimVarGrad+iVar] = &Storage_Gradient_Primitive[(iPoint*nPrimVarGrad+iVar)*nDim];
+    
+    node[iPoint]->SetContiguous_Solution(&Storage_Solution[iPoint*nVar],
+                                         &Storage_Solution_Old[iPoint*nVar],
+                                         &Storage_Limiter[iPoint*nVar]);
+    node[iPoint]->SetContiguous_Primitive(&Storage_Primitive[iPoint*nPrimVar],
+                                          &Storage_Gradient_Rows[iPoint*nPrimVarGrad],
+                                          &Storage_Limiter_Primitive[iPoint*nPrimVarGrad]);
+  }
+  
+}
+
 void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iPeriodic_Index;
+  unsigned long iPos, iPoint;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  
+  CHaloExchange *Halo = geometry->GetHaloExchange(config);
+  
+  /*--- Pack the solution that should be sended ---*/
+  Buffer_Send_U = Halo->GetBuffer_Send(nVar);
+  for (iPos = 0; iPos < Halo->GetnPoint_Send(); iPos++) {
+    iPoint = Halo->GetPoint_Send(iPos);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer_Send_U[iPos*nVar+iVar] = node[iPoint]->GetSolution(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbours at once ---*/
+  Halo->InitiateComms(nVar);
+  Halo->CompleteComms(nVar);
+  
+  Buffer_Receive_U = Halo->GetBuffer_Recv(nVar);
+  
+  /*--- Do the coordinate transformation ---*/
+  for (iPos = 0; iPos < Halo->GetnPoint_Recv(); iPos++) {
+    
+    /*--- Find point and its type of transformation ---*/
+    iPoint = Halo->GetPoint_Recv(iPos);
+    iPeriodic_Index = Halo->GetRotation_Type_Recv(iPos);
+    
+    /*--- Retrieve the supplied periodic information. ---*/
+    angles = config->GetPeriodicRotation(iPeriodic_Index);
+    
+    /*--- Store angles separately for clarity. ---*/
+    theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+    cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+    sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+    
+    /*--- Compute the rotation matrix. Note that the implicit
+     ordering is rotation about the x-axis, y-axis,
+     then z-axis. Note that this is the transpose of the matrix
+     used during the preprocessing stage. ---*/
+    rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+    
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Buffer_Receive_U[iPos*nVar+iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    if (nDim == 2) {
+      Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[0][1]*Buffer_Receive_U[iPos*nVar+2];
+      Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[1][1]*Buffer_Receive_U[iPos*nVar+2];
+    }
+    else {
+      Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[0][1]*Buffer_Receive_U[iPos*nVar+2] +
+      rotMatrix[0][2]*Buffer_Receive_U[iPos*nVar+3];
+      Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[1][1]*Buffer_Receive_U[iPos*nVar+2] +
+      rotMatrix[1][2]*Buffer_Receive_U[iPos*nVar+3];
+      Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[2][1]*Buffer_Receive_U[iPos*nVar+2] +
+      rotMatrix[2][2]*Buffer_Receive_U[iPos*nVar+3];
+    }
+    
+    /*--- Copy transformed conserved variables back into buffer. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetSolution(iVar, Solution[iVar]);
+    
+  }
+  
+}
+
+void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iPeriodic_Index;
+  unsigned long iPos, iPoint;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  
+  CHaloExchange *Halo = geometry->GetHaloExchange(config);
+  
+  /*--- Pack the solution old that should be sended ---*/
+  Buffer_Send_U = Halo->GetBuffer_Send(nVar);
+  for (iPos = 0; iPos < Halo->GetnPoint_Send(); iPos++) {
+    iPoint = Halo->GetPoint_Send(iPos);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer_Send_U[iPos*nVar+iVar] = node[iPoint]->GetSolution_Old(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbours at once ---*/
+  Halo->InitiateComms(nVar);
+  Halo->CompleteComms(nVar);
+  
+  Buffer_Receive_U = Halo->GetBuffer_Recv(nVar);
+  
+  /*--- Do the coordinate transformation ---*/
+  for (iPos = 0; iPos < Halo->GetnPoint_Recv(); iPos++) {
+    
+    /*--- Find point and its type of transformation ---*/
+    iPoint = Halo->GetPoint_Recv(iPos);
+    iPeriodic_Index = Halo->GetRotation_Type_Recv(iPos);
+    
+    /*--- Retrieve the supplied periodic information. ---*/
+    angles = config->GetPeriodicRotation(iPeriodic_Index);
+    
+    /*--- Store angles separately for clarity. ---*/
+    theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+    cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+    sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+    
+    /*--- Compute the rotation matrix. Note that the implicit
+     ordering is rotation about the x-axis, y-axis,
+     then z-axis. Note that this is the transpose of the matrix
+     used during the preprocessing stage. ---*/
+    rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+    
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Buffer_Receive_U[iPos*nVar+iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    if (nDim == 2) {
+      Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[0][1]*Buffer_Receive_U[iPos*nVar+2];
+      Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[1][1]*Buffer_Receive_U[iPos*nVar+2];
+    }
+    else {
+      Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[0][1]*Buffer_Receive_U[iPos*nVar+2] +
+      rotMatrix[0][2]*Buffer_Receive_U[iPos*nVar+3];
+      Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[1][1]*Buffer_Receive_U[iPos*nVar+2] +
+      rotMatrix[1][2]*Buffer_Receive_U[iPos*nVar+3];
+      Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[iPos*nVar+1] +
+      rotMatrix[2][1]*Buffer_Receive_U[iPos*nVar+2] +
+      rotMatrix[2][2]*Buffer_Receive_U[iPos*nVar+3];
+    }
+    
+    /*--- Copy transformed conserved variables back into buffer. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetSolution_Old(iVar, Solution[iVar]);
+    
+  }
+  
+}
+
+void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
+  *Buffer_Receive_Undivided_Laplacian = NULL, *Buffer_Send_Undivided_Laplacian = NULL;
   
 #ifdef HAVE_MPI
   int send_to, receive_from;
@@ -1395,34 +1550,34 @@ void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
       nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
       
       /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
+      Buffer_Receive_Undivided_Laplacian = new su2double [nBufferR_Vector];
+      Buffer_Send_Undivided_Laplacian = new su2double[nBufferS_Vector];
       
-      /*--- Copy the solution that should be sended ---*/
+      /*--- Copy the solution old that should be sended ---*/
       for (iVertex = 0; iVertex < nVertexS; iVertex++) {
         iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
         for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
+          Buffer_Send_Undivided_Laplacian[iVar*nVertexS+iVertex] = node[iPoint]->GetUndivided_Laplacian(iVar);
       }
       
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
+                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
       /*--- Receive information without MPI ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
         for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
+          Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex] = Buffer_Send_Undivided_Laplacian[iVar*nVertexR+iVertex];
       }
       
 #endif
       
       /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
+      delete [] Buffer_Send_Undivided_Laplacian;
       
       /*--- Do the coordinate transformation ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
@@ -1449,35 +1604,35 @@ void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
         
         /*--- Copy conserved variables before performing transformation. ---*/
         for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
+          Solution[iVar] = Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex];
         
         /*--- Rotate the momentum components. ---*/
         if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
+          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
+          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
+          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
+          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
         }
         else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
+          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
+          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
+          rotMatrix[0][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
+          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
+          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
+          rotMatrix[1][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
+          Solution[3] = rotMatrix[2][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
+          rotMatrix[2][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
+          rotMatrix[2][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
         }
         
         /*--- Copy transformed conserved variables back into buffer. ---*/
         for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Solution[iVar]);
+          node[iPoint]->SetUndivided_Laplacian(iVar, Solution[iVar]);
         
       }
       
       /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
+      delete [] Buffer_Receive_Undivided_Laplacian;
       
     }
     
@@ -1485,11 +1640,10 @@ void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
   
 }
 
-void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
+void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
+  unsigned short iMarker, MarkerS, MarkerR, *Buffer_Receive_Neighbor = NULL, *Buffer_Send_Neighbor = NULL;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
   
 #ifdef HAVE_MPI
   int send_to, receive_from;
@@ -1509,282 +1663,50 @@ void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
 #endif
       
       nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
+      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
       
       /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
+      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
+      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
+      Buffer_Receive_Neighbor = new unsigned short [nBufferR_Vector];
+      Buffer_Send_Neighbor = new unsigned short[nBufferS_Vector];
       
       /*--- Copy the solution old that should be sended ---*/
       for (iVertex = 0; iVertex < nVertexS; iVertex++) {
         iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
+        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetLambda();
+        Buffer_Send_Neighbor[iVertex] = geometry->node[iPoint]->GetnPoint();
       }
       
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
+                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Neighbor, nBufferS_Vector, MPI_UNSIGNED_SHORT, send_to, 1,
+                        Buffer_Receive_Neighbor, nBufferR_Vector, MPI_UNSIGNED_SHORT, receive_from, 1, MPI_COMM_WORLD, &status);
       
 #else
       
       /*--- Receive information without MPI ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
+        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
+        Buffer_Receive_Neighbor[iVertex] = Buffer_Send_Neighbor[iVertex];
       }
       
 #endif
       
       /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
+      delete [] Buffer_Send_Lambda;
+      delete [] Buffer_Send_Neighbor;
       
       /*--- Do the coordinate transformation ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
         
         /*--- Find point and its type of transformation ---*/
         iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Undivided_Laplacian = NULL, *Buffer_Send_Undivided_Laplacian = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Undivided_Laplacian = new su2double [nBufferR_Vector];
-      Buffer_Send_Undivided_Laplacian = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Undivided_Laplacian[iVar*nVertexS+iVertex] = node[iPoint]->GetUndivided_Laplacian(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex] = Buffer_Send_Undivided_Laplacian[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Undivided_Laplacian;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetUndivided_Laplacian(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Undivided_Laplacian;
-      
-    }
-    
-  }
-  
-}
-
-void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR, *Buffer_Receive_Neighbor = NULL, *Buffer_Send_Neighbor = NULL;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      Buffer_Receive_Neighbor = new unsigned short [nBufferR_Vector];
-      Buffer_Send_Neighbor = new unsigned short[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetLambda();
-        Buffer_Send_Neighbor[iVertex] = geometry->node[iPoint]->GetnPoint();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_Neighbor, nBufferS_Vector, MPI_UNSIGNED_SHORT, send_to, 1,
-                        Buffer_Receive_Neighbor, nBufferR_Vector, MPI_UNSIGNED_SHORT, receive_from, 1, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-        Buffer_Receive_Neighbor[iVertex] = Buffer_Send_Neighbor[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      delete [] Buffer_Send_Neighbor;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetLambda(Buffer_Receive_Lambda[iVertex]);
-        geometry->node[iPoint]->SetnNeighbor(Buffer_Receive_Neighbor[iVertex]);
+        node[iPoint]->SetLambda(Buffer_Receive_Lambda[iVertex]);
+        geometry->node[iPoint]->SetnNeighbor(Buffer_Receive_Neighbor[iVertex]);
         
       }
       
@@ -1904,253 +1826,9 @@ void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *confi
       /*--- Copy the solution old that should be sended ---*/
       for (iVertex = 0; iVertex < nVertexS; iVertex++) {
         iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
-}
-
-void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
-  
-  su2double *Limiter = new su2double [nVar];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-        }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Limiter[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
-  }
-  
-  delete [] Limiter;
-  
-}
-
-void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  MPI_Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad*nDim;        nBufferR_Vector = nVertexR*nPrimVarGrad*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iVar = 0; iVar < nVar; iVar++)
           for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
       }
       
 #ifdef HAVE_MPI
@@ -2163,9 +1841,9 @@ void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *conf
       
       /*--- Receive information without MPI ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iVar = 0; iVar < nVar; iVar++)
           for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
+            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
       }
       
 #endif
@@ -2197,27 +1875,27 @@ void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *conf
         rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
         
         /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iVar = 0; iVar < nVar; iVar++)
           for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
         
         /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        for (iVar = 0; iVar < nVar; iVar++) {
           if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
           }
           else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
           }
         }
         
         /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iVar = 0; iVar < nVar; iVar++)
           for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient[iVar][iDim]);
+            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
         
       }
       
@@ -2228,19 +1906,19 @@ void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *conf
     
   }
   
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+  for (iVar = 0; iVar < nVar; iVar++)
     delete [] Gradient[iVar];
   delete [] Gradient;
   
 }
 
-void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
   *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
   
-  su2double *Limiter = new su2double [nPrimVarGrad];
+  su2double *Limiter = new su2double [nVar];
   
 #ifdef HAVE_MPI
   int send_to, receive_from;
@@ -2260,7 +1938,7 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
 #endif
       
       nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad;        nBufferR_Vector = nVertexR*nPrimVarGrad;
+      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
       
       /*--- Allocate Receive and send buffers  ---*/
       Buffer_Receive_Limit = new su2double [nBufferR_Vector];
@@ -2269,8 +1947,8 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
       /*--- Copy the solution old that should be sended ---*/
       for (iVertex = 0; iVertex < nVertexS; iVertex++) {
         iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter_Primitive(iVar);
+        for (iVar = 0; iVar < nVar; iVar++)
+          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
       }
       
 #ifdef HAVE_MPI
@@ -2283,7 +1961,7 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
       
       /*--- Receive information without MPI ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iVar = 0; iVar < nVar; iVar++)
           Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
       }
       
@@ -2316,7 +1994,7 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
         rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
         
         /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iVar = 0; iVar < nVar; iVar++)
           Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
         
         /*--- Rotate the momentum components. ---*/
@@ -2339,8 +2017,8 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
         }
         
         /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          node[iPoint]->SetLimiter_Primitive(iVar, Limiter[iVar]);
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetLimiter(iVar, Limiter[iVar]);
         
       }
       
@@ -2355,6 +2033,219 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
   
 }
 
+void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  
+  /*--- Send/Receive information with all the neighbours at once ---*/
+  Initiate_MPI_Primitive_Gradient(geometry, config);
+  Complete_MPI_Primitive_Gradient(geometry, config);
+  
+}
+
+void CEulerSolver::Initiate_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, nBuffer = nPrimVarGrad*nDim;
+  unsigned long iPos, iPoint;
+  su2double *Buffer_Send_Gradient = NULL;
+  
+  CHaloExchange *Halo = geometry->GetHaloExchange(config);
+  
+  /*--- The buffers of the previous exchange are reused ---*/
+  if (Pending_MPI_Gradient) Complete_MPI_Primitive_Gradient(geometry, config);
+  
+  /*--- Pack the gradients that should be sended ---*/
+  Buffer_Send_Gradient = Halo->GetBuffer_Send(nBuffer);
+  for (iPos = 0; iPos < Halo->GetnPoint_Send(); iPos++) {
+    iPoint = Halo->GetPoint_Send(iPos);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Buffer_Send_Gradient[iPos*nBuffer+iDim*nPrimVarGrad+iVar] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+  }
+  
+  Halo->InitiateComms(nBuffer);
+  Pending_MPI_Gradient = true;
+  
+}
+
+void CEulerSolver::Complete_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, iPeriodic_Index, nBuffer = nPrimVarGrad*nDim;
+  unsigned long iPos, iPoint;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
+  *Buffer_Receive_Gradient = NULL, *Buffer_Point;
+  
+  su2double **Gradient = new su2double* [nPrimVarGrad];
+  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+    Gradient[iVar] = new su2double[nDim];
+  
+  CHaloExchange *Halo = geometry->GetHaloExchange(config);
+  
+  Halo->CompleteComms(nBuffer);
+  Pending_MPI_Gradient = false;
+  
+  Buffer_Receive_Gradient = Halo->GetBuffer_Recv(nBuffer);
+  
+  /*--- Do the coordinate transformation ---*/
+  for (iPos = 0; iPos < Halo->GetnPoint_Recv(); iPos++) {
+    
+    /*--- Find point and its type of transformation ---*/
+    iPoint = Halo->GetPoint_Recv(iPos);
+    iPeriodic_Index = Halo->GetRotation_Type_Recv(iPos);
+    Buffer_Point = &Buffer_Receive_Gradient[iPos*nBuffer];
+    
+    /*--- Retrieve the supplied periodic information. ---*/
+    angles = config->GetPeriodicRotation(iPeriodic_Index);
+    
+    /*--- Store angles separately for clarity. ---*/
+    theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+    cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+    sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+    
+    /*--- Compute the rotation matrix. Note that the implicit
+     ordering is rotation about the x-axis, y-axis,
+     then z-axis. Note that this is the transpose of the matrix
+     used during the preprocessing stage. ---*/
+    rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+    
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Gradient[iVar][iDim] = Buffer_Point[iDim*nPrimVarGrad+iVar];
+    
+    /*--- Need to rotate the gradients for all conserved variables. ---*/
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      if (nDim == 2) {
+        Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Point[0*nPrimVarGrad+iVar] + rotMatrix[0][1]*Buffer_Point[1*nPrimVarGrad+iVar];
+        Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Point[0*nPrimVarGrad+iVar] + rotMatrix[1][1]*Buffer_Point[1*nPrimVarGrad+iVar];
+      }
+      else {
+        Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Point[0*nPrimVarGrad+iVar] + rotMatrix[0][1]*Buffer_Point[1*nPrimVarGrad+iVar] + rotMatrix[0][2]*Buffer_Point[2*nPrimVarGrad+iVar];
+        Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Point[0*nPrimVarGrad+iVar] + rotMatrix[1][1]*Buffer_Point[1*nPrimVarGrad+iVar] + rotMatrix[1][2]*Buffer_Point[2*nPrimVarGrad+iVar];
+        Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Point[0*nPrimVarGrad+iVar] + rotMatrix[2][1]*Buffer_Point[1*nPrimVarGrad+iVar] + rotMatrix[2][2]*Buffer_Point[2*nPrimVarGrad+iVar];
+      }
+    }
+    
+    /*--- Store the received information ---*/
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient[iVar][iDim]);
+    
+  }
+  
+  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+    delete [] Gradient[iVar];
+  delete [] Gradient;
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  /*--- Send/Receive information with all the neighbours at once ---*/
+  Initiate_MPI_Primitive_Limiter(geometry, config);
+  Complete_MPI_Primitive_Limiter(geometry, config);
+  
+}
+
+void CEulerSolver::Initiate_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar;
+  unsigned long iPos, iPoint;
+  su2double *Buffer_Send_Limit = NULL;
+  
+  CHaloExchange *Halo = geometry->GetHaloExchange(config);
+  
+  /*--- The buffers of the previous exchange are reused ---*/
+  if (Pending_MPI_Limiter) Complete_MPI_Primitive_Limiter(geometry, config);
+  
+  /*--- Pack the limiters that should be sended ---*/
+  Buffer_Send_Limit = Halo->GetBuffer_Send(nPrimVarGrad);
+  for (iPos = 0; iPos < Halo->GetnPoint_Send(); iPos++) {
+    iPoint = Halo->GetPoint_Send(iPos);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Buffer_Send_Limit[iPos*nPrimVarGrad+iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+  }
+  
+  Halo->InitiateComms(nPrimVarGrad);
+  Pending_MPI_Limiter = true;
+  
+}
+
+void CEulerSolver::Complete_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iPeriodic_Index;
+  unsigned long iPos, iPoint;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
+  *Buffer_Receive_Limit = NULL;
+  
+  su2double *Limiter = new su2double [nPrimVarGrad];
+  
+  CHaloExchange *Halo = geometry->GetHaloExchange(config);
+  
+  Halo->CompleteComms(nPrimVarGrad);
+  Pending_MPI_Limiter = false;
+  
+  Buffer_Receive_Limit = Halo->GetBuffer_Recv(nPrimVarGrad);
+  
+  /*--- Do the coordinate transformation ---*/
+  for (iPos = 0; iPos < Halo->GetnPoint_Recv(); iPos++) {
+    
+    /*--- Find point and its type of transformation ---*/
+    iPoint = Halo->GetPoint_Recv(iPos);
+    iPeriodic_Index = Halo->GetRotation_Type_Recv(iPos);
+    
+    /*--- Retrieve the supplied periodic information. ---*/
+    angles = config->GetPeriodicRotation(iPeriodic_Index);
+    
+    /*--- Store angles separately for clarity. ---*/
+    theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+    cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+    sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+    
+    /*--- Compute the rotation matrix. Note that the implicit
+     ordering is rotation about the x-axis, y-axis,
+     then z-axis. Note that this is the transpose of the matrix
+     used during the preprocessing stage. ---*/
+    rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+    
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Limiter[iVar] = Buffer_Receive_Limit[iPos*nPrimVarGrad+iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    if (nDim == 2) {
+      Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[iPos*nPrimVarGrad+1] +
+      rotMatrix[0][1]*Buffer_Receive_Limit[iPos*nPrimVarGrad+2];
+      Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[iPos*nPrimVarGrad+1] +
+      rotMatrix[1][1]*Buffer_Receive_Limit[iPos*nPrimVarGrad+2];
+    }
+    else {
+      Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[iPos*nPrimVarGrad+1] +
+      rotMatrix[0][1]*Buffer_Receive_Limit[iPos*nPrimVarGrad+2] +
+      rotMatrix[0][2]*Buffer_Receive_Limit[iPos*nPrimVarGrad+3];
+      Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[iPos*nPrimVarGrad+1] +
+      rotMatrix[1][1]*Buffer_Receive_Limit[iPos*nPrimVarGrad+2] +
+      rotMatrix[1][2]*Buffer_Receive_Limit[iPos*nPrimVarGrad+3];
+      Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[iPos*nPrimVarGrad+1] +
+      rotMatrix[2][1]*Buffer_Receive_Limit[iPos*nPrimVarGrad+2] +
+      rotMatrix[2][2]*Buffer_Receive_Limit[iPos*nPrimVarGrad+3];
+    }
+    
+    /*--- Copy transformed conserved variables back into buffer. ---*/
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      node[iPoint]->SetLimiter_Primitive(iVar, Limiter[iVar]);
+    
+  }
+  
+  delete [] Limiter;
+  
+}
+
+void CEulerSolver::Complete_MPI_Overlap(CGeometry *geometry, CConfig *config) {
+  
+  if (Pending_MPI_Gradient) Complete_MPI_Primitive_Gradient(geometry, config);
+  if (Pending_MPI_Limiter) Complete_MPI_Primitive_Limiter(geometry, config);
+  
+}
+
 void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config) {
   
   unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
@@ -3601,10 +3492,16 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
   bool turbulent          = (config->GetKind_Solver() == RANS) || (config->GetKind_Solver() == DISC_ADJ_RANS);
   bool tkeNeeded          = ((turbulent) && (config->GetKind_Turb_Model() == SST));
   bool free_stream_temp   = (config->GetKind_FreeStreamOption() == TEMPERATURE_FS);
-  bool standard_air       = (config->GetKind_FluidModel() == STANDARD_AIR);
+  bool look_up_table      = (config->GetKind_FluidModel() == LUT_GAS);
   bool reynolds_init      = (config->GetKind_InitOption() == REYNOLDS);
   bool aeroelastic        = config->GetAeroelastic_Simulation();
   
+  /*--- The look-up table is built from the dimensionless tabulated model ---*/
+  
+  unsigned short Kind_FluidModel = config->GetKind_FluidModel();
+  if (look_up_table) Kind_FluidModel = config->GetKind_LUT_FluidModel();
+  bool standard_air       = (Kind_FluidModel == STANDARD_AIR);
+  
   /*--- Set temperature via the flutter speed index ---*/
   if (aeroelastic) {
     su2double vf             = config->GetAeroelastic_Flutter_Speed_Index();
@@ -3623,7 +3520,7 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
   Density_FreeStream  = config->GetDensity_FreeStream();
   Temperature_FreeStream  = config->GetTemperature_FreeStream();
 
-  switch (config->GetKind_FluidModel()) {
+  switch (Kind_FluidModel) {
 
     case STANDARD_AIR:
 
@@ -3874,7 +3771,7 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
   
   delete FluidModel;
  
-  switch (config->GetKind_FluidModel()) {
+  switch (Kind_FluidModel) {
       
     case STANDARD_AIR:
       FluidModel = new CIdealGas(1.4, Gas_ConstantND);
@@ -3900,6 +3797,11 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
       
   }
   
+  if (look_up_table) {
+    FluidModel = new CLookUpTable(FluidModel, config);
+    FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+  }
+  
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
   
   if (viscous) {
@@ -3948,7 +3850,12 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
     
     cout <<"-- Input conditions:"<< endl;
     
-    switch (config->GetKind_FluidModel()) {
+    if (look_up_table) {
+      cout << "Fluid Model: Look-up table, pressure " << config->GetLUT_Pressure_Limits(0) << " to " << config->GetLUT_Pressure_Limits(1);
+      cout << " Pa, temperature " << config->GetLUT_Temperature_Limits(0) << " to " << config->GetLUT_Temperature_Limits(1) << " K." << endl;
+    }
+    
+    switch (Kind_FluidModel) {
 
       case STANDARD_AIR:
         cout << "Fluid Model: STANDARD_AIR "<< endl;
@@ -4440,6 +4347,10 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   bool marker_analyze   = (config->GetnMarker_Analyze() != 0);
   bool fixed_cl         = config->GetFixed_CL_Mode();
 
+  /*--- Finish the halo exchanges left in flight by the previous preprocessing ---*/
+  
+  Complete_MPI_Overlap(geometry, config);
+  
   /*--- Update the angle of attack at the far-field for fixed CL calculations. ---*/
   
   if (fixed_cl) { SetFarfield_AoA(geometry, solver_container, config, iMesh, Output); }
@@ -4480,10 +4391,14 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   if (nearfield) { Set_MPI_Nearfield(geometry, config); }
 
  
-  /*--- Upwind second order reconstruction ---*/
+  /*--- Upwind second order reconstruction, the halo exchanges of the gradients
+   and limiters are only posted, Upwind_Residual completes them after the fluxes
+   of the edges without halo points (not with the discrete adjoint) ---*/
   
   if ((second_order && !center) && ((iMesh == MESH_0) || low_fidelity) && !Output) {
     
+    Overlap_MPI = !config->GetDiscrete_Adjoint();
+    
     /*--- Gradient computation ---*/
     
     if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
@@ -4503,6 +4418,8 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
       //        if (compressible && !ideal_gas) SetSecondary_Limiter(geometry, config);
     }
     
+    Overlap_MPI = false;
+    
   }
   
   /*--- Artificial dissipation ---*/
@@ -4748,57 +4665,81 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iEdge, iPoint, jPoint;
-  
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool second_order = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
   bool low_fidelity = (config->GetLowFidelitySim() && (iMesh == MESH_1));
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
-    
-    /*--- Set primitive variables w/o reconstruction ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    
-    /*--- Set the largest convective eigenvalue ---*/
-    
-    numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
-    
-    /*--- Set undivided laplacian an pressure based sensor ---*/
-    
-    if ((second_order || low_fidelity)) {
-      numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
-      numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
-    }
-    
-    /*--- Grid movement ---*/
-    
-    if (grid_movement) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
-    }
-    
-    /*--- Compute residuals, and Jacobians ---*/
-    
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+  /*--- With threads, the edges are visited color by color, the blocks of
+   edges of a color do not share points and are divided among the threads. ---*/
+  
+  bool threaded = GetThreaded_EdgeLoop(geometry);
+  unsigned long nColor = (threaded? geometry->GetnEdgeColor() : 1);
+  
+  SU2_OMP(parallel if(threaded))
+  {
     
-    /*--- Update convective and artificial dissipation residuals ---*/
+    unsigned long iColor, iEdgeColor, iEdge, iPoint, jPoint, EdgeBegin, EdgeEnd;
+    unsigned short iThread = SU2_OMP_GetThreadNum();
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+    CNumerics *edge_numerics = (iThread == 0)? numerics : ThreadNumerics[iThread][CONV_TERM];
+    su2double *Residual_t = Thread_Residual[iThread];
+    su2double **Jacobian_t_i = Thread_Jacobian_i[iThread], **Jacobian_t_j = Thread_Jacobian_j[iThread];
     
-    /*--- Set implicit computation ---*/
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+    for (iColor = 0; iColor < nColor; iColor++) {
+      
+      EdgeBegin = (threaded? geometry->GetEdgeColorBegin(iColor) : 0);
+      EdgeEnd   = (threaded? geometry->GetEdgeColorEnd(iColor) : geometry->GetnEdge());
+      
+      SU2_OMP(for schedule(static, EDGE_BLOCK_SIZE))
+      for (iEdgeColor = EdgeBegin; iEdgeColor < EdgeEnd; iEdgeColor++) {
+        
+        iEdge = (threaded? geometry->GetEdgeColorIdx(iEdgeColor) : iEdgeColor);
+        
+        /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
+        edge_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+        edge_numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+        
+        /*--- Set primitive variables w/o reconstruction ---*/
+        
+        edge_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+        
+        /*--- Set the largest convective eigenvalue ---*/
+        
+        edge_numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
+        
+        /*--- Set undivided laplacian an pressure based sensor ---*/
+        
+        if ((second_order || low_fidelity)) {
+          edge_numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
+          edge_numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
+        }
+        
+        /*--- Grid movement ---*/
+        
+        if (grid_movement) {
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        }
+        
+        /*--- Compute residuals, and Jacobians ---*/
+        
+        edge_numerics->ComputeResidual(Residual_t, Jacobian_t_i, Jacobian_t_j, config);
+        
+        /*--- Update convective and artificial dissipation residuals ---*/
+        
+        LinSysRes.AddBlock(iPoint, Residual_t);
+        LinSysRes.SubtractBlock(jPoint, Residual_t);
+        
+        /*--- Set implicit computation ---*/
+        if (implicit) {
+          Jacobian.AddBlock(iPoint, iPoint, Jacobian_t_i);
+          Jacobian.AddBlock(iPoint, jPoint, Jacobian_t_j);
+          Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_t_i);
+          Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_t_j);
+        }
+      }
     }
   }
   
@@ -4807,16 +4748,7 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh) {
   
-  su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
-  *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0;
-  
-  su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
-  
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
-  
-  bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
-  
+  unsigned long counter_local = 0, counter_global = 0;
   
   bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool low_fidelity     = (config->GetLowFidelitySim() && (iMesh == MESH_1));
@@ -4826,186 +4758,338 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   bool roe_turkel       = (config->GetKind_Upwind_Flow() == TURKEL);
   bool ideal_gas        = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS );
   bool low_mach_corr    = config->Low_Mach_Correction();
-
-  /*--- Loop over all the edges ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Numerics that compute the fluxes of a batch of edges at once (in SIMD
+   lanes), the reconstruction is done edge by edge and the edges of the batch
+   are scattered to the residual and Jacobian after the batched computation. ---*/
+  
+  bool batched          = (numerics->GetBatched() && ideal_gas && !low_mach_corr && !roe_turkel);
+  
+  /*--- With threads, the edges are visited color by color, the blocks of
+   edges of a color do not share points and are divided among the threads. The
+   thermodynamic consistent extrapolation uses the (shared) fluid model,
+   in that case the loop is done by a single thread. ---*/
+  
+  bool threaded = GetThreaded_EdgeLoop(geometry) && ideal_gas && !low_mach_corr;
+  unsigned long nColor = (threaded? geometry->GetnEdgeColor() : 1);
+  
+  /*--- The edges without halo points are visited first, while the halo
+   exchanges of the gradients and limiters posted by the preprocessing are in
+   flight, the exchanges are completed before the edges with halo points. ---*/
+  
+  bool overlap = (Pending_MPI_Gradient || Pending_MPI_Limiter);
+  unsigned short iPass, nPass = (overlap? 2 : 1);
+  unsigned long ColorBegin, ColorEnd, PassBegin, PassEnd;
+  
+  for (iPass = 0; iPass < nPass; iPass++) {
     
-    /*--- Points in edge and normal vectors ---*/
+    if (iPass == 1) Complete_MPI_Overlap(geometry, config);
     
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    /*--- Colors (threads) or edges (single thread) of the pass ---*/
     
-    /*--- Roe Turkel preconditioning ---*/
+    ColorBegin = 0; ColorEnd = nColor;
+    PassBegin = 0; PassEnd = geometry->GetnEdge();
     
-    if (roe_turkel) {
-      sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
-      numerics->SetVelocity2_Inf(sqvel);
+    if (overlap && threaded) {
+      if (iPass == 0) ColorEnd = geometry->GetnEdgeColorDomain();
+      else ColorBegin = geometry->GetnEdgeColorDomain();
+    }
+    if (overlap && !threaded) {
+      if (iPass == 0) PassEnd = geometry->GetnEdgeDomain();
+      else PassBegin = geometry->GetnEdgeDomain();
     }
     
-    /*--- Grid movement ---*/
-    
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
-    
-    /*--- Get primitive variables ---*/
-    
-    V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
-    S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
-
-    /*--- High order reconstruction using MUSCL strategy ---*/
-    
-    if (second_order) {
+    SU2_OMP(parallel if(threaded) reduction(+:counter_local))
+    {
       
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
+      su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
+      *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0;
       
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = node[jPoint]->GetLimiter_Primitive();
-      }
+      su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
       
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
-        }
-        if (limiter) {
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
-      }
+      unsigned long iColor, iEdge, iPoint, jPoint, EdgeBegin, EdgeEnd, iBatch, nBatch, BatchBegin;
+      unsigned long Batch_iPoint[EDGE_BATCH_SIZE], Batch_jPoint[EDGE_BATCH_SIZE];
+      unsigned short iDim, iVar, jVar, iLane, nLane;
+      
+      bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
+      
+      /*--- Numerics and auxiliary vectors of this thread ---*/
+      
+      unsigned short iThread = SU2_OMP_GetThreadNum();
+      
+      CNumerics *edge_numerics = (iThread == 0)? numerics : ThreadNumerics[iThread][CONV_TERM];
+      su2double *Vector_t_i = Thread_Vector_i[iThread], *Vector_t_j = Thread_Vector_j[iThread];
+      su2double *Primitive_t_i = Thread_Primitive_i[iThread], *Primitive_t_j = Thread_Primitive_j[iThread];
+      su2double *Secondary_t_i = Thread_Secondary_i[iThread], *Secondary_t_j = Thread_Secondary_j[iThread];
+      su2double *Residual_t = Thread_Residual[iThread];
+      su2double **Jacobian_t_i = Thread_Jacobian_i[iThread], **Jacobian_t_j = Thread_Jacobian_j[iThread];
+      
+      const unsigned short B = EDGE_BATCH_SIZE;
+      su2double *Batch_V_i = Thread_Batch[iThread], *Batch_V_j = &Batch_V_i[B*(nDim+4)],
+      *Batch_Normal = &Batch_V_j[B*(nDim+4)], *Batch_Residual = &Batch_Normal[B*nDim],
+      *Batch_Jacobian_i = &Batch_Residual[B*nVar], *Batch_Jacobian_j = &Batch_Jacobian_i[B*nVar*nVar], *Prim_i, *Prim_j;
+      
+      /*--- Loop over the edges of the pass ---*/
+      
+      for (iColor = ColorBegin; iColor < ColorEnd; iColor++) {
+        
+        EdgeBegin = (threaded? geometry->GetEdgeColorBegin(iColor) : PassBegin);
+        EdgeEnd   = (threaded? geometry->GetEdgeColorEnd(iColor) : PassEnd);
+        
+        /*--- The edges are visited in batches of EDGE_BATCH_SIZE consecutive edges,
+         each block of EDGE_BLOCK_SIZE edges is still given to a single thread ---*/
+        
+        nBatch = (EdgeEnd-EdgeBegin+B-1)/B;
+        
+        SU2_OMP(for schedule(static, EDGE_BLOCK_SIZE/EDGE_BATCH_SIZE))
+        for (iBatch = 0; iBatch < nBatch; iBatch++) {
+          
+          BatchBegin = EdgeBegin+iBatch*B;
+          nLane = (unsigned short)(min(EdgeEnd-BatchBegin, (unsigned long)(B)));
+          
+          for (iLane = 0; iLane < nLane; iLane++) {
+            
+            iEdge = (threaded? geometry->GetEdgeColorIdx(BatchBegin+iLane) : BatchBegin+iLane);
+            
+            /*--- Points in edge and normal vectors ---*/
+            
+            iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
+            edge_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+            
+            /*--- Roe Turkel preconditioning ---*/
+            
+            if (roe_turkel) {
+              sqvel = 0.0;
+              for (iDim = 0; iDim < nDim; iDim ++)
+                sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
+              edge_numerics->SetVelocity2_Inf(sqvel);
+            }
+            
+            /*--- Grid movement ---*/
+            
+            if (grid_movement)
+              edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+            
+            /*--- Get primitive variables ---*/
+            
+            V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
+            S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
+
+            /*--- High order reconstruction using MUSCL strategy ---*/
+            
+            if (second_order) {
+            
+              for (iDim = 0; iDim < nDim; iDim++) {
+                Vector_t_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+                Vector_t_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+              }
+            
+              Gradient_i = node[iPoint]->GetGradient_Primitive();
+              Gradient_j = node[jPoint]->GetGradient_Primitive();
+              if (limiter) {
+                Limiter_i = node[iPoint]->GetLimiter_Primitive();
+                Limiter_j = node[jPoint]->GetLimiter_Primitive();
+              }
+            
+              for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+                Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+                Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
+                for (iDim = 0; iDim < nDim; iDim++) {
+                  Project_Grad_i += Vector_t_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
+                  Project_Grad_j += Vector_t_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
+                }
+                if (limiter) {
+                  Primitive_t_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+                  Primitive_t_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+                }
+                else {
+                  Primitive_t_i[iVar] = V_i[iVar] + Project_Grad_i;
+                  Primitive_t_j[iVar] = V_j[iVar] + Project_Grad_j;
+                }
+              }
+
+              /*--- Recompute the extrapolated quantities in a
+               thermodynamic consistent way  ---*/
 
-      /*--- Recompute the extrapolated quantities in a
-       thermodynamic consistent way  ---*/
+              if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config); }
 
-      if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config); }
+              /*--- Low-Mach number correction ---*/
 
-      /*--- Low-Mach number correction ---*/
+              if (low_mach_corr) {
 
-      if (low_mach_corr) {
+                velocity2_i = 0.0;
+                velocity2_j = 0.0;
+              
+                for (iDim = 0; iDim < nDim; iDim++) {
+                  velocity2_i += Primitive_t_i[iDim+1]*Primitive_t_i[iDim+1];
+                  velocity2_j += Primitive_t_j[iDim+1]*Primitive_t_j[iDim+1];
+                }
+                mach_i = sqrt(velocity2_i)/Primitive_t_i[nDim+4];
+                mach_j = sqrt(velocity2_j)/Primitive_t_j[nDim+4];
 
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
-          velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
-        }
-        mach_i = sqrt(velocity2_i)/Primitive_i[nDim+4];
-        mach_j = sqrt(velocity2_j)/Primitive_j[nDim+4];
+                z = min(max(mach_i,mach_j),1.0);
+                velocity2_i = 0.0;
+                velocity2_j = 0.0;
+                for (iDim = 0; iDim < nDim; iDim++) {
+                    vel_i_corr[iDim] = ( Primitive_t_i[iDim+1] + Primitive_t_j[iDim+1] )/2.0 \
+                            + z * ( Primitive_t_i[iDim+1] - Primitive_t_j[iDim+1] )/2.0;
+                    vel_j_corr[iDim] = ( Primitive_t_i[iDim+1] + Primitive_t_j[iDim+1] )/2.0 \
+                            + z * ( Primitive_t_j[iDim+1] - Primitive_t_i[iDim+1] )/2.0;
 
-        z = min(max(mach_i,mach_j),1.0);
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-            vel_i_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                    + z * ( Primitive_i[iDim+1] - Primitive_j[iDim+1] )/2.0;
-            vel_j_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                    + z * ( Primitive_j[iDim+1] - Primitive_i[iDim+1] )/2.0;
+                    velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
+                    velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
 
-            velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
-            velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
+                    Primitive_t_i[iDim+1] = vel_i_corr[iDim];
+                    Primitive_t_j[iDim+1] = vel_j_corr[iDim];
+                }
 
-            Primitive_i[iDim+1] = vel_i_corr[iDim];
-            Primitive_j[iDim+1] = vel_j_corr[iDim];
-        }
+                FluidModel->SetEnergy_Prho(Primitive_t_i[nDim+1],Primitive_t_i[nDim+2]);
+                Primitive_t_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_t_i[nDim+1]/Primitive_t_i[nDim+2] + 0.5*velocity2_i;
+                FluidModel->SetEnergy_Prho(Primitive_t_j[nDim+1],Primitive_t_j[nDim+2]);
+                Primitive_t_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_t_j[nDim+1]/Primitive_t_j[nDim+2] + 0.5*velocity2_j;
+              }
+            
+              /*--- Check for non-physical solutions after reconstruction. If found,
+               use the cell-average value of the solution. This results in a locally
+               first-order approximation, but this is typically only active
+               during the start-up of a calculation. If non-physical, use the 
+               cell-averaged state. ---*/
+            
+              neg_pressure_i = (Primitive_t_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_t_j[nDim+1] < 0.0);
+              neg_density_i  = (Primitive_t_i[nDim+2] < 0.0); neg_density_j  = (Primitive_t_j[nDim+2] < 0.0);
 
-        FluidModel->SetEnergy_Prho(Primitive_i[nDim+1],Primitive_i[nDim+2]);
-        Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
-        FluidModel->SetEnergy_Prho(Primitive_j[nDim+1],Primitive_j[nDim+2]);
-        Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
-      }
-      
-      /*--- Check for non-physical solutions after reconstruction. If found,
-       use the cell-average value of the solution. This results in a locally
-       first-order approximation, but this is typically only active
-       during the start-up of a calculation. If non-physical, use the 
-       cell-averaged state. ---*/
-      
-      neg_pressure_i = (Primitive_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_j[nDim+1] < 0.0);
-      neg_density_i  = (Primitive_i[nDim+2] < 0.0); neg_density_j  = (Primitive_j[nDim+2] < 0.0);
+              R = sqrt(fabs(Primitive_t_j[nDim+2]/Primitive_t_i[nDim+2]));
+              sq_vel = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++) {
+                RoeVelocity[iDim] = (R*Primitive_t_j[iDim+1]+Primitive_t_i[iDim+1])/(R+1);
+                sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
+              }
+              RoeEnthalpy = (R*Primitive_t_j[nDim+3]+Primitive_t_i[nDim+3])/(R+1);
+              neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+            
+              if (neg_sound_speed) {
+                for (iVar = 0; iVar < nPrimVar; iVar++) {
+                  Primitive_t_i[iVar] = V_i[iVar];
+                  Primitive_t_j[iVar] = V_j[iVar]; }
+                Secondary_t_i[0] = S_i[0]; Secondary_t_i[1] = S_i[1];
+                Secondary_t_j[0] = S_i[0]; Secondary_t_j[1] = S_i[1];
+                counter_local++;
+              }
+            
+              if (neg_density_i || neg_pressure_i) {
+                for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_t_i[iVar] = V_i[iVar];
+                Secondary_t_i[0] = S_i[0]; Secondary_t_i[1] = S_i[1];
+                counter_local++;
+              }
+            
+              if (neg_density_j || neg_pressure_j) {
+                for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_t_j[iVar] = V_j[iVar];
+                Secondary_t_j[0] = S_j[0]; Secondary_t_j[1] = S_j[1];
+                counter_local++;
+              }
 
-      R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        RoeVelocity[iDim] = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
-      }
-      RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
-      neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
-      
-      if (neg_sound_speed) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) {
-          Primitive_i[iVar] = V_i[iVar];
-          Primitive_j[iVar] = V_j[iVar]; }
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        Secondary_j[0] = S_i[0]; Secondary_j[1] = S_i[1];
-        counter_local++;
-      }
-      
-      if (neg_density_i || neg_pressure_i) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_i[iVar] = V_i[iVar];
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        counter_local++;
-      }
-      
-      if (neg_density_j || neg_pressure_j) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_j[iVar] = V_j[iVar];
-        Secondary_j[0] = S_j[0]; Secondary_j[1] = S_j[1];
-        counter_local++;
-      }
+              edge_numerics->SetPrimitive(Primitive_t_i, Primitive_t_j);
+              edge_numerics->SetSecondary(Secondary_t_i, Secondary_t_j);
+            
+            }
+            else {
+            
+              /*--- Set conservative variables without reconstruction ---*/
+            
+              edge_numerics->SetPrimitive(V_i, V_j);
+              edge_numerics->SetSecondary(S_i, S_j);
+            
+            }
+            
+            /*--- Batched numerics, pack the primitive variables and the normal of the edge ---*/
+            
+            if (batched) {
+              Prim_i = (second_order? Primitive_t_i : V_i);
+              Prim_j = (second_order? Primitive_t_j : V_j);
+              for (iVar = 0; iVar < nDim+4; iVar++) {
+                Batch_V_i[iVar*B+iLane] = Prim_i[iVar];
+                Batch_V_j[iVar*B+iLane] = Prim_j[iVar];
+              }
+              for (iDim = 0; iDim < nDim; iDim++)
+                Batch_Normal[iDim*B+iLane] = geometry->edge[iEdge]->GetNormal()[iDim];
+              Batch_iPoint[iLane] = iPoint; Batch_jPoint[iLane] = jPoint;
+              continue;
+            }
+            
+            /*--- Compute the residual ---*/
+            
+            edge_numerics->ComputeResidual(Residual_t, Jacobian_t_i, Jacobian_t_j, config);
 
-      numerics->SetPrimitive(Primitive_i, Primitive_j);
-      numerics->SetSecondary(Secondary_i, Secondary_j);
-      
-    }
-    else {
-      
-      /*--- Set conservative variables without reconstruction ---*/
-      
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetSecondary(S_i, S_j);
+            /*--- Update residual value ---*/
+            
+            LinSysRes.AddBlock(iPoint, Residual_t);
+            LinSysRes.SubtractBlock(jPoint, Residual_t);
+            
+            /*--- Set implicit Jacobians ---*/
+            
+            if (implicit) {
+              Jacobian.AddBlock(iPoint, iPoint, Jacobian_t_i);
+              Jacobian.AddBlock(iPoint, jPoint, Jacobian_t_j);
+              Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_t_i);
+              Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_t_j);
+            }
+            
+            /*--- Roe Turkel preconditioning, set the value of beta ---*/
+            
+            if (roe_turkel) {
+              node[iPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+              node[jPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+            }
+            
+          }
+          
+          if (!batched) continue;
+          
+          /*--- Fluxes of the batch, the unused lanes of the last batch of a
+           color repeat the first edge of the batch ---*/
+          
+          for (iLane = nLane; iLane < B; iLane++) {
+            for (iVar = 0; iVar < nDim+4; iVar++) {
+              Batch_V_i[iVar*B+iLane] = Batch_V_i[iVar*B];
+              Batch_V_j[iVar*B+iLane] = Batch_V_j[iVar*B];
+            }
+            for (iDim = 0; iDim < nDim; iDim++)
+              Batch_Normal[iDim*B+iLane] = Batch_Normal[iDim*B];
+          }
+          
+          edge_numerics->ComputeResidual_Batch(Batch_V_i, Batch_V_j, Batch_Normal, Batch_Residual,
+                                               Batch_Jacobian_i, Batch_Jacobian_j, config);
+          
+          /*--- Update the residual and the implicit Jacobians, in the order of the edges ---*/
+          
+          for (iLane = 0; iLane < nLane; iLane++) {
+            
+            iPoint = Batch_iPoint[iLane]; jPoint = Batch_jPoint[iLane];
+            
+            for (iVar = 0; iVar < nVar; iVar++)
+              Residual_t[iVar] = Batch_Residual[iVar*B+iLane];
+            
+            LinSysRes.AddBlock(iPoint, Residual_t);
+            LinSysRes.SubtractBlock(jPoint, Residual_t);
+            
+            if (implicit) {
+              for (iVar = 0; iVar < nVar; iVar++)
+                for (jVar = 0; jVar < nVar; jVar++) {
+                  Jacobian_t_i[iVar][jVar] = Batch_Jacobian_i[(iVar*nVar+jVar)*B+iLane];
+                  Jacobian_t_j[iVar][jVar] = Batch_Jacobian_j[(iVar*nVar+jVar)*B+iLane];
+                }
+              Jacobian.AddBlock(iPoint, iPoint, Jacobian_t_i);
+              Jacobian.AddBlock(iPoint, jPoint, Jacobian_t_j);
+              Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_t_i);
+              Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_t_j);
+            }
+          }
+          
+        }
+      }
       
     }
     
-    /*--- Compute the residual ---*/
-    
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
-
-    /*--- Update residual value ---*/
-    
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
-    
-    /*--- Set implicit Jacobians ---*/
-    
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    }
-    
-    /*--- Roe Turkel preconditioning, set the value of beta ---*/
-    
-    if (roe_turkel) {
-      node[iPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-      node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-    }
-    
   }
   
   /*--- Warning message about non-physical reconstructions ---*/
@@ -6321,6 +6405,18 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
   
+  Implicit_Iteration(geometry, solver_container, config, NULL);
+  
+}
+
+void CEulerSolver::ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, CMatrixVectorProduct & mat_vec) {
+  
+  Implicit_Iteration(geometry, solver_container, config, &mat_vec);
+  
+}
+
+void CEulerSolver::Implicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, CMatrixVectorProduct *mat_vec) {
+  
   unsigned short iVar, jVar;
   unsigned long iPoint, total_index, IterLinSol = 0;
   su2double Delta, *local_Res_TruncError, Vol;
@@ -6396,12 +6492,24 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   /*--- Solve or smooth the linear system ---*/
   
   CSysSolve system;
-  IterLinSol = system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  if (mat_vec == NULL)
+    IterLinSol = system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  else
+    IterLinSol = system.Solve(Jacobian, *mat_vec, LinSysRes, LinSysSol, geometry, config);
   
   /*--- The the number of iterations of the linear solver ---*/
   
   SetIterLinSolver(IterLinSol);
   
+  /*--- The matrix free products leave the primitive variables and their gradients
+   of the last perturbed solution, recompute them for the current solution ---*/
+  
+  if (mat_vec != NULL) {
+    SetPrimitive_Variables(solver_container, config, true);
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) SetPrimitive_Gradient_GG(geometry, config);
+    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) SetPrimitive_Gradient_LS(geometry, config);
+  }
+  
   /*--- Update solution (system written in terms of increments) ---*/
   
   if (!adjoint) {
@@ -6499,7 +6607,8 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   delete [] PrimVar_i;
   delete [] PrimVar_j;
 
-  Set_MPI_Primitive_Gradient(geometry, config);
+  if (Overlap_MPI) Initiate_MPI_Primitive_Gradient(geometry, config);
+  else Set_MPI_Primitive_Gradient(geometry, config);
 
 }
 
@@ -6643,7 +6752,8 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
     AD::EndPreacc();
   }
   
-  Set_MPI_Primitive_Gradient(geometry, config);
+  if (Overlap_MPI) Initiate_MPI_Primitive_Gradient(geometry, config);
+  else Set_MPI_Primitive_Gradient(geometry, config);
   
 }
 
@@ -6829,7 +6939,8 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
   /*--- Limiter MPI ---*/
   
-  Set_MPI_Primitive_Limiter(geometry, config);
+  if (Overlap_MPI) Initiate_MPI_Primitive_Limiter(geometry, config);
+  else Set_MPI_Primitive_Limiter(geometry, config);
   
 }
 
@@ -14340,16 +14451,16 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   
   /*--- Restart the solution from file information ---*/
   unsigned short iDim, iVar, iMesh, iMeshFine;
-  unsigned long iPoint, index, iChildren, Point_Fine;
+  unsigned long iPoint, iChildren, Point_Fine;
   unsigned short turb_model = config->GetKind_Turb_Model();
-  su2double Area_Children, Area_Parent, *Coord, *Solution_Fine, dull_val;
+  unsigned short GridVel_Index;
+  su2double Area_Children, Area_Parent, *Coord, *Solution_Fine;
   bool grid_movement  = config->GetGrid_Movement();
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool steady_restart = config->GetSteadyRestart();
   bool time_stepping = config->GetUnsteady_Simulation() == TIME_STEPPING;
-  string UnstExt, text_line;
-  ifstream restart_file;
+  string UnstExt;
   
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry[iZone]->GetnZone();
@@ -14360,11 +14471,6 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   for (iDim = 0; iDim < nDim; iDim++)
     Coord[iDim] = 0.0;
   
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
-  
   /*--- Multizone problems require the number of the zone to be appended. ---*/
 
   if (nZone > 1)
@@ -14375,93 +14481,53 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   if (dual_time || time_stepping)
     restart_filename = config->GetUnsteady_FileName(restart_filename, val_iter);
   
-  /*--- Open the restart file, and throw an error if this fails. ---*/
-  
-  restart_file.open(restart_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
-    exit(EXIT_FAILURE);
-  }
+  /*--- Read the restart file (ASCII or binary), the values of the
+   points of this rank are kept in the restart data. ---*/
   
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
+  Read_SU2_Restart(geometry[MESH_0], config, restart_filename);
   
-  map<unsigned long,unsigned long> Global2Local;
-  map<unsigned long,unsigned long>::const_iterator MI;
+  /*--- The grid velocities follow the coordinates, the conservative
+   variables and the variables of the turbulence model. ---*/
   
-  /*--- Now fill array with the transform values only for local points ---*/
+  GridVel_Index = 2*nDim + 2;
+  if (turb_model == SA || turb_model == SA_NEG) GridVel_Index += 1;
+  else if (turb_model == SST) GridVel_Index += 2;
   
   for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry[MESH_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
-  
-  /*--- Read all lines in the restart file ---*/
-  
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
-  
-  /*--- The first line is the header ---*/
-  
-  getline (restart_file, text_line);
-  
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
     
-    getline (restart_file, text_line);
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord[iDim] = Restart_Data[iPoint*nRestart_Fields+iDim];
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Restart_Data[iPoint*nRestart_Fields+nDim+iVar];
     
-    istringstream point_line(text_line);
+    node[iPoint]->SetSolution(Solution);
     
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- For dynamic meshes, store the grid coordinates and grid
+     velocities for each node. ---*/
     
-    MI = Global2Local.find(iPoint_Global);
-    if (MI != Global2Local.end()) {
-      
-      iPoint_Local = Global2Local[iPoint_Global];
-      
-      if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1] >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3];
-      if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2] >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3] >> Solution[4];
+    if (grid_movement) {
       
-      node[iPoint_Local]->SetSolution(Solution);
+      /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+      /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
       
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart && (GridVel_Index+nDim <= nRestart_Fields)) {
+        for (iDim = 0; iDim < nDim; iDim++)
+          GridVel[iDim] = Restart_Data[iPoint*nRestart_Fields+GridVel_Index+iDim];
+      }
       
-      if (grid_movement) {
-        
-        /*--- First, remove any variables for the turbulence model that
-         appear in the restart file before the grid velocities. ---*/
-        
-        if (turb_model == SA || turb_model == SA_NEG) {
-          point_line >> dull_val;
-        } else if (turb_model == SST) {
-          point_line >> dull_val >> dull_val;
-        }
-        
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
-        
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
-            if (nDim == 2) point_line >> GridVel[0] >> GridVel[1];
-            else point_line >> GridVel[0] >> GridVel[1] >> GridVel[2];
-        }
-
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-          geometry[MESH_0]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
-        }
-        
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->node[iPoint]->SetCoord(iDim, Coord[iDim]);
+        geometry[MESH_0]->node[iPoint]->SetGridVel(iDim, GridVel[iDim]);
       }
       
     }
-
+    
   }
   
-  /*--- Close the restart file ---*/
+  /*--- Free memory needed for the restart data ---*/
   
-  restart_file.close();
+  delete [] Restart_Data; Restart_Data = NULL;
   
   /*--- MPI solution ---*/
   
@@ -14557,11 +14623,10 @@ CNSSolver::CNSSolver(void) : CEulerSolver() {
 
 CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CEulerSolver() {
   
-  unsigned long iPoint, index, counter_local = 0, counter_global = 0, iVertex;
+  unsigned long iPoint, counter_local = 0, counter_global = 0, iVertex;
   unsigned short iVar, iDim, iMarker, nLineLets;
-  su2double Density, Velocity2, Pressure, Temperature, dull_val, StaticEnergy;
+  su2double Density, Velocity2, Pressure, Temperature, StaticEnergy;
   int Unst_RestartIter;
-  ifstream restart_file;
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
   bool restart = (config->GetRestart() || config->GetRestart_Flow());
@@ -14572,9 +14637,6 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
   string filename = config->GetSolution_FlowFileName();
   string filename_ = config->GetSolution_FlowFileName();
-  su2double AoA_, AoS_, BCThrust_;
-  string::size_type position;
-  unsigned long ExtIter_;
 
   unsigned short direct_diff = config->GetDirectDiff();
   unsigned short nMarkerTurboPerf = config->Get_nMarkerTurboPerf();
@@ -14612,102 +14674,9 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       filename_ = config->GetUnsteady_FileName(filename_, Unst_RestartIter);
     }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename_.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename_.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    unsigned long iPoint_Global = 0;
-    string text_line;
-    
-    /*--- The first line is the header (General description) ---*/
-    
-    getline (restart_file, text_line);
-    
-    /*--- Space for the solution ---*/
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-    }
-    
-    /*--- Space for extra info (if any) ---*/
-    
-    while (getline (restart_file, text_line)) {
-      
-      /*--- Angle of attack ---*/
-      
-      position = text_line.find ("AOA=",0);
-      if (position != string::npos) {
-        text_line.erase (0,4); AoA_ = atof(text_line.c_str());
-        if (config->GetDiscard_InFiles() == false) {
-          if ((config->GetAoA() != AoA_) &&  (rank == MASTER_NODE)) {
-            cout.precision(6);
-            cout << fixed <<"WARNING: AoA in the solution file (" << AoA_ << " deg.) +" << endl;
-            cout << "         AoA offset in mesh file (" << config->GetAoA_Offset() << " deg.) = " << AoA_ + config->GetAoA_Offset() << " deg." << endl;
-          }
-          config->SetAoA(AoA_ + config->GetAoA_Offset());
-        }
-        else {
-          if ((config->GetAoA() != AoA_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: Discarding the AoA in the solution file." << endl;
-        }
-      }
-      
-      /*--- Sideslip angle ---*/
-      
-      position = text_line.find ("SIDESLIP_ANGLE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,15); AoS_ = atof(text_line.c_str());
-        if (config->GetDiscard_InFiles() == false) {
-          if ((config->GetAoS() != AoS_) &&  (rank == MASTER_NODE)) {
-            cout.precision(6);
-            cout << fixed <<"WARNING: AoS in the solution file (" << AoS_ << " deg.) +" << endl;
-            cout << "         AoS offset in mesh file (" << config->GetAoS_Offset() << " deg.) = " << AoS_ + config->GetAoS_Offset() << " deg." << endl;
-          }
-          config->SetAoS(AoS_ + config->GetAoS_Offset());
-        }
-        else {
-          if ((config->GetAoS() != AoS_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: Discarding the AoS in the solution file." << endl;
-        }
-      }
-      
-      /*--- BCThrust angle ---*/
-      
-      position = text_line.find ("INITIAL_BCTHRUST=",0);
-      if (position != string::npos) {
-        text_line.erase (0,17); BCThrust_ = atof(text_line.c_str());
-        if (config->GetDiscard_InFiles() == false) {
-          if ((config->GetInitial_BCThrust() != BCThrust_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: ACDC will use the initial BC Thrust provided in the solution file: " << BCThrust_ << " lbs." << endl;
-          config->SetInitial_BCThrust(BCThrust_);
-        }
-        else {
-          if ((config->GetInitial_BCThrust() != BCThrust_) &&  (rank == MASTER_NODE))
-            cout <<"WARNING: Discarding the BC Thrust in the solution file." << endl;
-        }
-      }
-      
-      /*--- External iteration ---*/
-      
-      position = text_line.find ("EXT_ITER=",0);
-      if (position != string::npos) {
-        text_line.erase (0,9); ExtIter_ = atoi(text_line.c_str());
-        if (!config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint())
-          config->SetExtIter_OffSet(ExtIter_);
-      }
-      
-    }
+    /*--- Read and store the restart metadata ---*/
     
-    /*--- Close the restart file... we will open this file again... ---*/
-    
-    restart_file.close();
+    Read_SU2_Restart_Metadata(geometry, config, filename_);
     
   }
 
@@ -14857,6 +14826,10 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       cout << "Explicit scheme. No Jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
   }
   
+  /*--- Auxiliary vectors of the additional threads for the edge loops ---*/
+  
+  SetThreadWorkspace(config);
+  
   /*--- Define some auxiliary vectors for computing flow variable
    gradients by least squares, S matrix := inv(R)*traspose(inv(R)),
    c vector := transpose(WA)*(Wb) ---*/
@@ -15370,82 +15343,19 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
-    
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    
-    /*--- Read all lines in the restart file ---*/
-    
-    long iPoint_Local;
-    unsigned long iPoint_Global_Local = 0, iPoint_Global = 0; string text_line;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-    
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-      
-      if (iPoint_Global >= geometry->GetGlobal_nPointDomain()) { sbuf_NotMatching = 1; break; }
-      
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-        
-        iPoint_Local = Global2Local[iPoint_Global];
-        
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3] >> Solution[4];
-
-        node[iPoint_Local] = new CNSVariable(Solution, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-
-    }
+    /*--- Read the restart file (ASCII or binary), the values of the
+     points of this rank are kept in the restart data. ---*/
     
-    /*--- Detect a wrong solution file ---*/
+    Read_SU2_Restart(geometry, config, filename);
     
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
+    /*--- Load the solution of each point. Note that the first fields of
+     the restart file are the node coordinates, followed by the
+     conservative variables. ---*/
     
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        Solution[iVar] = Restart_Data[iPoint*nRestart_Fields+nDim+iVar];
+      node[iPoint] = new CNSVariable(Solution, nDim, nVar, config);
     }
     
     /*--- Instantiate the variable class with an arbitrary solution
@@ -15455,9 +15365,9 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
       node[iPoint] = new CNSVariable(Solution, nDim, nVar, config);
     
-    /*--- Close the restart file ---*/
+    /*--- Free memory needed for the restart data ---*/
     
-    restart_file.close();
+    delete [] Restart_Data; Restart_Data = NULL;
     
   }
   
@@ -15505,6 +15415,10 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       cout << "Warning. The original solution contains "<< counter_global << " points that are not physical." << endl;
   }
   
+  /*--- Store the variables of all the points in contiguous blocks ---*/
+  
+  SetContiguous_Storage(config);
+  
   /*--- Define solver parameters needed for execution of destructor ---*/
   
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) space_centered = true;
@@ -15965,51 +15879,75 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iPoint, jPoint, iEdge;
-  
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points, coordinates and normal vector in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive and secondary variables ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
-    
-    /*--- Gradient and limiters ---*/
-    
-    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
-    numerics->SetPrimVarLimiter(node[iPoint]->GetLimiter_Primitive(), node[jPoint]->GetLimiter_Primitive());
-    
-    /*--- Turbulent kinetic energy ---*/
-    
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
-                                     solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
-    
-    /*--- Compute and update residual ---*/
-    
-    numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
+  /*--- With threads, the edges are visited color by color, the blocks of
+   edges of a color do not share points and are divided among the threads. ---*/
+  
+  bool threaded = GetThreaded_EdgeLoop(geometry);
+  unsigned long nColor = (threaded? geometry->GetnEdgeColor() : 1);
+  
+  SU2_OMP(parallel if(threaded))
+  {
     
-    LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    LinSysRes.AddBlock(jPoint, Res_Visc);
+    unsigned long iColor, iEdgeColor, iEdge, iPoint, jPoint, EdgeBegin, EdgeEnd;
+    unsigned short iThread = SU2_OMP_GetThreadNum();
     
-    /*--- Implicit part ---*/
+    CNumerics *edge_numerics = (iThread == 0)? numerics : ThreadNumerics[iThread][VISC_TERM];
+    su2double *Residual_t = (iThread == 0)? Res_Visc : Thread_Residual[iThread];
+    su2double **Jacobian_t_i = Thread_Jacobian_i[iThread], **Jacobian_t_j = Thread_Jacobian_j[iThread];
     
-    if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    for (iColor = 0; iColor < nColor; iColor++) {
+      
+      EdgeBegin = (threaded? geometry->GetEdgeColorBegin(iColor) : 0);
+      EdgeEnd   = (threaded? geometry->GetEdgeColorEnd(iColor) : geometry->GetnEdge());
+      
+      SU2_OMP(for schedule(static, EDGE_BLOCK_SIZE))
+      for (iEdgeColor = EdgeBegin; iEdgeColor < EdgeEnd; iEdgeColor++) {
+        
+        iEdge = (threaded? geometry->GetEdgeColorIdx(iEdgeColor) : iEdgeColor);
+        
+        /*--- Points, coordinates and normal vector in edge ---*/
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
+        edge_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+        edge_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+        
+        /*--- Primitive and secondary variables ---*/
+        
+        edge_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+        edge_numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
+        
+        /*--- Gradient and limiters ---*/
+        
+        edge_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
+        edge_numerics->SetPrimVarLimiter(node[iPoint]->GetLimiter_Primitive(), node[jPoint]->GetLimiter_Primitive());
+        
+        /*--- Turbulent kinetic energy ---*/
+        
+        if (config->GetKind_Turb_Model() == SST)
+          edge_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                              solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+        
+        /*--- Compute and update residual ---*/
+        
+        edge_numerics->ComputeResidual(Residual_t, Jacobian_t_i, Jacobian_t_j, config);
+        
+        LinSysRes.SubtractBlock(iPoint, Residual_t);
+        LinSysRes.AddBlock(jPoint, Residual_t);
+        
+        /*--- Implicit part ---*/
+        
+        if (implicit) {
+          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_t_i);
+          Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_t_j);
+          Jacobian.AddBlock(jPoint, iPoint, Jacobian_t_i);
+          Jacobian.AddBlock(jPoint, jPoint, Jacobian_t_j);
+        }
+        
+      }
     }
-    
   }
   
 }
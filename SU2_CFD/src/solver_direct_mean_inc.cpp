@@ -1832,7 +1832,12 @@ void CIncEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *con
   
   delete FluidModel;
  
-  switch (config->GetKind_FluidModel()) {
+  /*--- The look-up table is not used by the incompressible solver, it uses the tabulated model ---*/
+  
+  unsigned short Kind_FluidModel = config->GetKind_FluidModel();
+  if (Kind_FluidModel == LUT_GAS) Kind_FluidModel = config->GetKind_LUT_FluidModel();
+  
+  switch (Kind_FluidModel) {
       
     case STANDARD_AIR:
       FluidModel = new CIdealGas(1.4, Gas_ConstantND);
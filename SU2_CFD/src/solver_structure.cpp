@@ -68,6 +68,8 @@ CSolver::CSolver(void) {
   Cvector            = NULL;
   node               = NULL;
   nOutputVariables   = 0;
+  Restart_Data       = NULL;
+  nRestart_Fields    = 0;
   
 }
 
@@ -91,6 +93,7 @@ CSolver::~CSolver(void) {
 
   /*--- Private ---*/
 
+  if (Restart_Data != NULL) delete [] Restart_Data;
   if (Residual_RMS != NULL) delete [] Residual_RMS;
   if (Residual_Max != NULL) delete [] Residual_Max;
   if (Residual != NULL) delete [] Residual;
@@ -1605,10 +1608,10 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
   /*--- This function is intended for dual time simulations ---*/
 
-  unsigned long iPoint, index;
+  unsigned long iPoint;
+  unsigned short iDim;
 
   int Unst_RestartIter;
-  ifstream restart_file_n;
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry->GetnZone();
   string filename = config->GetSolution_FlowFileName();
@@ -1618,17 +1621,6 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
   su2double *Coord;
   Coord = new su2double[nDim];
 
-  /*--- Variables for reading the restart files ---*/
-  string text_line;
-  long iPoint_Local;
-  unsigned long iPoint_Global_Local = 0, iPoint_Global = 0;
-  unsigned short rbuf_NotMatching, sbuf_NotMatching;
-
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
-
   /*--- Multizone problems require the number of the zone to be appended. ---*/
 
   if (nZone > 1)
@@ -1642,62 +1634,138 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
   Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-1;
   filename_n = config->GetUnsteady_FileName(filename, Unst_RestartIter);
 
-  /*--- Open the restart file, throw an error if this fails. ---*/
+  /*--- Read the restart file, the coordinates are the first fields ---*/
+
+  Read_SU2_Restart(geometry, config, filename_n);
+
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord[iDim] = Restart_Data[iPoint*nRestart_Fields+iDim];
+    geometry->node[iPoint]->SetCoord_n(Coord);
+  }
+
+  /*-------------------------------------------------------------------------------------------*/
+  /*-------------------------------------------------------------------------------------------*/
+
+  /*--- Now, we load the restart file for time n-1, if the simulation is 2nd Order ---*/
+
+  if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND) {
+
+    string filename_n1;
+
+    /*--- Modify file name for an unsteady restart ---*/
+    Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-2;
+    filename_n1 = config->GetUnsteady_FileName(filename, Unst_RestartIter);
+
+    Read_SU2_Restart(geometry, config, filename_n1);
+
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coord[iDim] = Restart_Data[iPoint*nRestart_Fields+iDim];
+      geometry->node[iPoint]->SetCoord_n1(Coord);
+    }
+
+  }
+
+  /*--- Release the memory of the restart data ---*/
+
+  delete [] Restart_Data; Restart_Data = NULL;
+
+  /*--- It's necessary to communicate this information ---*/
+
+  geometry->Set_MPI_OldCoord(config);
+  
+  delete [] Coord;
+
+}
+
+void CSolver::Read_SU2_Restart(CGeometry *geometry, CConfig *config, string val_filename) {
+
+  if (config->GetRead_Binary_Restart())
+    Read_SU2_Restart_Binary(geometry, config, val_filename);
+  else
+    Read_SU2_Restart_ASCII(geometry, config, val_filename);
+
+}
+
+void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename) {
+
+  ifstream restart_file;
+  string text_line, Tag;
+  unsigned long iPoint, iPoint_Global, iPoint_Global_Local = 0, index;
+  unsigned long nPointDomain_Restart = geometry->GetnPointDomain();
+  unsigned short iField, rbuf_NotMatching = 0, sbuf_NotMatching = 0;
+  long iPoint_Local;
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  /*--- Open the restart file, and throw an error if this fails. ---*/
 
-  restart_file_n.open(filename_n.data(), ios::in);
-  if (restart_file_n.fail()) {
+  restart_file.open(val_filename.data(), ios::in);
+  if (restart_file.fail()) {
     if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << filename_n.data() << "."<< endl;
+      cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
     exit(EXIT_FAILURE);
   }
 
   /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
+   Global2Local index transformation first. ---*/
 
-  map<unsigned long,unsigned long> Global2Local_n;
+  map<unsigned long,unsigned long> Global2Local;
   map<unsigned long,unsigned long>::const_iterator MI;
 
-  /*--- First, set all indices to a negative value by default, and Global n indices to 0 ---*/
-  iPoint_Global_Local = 0, iPoint_Global = 0;
+  for (iPoint = 0; iPoint < nPointDomain_Restart; iPoint++)
+    Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
 
-  /*--- Now fill array with the transform values only for local points ---*/
+  /*--- The first line is the header with the names of the fields ---*/
 
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-    Global2Local_n[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+  getline (restart_file, text_line);
 
-  /*--- Read all lines in the restart file ---*/
-  /*--- The first line is the header ---*/
+  Restart_Fields.clear();
+  stringstream ss(text_line);
+  while (ss >> Tag) {
+    Restart_Fields.push_back(Tag);
+    if (ss.peek() == ',') ss.ignore();
+  }
 
-  getline (restart_file_n, text_line);
+  /*--- The PointID is not stored ---*/
+
+  nRestart_Fields = Restart_Fields.size() - 1;
+
+  if (Restart_Data != NULL) delete [] Restart_Data;
+  Restart_Data = new passivedouble[nPointDomain_Restart*nRestart_Fields];
+  for (iPoint = 0; iPoint < nPointDomain_Restart*nRestart_Fields; iPoint++)
+    Restart_Data[iPoint] = 0.0;
+
+  /*--- Read all lines in the restart file, keeping only the points of this rank ---*/
 
   for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    
-    getline (restart_file_n, text_line);
-    
-    istringstream point_line(text_line);
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
-    
-    MI = Global2Local_n.find(iPoint_Global);
-    if (MI != Global2Local_n.end()) {
-      
-      iPoint_Local = Global2Local_n[iPoint_Global];
+    getline (restart_file, text_line);
 
-      if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1];
-      if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2];
+    MI = Global2Local.find(iPoint_Global);
+    if (MI != Global2Local.end()) {
 
-      geometry->node[iPoint_Local]->SetCoord_n(Coord);
+      iPoint_Local = MI->second;
+
+      istringstream point_line(text_line);
+      point_line >> index;
+      for (iField = 0; iField < nRestart_Fields; iField++)
+        point_line >> Restart_Data[iPoint_Local*nRestart_Fields+iField];
 
       iPoint_Global_Local++;
     }
+
   }
 
-  /*--- Detect a wrong solution file ---*/
+  restart_file.close();
 
-  rbuf_NotMatching = 0, sbuf_NotMatching = 0;
+  /*--- Detect a wrong solution file ---*/
 
-  if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+  if (iPoint_Global_Local < nPointDomain_Restart) { sbuf_NotMatching = 1; }
 
 #ifndef HAVE_MPI
   rbuf_NotMatching = sbuf_NotMatching;
@@ -1706,7 +1774,7 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 #endif
   if (rbuf_NotMatching != 0) {
     if (rank == MASTER_NODE) {
-      cout << endl << "The solution file " << filename_n.data() << " doesn't match with the mesh file!" << endl;
+      cout << endl << "The solution file " << val_filename.data() << " doesn't match with the mesh file!" << endl;
       cout << "It could be empty lines at the end of the file." << endl << endl;
     }
 #ifndef HAVE_MPI
@@ -1718,112 +1786,306 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 #endif
   }
 
-  /*--- Close the restart file ---*/
+}
 
-  restart_file_n.close();
+void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
 
-  /*-------------------------------------------------------------------------------------------*/
-  /*-------------------------------------------------------------------------------------------*/
+  char Magic[SU2_BINARY_MAGIC_SIZE], *Names;
+  unsigned long iPoint, Header[2], Global_Index, nPointDomain_Restart = geometry->GetnPointDomain();
+  unsigned short iField;
+  bool Wrong_File;
+  string Tag;
 
-  /*--- Now, we load the restart file for time n-1, if the simulation is 2nd Order ---*/
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
-  if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND) {
+#ifndef HAVE_MPI
 
-    ifstream restart_file_n1;
-    string filename_n1;
+  /*--- Open the restart file, and throw an error if this fails. ---*/
 
-    /*--- Modify file name for an unsteady restart ---*/
-    Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-2;
-    filename_n1 = config->GetUnsteady_FileName(filename, Unst_RestartIter);
+  ifstream restart_file;
+  restart_file.open(val_filename.data(), ios::in | ios::binary);
+  if (restart_file.fail()) {
+    cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+    exit(EXIT_FAILURE);
+  }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
+  /*--- Identifier, number of fields and of points ---*/
 
-    restart_file_n.open(filename_n1.data(), ios::in);
-    if (restart_file_n.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename_n1.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
+  restart_file.read(Magic, SU2_BINARY_MAGIC_SIZE);
+  restart_file.read((char *)Header, 2*sizeof(unsigned long));
 
-    /*--- In case this is a parallel simulation, we need to perform the
-         Global2Local index transformation first. ---*/
+#else
 
-    map<unsigned long,unsigned long> Global2Local_n1;
-    map<unsigned long,unsigned long>::const_iterator MI;
+  /*--- All the ranks open the file, the header is read collectively ---*/
 
-    /*--- First, set all indices to a negative value by default, and Global n indices to 0 ---*/
-    iPoint_Global_Local = 0, iPoint_Global = 0;
+  MPI_File fhr;
+  MPI_Status status;
+  MPI_Datatype filetype;
+  MPI_Offset disp;
+  int ierr;
 
-    /*--- Now fill array with the transform values only for local points ---*/
+  ierr = MPI_File_open(MPI_COMM_WORLD, (char *)val_filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhr);
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-      Global2Local_n1[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+  MPI_File_read_all(fhr, Magic, SU2_BINARY_MAGIC_SIZE, MPI_CHAR, &status);
+  MPI_File_read_all(fhr, Header, 2, MPI_UNSIGNED_LONG, &status);
 
-    /*--- Read all lines in the restart file ---*/
-    /*--- The first line is the header ---*/
+#endif
 
-    getline (restart_file_n, text_line);
+  /*--- Detect a wrong solution file ---*/
 
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file_n, text_line);
-      
-      istringstream point_line(text_line);
+  Magic[SU2_BINARY_MAGIC_SIZE-1] = '\0';
+  Wrong_File = (strcmp(Magic, SU2_RESTART_MAGIC) != 0) || (Header[1] != geometry->GetGlobal_nPointDomain());
 
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local_n1.find(iPoint_Global);
-      if (MI != Global2Local_n1.end()) {
-        
-        iPoint_Local = Global2Local_n1[iPoint_Global];
+  if (Wrong_File) {
+    if (rank == MASTER_NODE)
+      cout << endl << "The binary solution file " << val_filename.data() << " doesn't match with the mesh file!" << endl << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
 
-        if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1];
-        if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2];
+  /*--- Names of the fields, stored as in the header of the ASCII files ---*/
 
-        geometry->node[iPoint_Local]->SetCoord_n1(Coord);
+  nRestart_Fields = Header[0];
+  Names = new char[nRestart_Fields*SU2_BINARY_TAG_SIZE];
 
-        iPoint_Global_Local++;
-      }
+#ifndef HAVE_MPI
+  restart_file.read(Names, nRestart_Fields*SU2_BINARY_TAG_SIZE);
+#else
+  MPI_File_read_all(fhr, Names, nRestart_Fields*SU2_BINARY_TAG_SIZE, MPI_CHAR, &status);
+#endif
 
-    }
+  Restart_Fields.clear();
+  Restart_Fields.push_back("\"PointID\"");
+  for (iField = 0; iField < nRestart_Fields; iField++) {
+    Names[(iField+1)*SU2_BINARY_TAG_SIZE-1] = '\0';
+    Tag = &Names[iField*SU2_BINARY_TAG_SIZE];
+    Restart_Fields.push_back("\"" + Tag + "\"");
+  }
+  delete [] Names;
 
-    /*--- Detect a wrong solution file ---*/
+  if (Restart_Data != NULL) delete [] Restart_Data;
+  Restart_Data = new passivedouble[nPointDomain_Restart*nRestart_Fields];
 
-    rbuf_NotMatching = 0, sbuf_NotMatching = 0;
+#ifndef HAVE_MPI
 
-    if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+  /*--- The record of each point is located by its global index ---*/
+
+  streampos Data_Offset = restart_file.tellg();
+
+  for (iPoint = 0; iPoint < nPointDomain_Restart; iPoint++) {
+    Global_Index = geometry->node[iPoint]->GetGlobalIndex();
+    restart_file.seekg(Data_Offset + streamoff(Global_Index*nRestart_Fields*sizeof(passivedouble)));
+    restart_file.read((char *)&Restart_Data[iPoint*nRestart_Fields], nRestart_Fields*sizeof(passivedouble));
+  }
+
+  restart_file.close();
 
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
 #else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+
+  /*--- The view of the file of each rank is made of the records of its
+   points, which must be given in increasing order of the global index ---*/
+
+  vector<pair<unsigned long, unsigned long> > Point_Order(nPointDomain_Restart);
+  for (iPoint = 0; iPoint < nPointDomain_Restart; iPoint++)
+    Point_Order[iPoint] = make_pair(geometry->node[iPoint]->GetGlobalIndex(), iPoint);
+  sort(Point_Order.begin(), Point_Order.end());
+
+  int *blocklen = new int[nPointDomain_Restart];
+  MPI_Aint *displace = new MPI_Aint[nPointDomain_Restart];
+  for (iPoint = 0; iPoint < nPointDomain_Restart; iPoint++) {
+    blocklen[iPoint] = nRestart_Fields;
+    displace[iPoint] = Point_Order[iPoint].first*nRestart_Fields*sizeof(passivedouble);
+  }
+
+  MPI_Type_create_hindexed(nPointDomain_Restart, blocklen, displace, MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  disp = SU2_BINARY_MAGIC_SIZE + 2*sizeof(unsigned long) + nRestart_Fields*SU2_BINARY_TAG_SIZE;
+  MPI_File_set_view(fhr, disp, MPI_DOUBLE, filetype, (char *)"native", MPI_INFO_NULL);
+
+  /*--- Collective read of the records, then reorder them by local index ---*/
+
+  passivedouble *Buffer = new passivedouble[nPointDomain_Restart*nRestart_Fields];
+  MPI_File_read_all(fhr, Buffer, nPointDomain_Restart*nRestart_Fields, MPI_DOUBLE, &status);
+
+  for (iPoint = 0; iPoint < nPointDomain_Restart; iPoint++)
+    for (iField = 0; iField < nRestart_Fields; iField++)
+      Restart_Data[Point_Order[iPoint].second*nRestart_Fields+iField] = Buffer[iPoint*nRestart_Fields+iField];
+
+  MPI_Type_free(&filetype);
+  MPI_File_close(&fhr);
+
+  delete [] Buffer;
+  delete [] blocklen;
+  delete [] displace;
+
+#endif
+
+}
+
+void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, string val_filename) {
+
+  su2double AoA_ = config->GetAoA(), AoS_ = config->GetAoS(), BCThrust_ = config->GetInitial_BCThrust();
+  unsigned long ExtIter_ = 0, iPoint_Global;
+  bool AoA_Found = false, AoS_Found = false, BCThrust_Found = false, ExtIter_Found = false;
+  ifstream restart_file;
+  string text_line;
+  string::size_type position;
+
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename_n1.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
+
+  if (config->GetRead_Binary_Restart()) {
+
+    /*--- The metadata is stored after the records of the points, the
+     master node reads it and sends it to the other ranks ---*/
+
+    char Magic[SU2_BINARY_MAGIC_SIZE];
+    unsigned long Header[2] = {0, 0};
+    passivedouble Restart_Meta[SU2_RESTART_META_SIZE];
+
+    if (rank == MASTER_NODE) {
+      restart_file.open(val_filename.data(), ios::in | ios::binary);
+      if (restart_file.fail()) {
+        cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+        exit(EXIT_FAILURE);
       }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
+      restart_file.read(Magic, SU2_BINARY_MAGIC_SIZE);
+      restart_file.read((char *)Header, 2*sizeof(unsigned long));
+      restart_file.seekg(Header[0]*SU2_BINARY_TAG_SIZE + Header[0]*Header[1]*sizeof(passivedouble), ios::cur);
+      restart_file.read((char *)Restart_Meta, SU2_RESTART_META_SIZE*sizeof(passivedouble));
+      restart_file.close();
+    }
+
+#ifdef HAVE_MPI
+    MPI_Bcast(Restart_Meta, SU2_RESTART_META_SIZE, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #endif
+
+    AoA_      = Restart_Meta[0]; AoA_Found      = true;
+    AoS_      = Restart_Meta[1]; AoS_Found      = true;
+    BCThrust_ = Restart_Meta[2]; BCThrust_Found = true;
+    ExtIter_  = (unsigned long)Restart_Meta[5]; ExtIter_Found = true;
+
+  }
+
+  else {
+
+    /*--- Open the restart file, throw an error if this fails. ---*/
+
+    restart_file.open(val_filename.data(), ios::in);
+    if (restart_file.fail()) {
+      if (rank == MASTER_NODE)
+        cout << "There is no flow restart file!! " << val_filename.data() << "."<< endl;
+      exit(EXIT_FAILURE);
+    }
+
+    /*--- The first line is the header, skip the solution ---*/
+
+    getline (restart_file, text_line);
+    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ )
+      getline (restart_file, text_line);
+
+    /*--- Space for extra info (if any) ---*/
+
+    while (getline (restart_file, text_line)) {
+
+      position = text_line.find ("AOA=",0);
+      if (position != string::npos) {
+        text_line.erase (0,4); AoA_ = atof(text_line.c_str()); AoA_Found = true;
+      }
+
+      position = text_line.find ("SIDESLIP_ANGLE=",0);
+      if (position != string::npos) {
+        text_line.erase (0,15); AoS_ = atof(text_line.c_str()); AoS_Found = true;
+      }
+
+      position = text_line.find ("INITIAL_BCTHRUST=",0);
+      if (position != string::npos) {
+        text_line.erase (0,17); BCThrust_ = atof(text_line.c_str()); BCThrust_Found = true;
+      }
+
+      position = text_line.find ("EXT_ITER=",0);
+      if (position != string::npos) {
+        text_line.erase (0,9); ExtIter_ = atoi(text_line.c_str()); ExtIter_Found = true;
+      }
+
     }
 
-    /*--- Close the restart file ---*/
+    restart_file.close();
+
+  }
+
+  /*--- Angle of attack ---*/
+
+  if (AoA_Found) {
+    if (config->GetDiscard_InFiles() == false) {
+      if ((config->GetAoA() != AoA_) &&  (rank == MASTER_NODE)) {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoA in the solution file (" << AoA_ << " deg.) +" << endl;
+        cout << "         AoA offset in mesh file (" << config->GetAoA_Offset() << " deg.) = " << AoA_ + config->GetAoA_Offset() << " deg." << endl;
+      }
+      config->SetAoA(AoA_ + config->GetAoA_Offset());
+    }
+    else {
+      if ((config->GetAoA() != AoA_) &&  (rank == MASTER_NODE))
+        cout <<"WARNING: Discarding the AoA in the solution file." << endl;
+    }
+  }
 
-    restart_file_n1.close();
+  /*--- Sideslip angle ---*/
 
+  if (AoS_Found) {
+    if (config->GetDiscard_InFiles() == false) {
+      if ((config->GetAoS() != AoS_) &&  (rank == MASTER_NODE)) {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoS in the solution file (" << AoS_ << " deg.) +" << endl;
+        cout << "         AoS offset in mesh file (" << config->GetAoS_Offset() << " deg.) = " << AoS_ + config->GetAoS_Offset() << " deg." << endl;
+      }
+      config->SetAoS(AoS_ + config->GetAoS_Offset());
+    }
+    else {
+      if ((config->GetAoS() != AoS_) &&  (rank == MASTER_NODE))
+        cout <<"WARNING: Discarding the AoS in the solution file." << endl;
+    }
   }
 
-  /*--- It's necessary to communicate this information ---*/
+  /*--- BCThrust angle ---*/
 
-  geometry->Set_MPI_OldCoord(config);
-  
-  delete [] Coord;
+  if (BCThrust_Found) {
+    if (config->GetDiscard_InFiles() == false) {
+      if ((config->GetInitial_BCThrust() != BCThrust_) &&  (rank == MASTER_NODE))
+        cout <<"WARNING: ACDC will use the initial BC Thrust provided in the solution file: " << BCThrust_ << " lbs." << endl;
+      config->SetInitial_BCThrust(BCThrust_);
+    }
+    else {
+      if ((config->GetInitial_BCThrust() != BCThrust_) &&  (rank == MASTER_NODE))
+        cout <<"WARNING: Discarding the BC Thrust in the solution file." << endl;
+    }
+  }
+
+  /*--- External iteration ---*/
+
+  if (ExtIter_Found) {
+    if (!config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint())
+      config->SetExtIter_OffSet(ExtIter_);
+  }
 
 }
 
@@ -1865,12 +2127,9 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
   
-  unsigned long iPoint, index, iPoint_Global;
-  unsigned long iPoint_Global_Local = 0;
-  unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-  long iPoint_Local;
-  unsigned short iField, iVar, iDim;
-  string Tag, text_line, AdjExt, UnstExt;
+  unsigned long iPoint;
+  unsigned short iField, iVar, iDim, GridVel_Index;
+  string AdjExt, UnstExt;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
   
@@ -1879,12 +2138,7 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   bool grid_movement  = config->GetGrid_Movement();
   bool steady_restart = config->GetSteadyRestart();
   unsigned short turb_model = config->GetKind_Turb_Model();
-  su2double dull_val;
   
-  su2double *Coord = new su2double [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    Coord[iDim] = 0.0;
-
   /*--- Define geometry constants in the solver structure ---*/
   
   nDim = geometry->GetnDim();
@@ -1895,7 +2149,6 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   
   /*--- Restart the solution from file information ---*/
   
-  ifstream restart_file;
   string filename;
   
   /*--- Retrieve filename from config ---*/
@@ -1921,141 +2174,65 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
   
-  /*--- Open the restart file ---*/
-  
-  restart_file.open(filename.data(), ios::in);
-  
-  /*--- In case there is no restart file ---*/
-  
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "SU2 flow file " << filename << " not found" << endl;
-
-#ifndef HAVE_MPI
-    exit(EXIT_FAILURE);
-#else
-    MPI_Barrier(MPI_COMM_WORLD);
-    MPI_Abort(MPI_COMM_WORLD,1);
-    MPI_Finalize();
-#endif
-    
-  }
-  
   /*--- Output the file name to the console. ---*/
   
   if (rank == MASTER_NODE)
     cout << "Reading and storing the solution from " << filename << "." << endl;
   
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
+  /*--- Read the restart file (ASCII or binary), the values of the
+   points of this rank are kept in the restart data. ---*/
   
-  map<unsigned long,unsigned long> Global2Local;
-  map<unsigned long,unsigned long>::const_iterator MI;
-  
-  /*--- Now fill array with the transform values only for local points ---*/
-  
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-    Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+  Read_SU2_Restart(geometry, config, filename);
   
   /*--- Identify the number of fields (and names) in the restart file ---*/
   
-  getline (restart_file, text_line);
-  
-  stringstream ss(text_line);
-  while (ss >> Tag) {
-    config->fields.push_back(Tag);
-    if (ss.peek() == ',') ss.ignore();
-  }
+  config->fields = Restart_Fields;
   
   /*--- Set the number of variables, one per field in the
    restart file (without including the PointID) ---*/
   
-  nVar = config->fields.size() - 1;
+  nVar = nRestart_Fields;
   su2double *Solution = new su2double[nVar];
   
-  /*--- Read all lines in the restart file ---*/
+  /*--- Position of the grid velocities, after the coordinates, the
+   conservative variables and the turbulence variables ---*/
   
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  GridVel_Index = 2*nDim + 1;
+  if (config->GetKind_Regime() != INCOMPRESSIBLE) GridVel_Index += 1;
+  if (turb_model == SA || turb_model == SA_NEG) GridVel_Index += 1;
+  else if (turb_model == SST) GridVel_Index += 2;
+  
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
     
-    getline (restart_file, text_line);
+    /*--- Store the solution (starting with node coordinates) --*/
     
-    istringstream point_line(text_line);
+    for (iField = 0; iField < nVar; iField++)
+      Solution[iField] = Restart_Data[iPoint*nRestart_Fields+iField];
     
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    node[iPoint] = new CBaselineVariable(Solution, nVar, config);
     
-    MI = Global2Local.find(iPoint_Global);
-    if (MI != Global2Local.end()) {
-      
-      iPoint_Local = Global2Local[iPoint_Global];
-      
-      /*--- The PointID is not stored --*/
-      point_line >> index;
-      
-      /*--- Store the solution (starting with node coordinates) --*/
-      for (iField = 0; iField < nVar; iField++)
-        point_line >> Solution[iField];
-      
-      node[iPoint_Local] = new CBaselineVariable(Solution, nVar, config);
-      iPoint_Global_Local++;
+    /*--- For dynamic meshes, store the grid coordinates and grid velocities
+     for each node. If we are restarting the solution from a previously
+     computed static calculation (no grid movement), the grid velocities
+     are set to 0. This is useful for FSI computations ---*/
+    
+    if (grid_movement) {
       
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart && (GridVel_Index+nDim <= nVar)) {
+        for (iDim = 0; iDim < nDim; iDim++)
+          GridVel[iDim] = Solution[GridVel_Index+iDim];
+      }
       
-      if (grid_movement) {
-        
-        /*--- First, remove any variables for the turbulence model that
-         appear in the restart file before the grid velocities. ---*/
-        
-        if (turb_model == SA || turb_model == SA_NEG) {
-          point_line >> dull_val;
-        } else if (turb_model == SST) {
-          point_line >> dull_val >> dull_val;
-        }
-        
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
-        
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
-          if (nDim == 2) point_line >> GridVel[0] >> GridVel[1];
-          else point_line >> GridVel[0] >> GridVel[1] >> GridVel[2];
-        }
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-          geometry->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
-        }
-        
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry->node[iPoint]->SetCoord(iDim, Solution[iDim]);
+        geometry->node[iPoint]->SetGridVel(iDim, GridVel[iDim]);
       }
+      
     }
-
+    
   }
   
-    /*--- Detect a wrong solution file ---*/
-  
-    rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-    if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
-    }
-  
   /*--- Instantiate the variable class with an arbitrary solution
    at any halo/periodic nodes. The initial solution can be arbitrary,
    because a send/recv is performed immediately in the solver. ---*/
@@ -2066,13 +2243,10 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
   for (iPoint = geometry->GetnPointDomain(); iPoint < geometry->GetnPoint(); iPoint++)
     node[iPoint] = new CBaselineVariable(Solution, nVar, config);
   
-  /*--- Close the restart file ---*/
-  
-  restart_file.close();
-  
-  /*--- Free memory needed for the transformation ---*/
+  /*--- Free memory needed for the restart data ---*/
   
   delete [] Solution;
+  delete [] Restart_Data; Restart_Data = NULL;
   
   /*--- MPI solution ---*/
   
@@ -2089,8 +2263,6 @@ CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned
     
   }
   
-  delete [] Coord;
-  
 }
 
 void CBaselineSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
@@ -2288,10 +2460,9 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   /*--- Restart the solution from file information ---*/
 
   string filename;
-  unsigned long iPoint, index;
-  string UnstExt, text_line, AdjExt;
-  ifstream solution_file;
-  unsigned short iField, iDim;
+  unsigned long iPoint;
+  string UnstExt, AdjExt;
+  unsigned short iField, iDim, GridVel_Index;
   unsigned long iExtIter = config->GetExtIter();
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
   bool adjoint = ( config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint() ); 
@@ -2300,11 +2471,6 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   bool grid_movement  = config->GetGrid_Movement();
   bool steady_restart = config->GetSteadyRestart();
   unsigned short turb_model = config->GetKind_Turb_Model();
-  su2double dull_val;
-  
-  su2double *Coord = new su2double [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    Coord[iDim] = 0.0;
   
   /*--- Retrieve filename from config ---*/
 
@@ -2331,116 +2497,65 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
     filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
 
-  /*--- Open the restart file ---*/
-
-  solution_file.open(filename.data(), ios::in);
-
-  /*--- In case there is no file ---*/
-
-  if (solution_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no SU2 restart file!!" << endl;
-    exit(EXIT_FAILURE);
-  }
-
   /*--- Output the file name to the console. ---*/
 
   if (rank == MASTER_NODE)
     cout << "Reading and storing the solution from " << filename
     << "." << endl;
 
+  /*--- Read the restart file (ASCII or binary) ---*/
+
+  Read_SU2_Restart(geometry[iZone], config, filename);
+
   /*--- Set the number of variables, one per field in the
    restart file (without including the PointID) ---*/
 
   nVar = config->fields.size() - 1;
   su2double *Solution = new su2double[nVar];
 
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-
-  map<unsigned long,unsigned long> Global2Local;
-  map<unsigned long,unsigned long>::const_iterator MI;
+  /*--- Position of the grid velocities, after the coordinates, the
+   conservative variables and the turbulence variables ---*/
 
-  /*--- Now fill array with the transform values only for local points ---*/
+  GridVel_Index = 2*nDim + 1;
+  if (config->GetKind_Regime() != INCOMPRESSIBLE) GridVel_Index += 1;
+  if (turb_model == SA || turb_model == SA_NEG) GridVel_Index += 1;
+  else if (turb_model == SST) GridVel_Index += 2;
 
   for (iPoint = 0; iPoint < geometry[iZone]->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry[iZone]->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
 
-  /*--- Read all lines in the restart file ---*/
+    /*--- Store the solution (starting with node coordinates) --*/
 
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
+    for (iField = 0; iField < nVar; iField++)
+      Solution[iField] = Restart_Data[iPoint*nRestart_Fields+iField];
 
-  /*--- The first line is the header ---*/
+    node[iPoint]->SetSolution(Solution);
 
-  getline (solution_file, text_line);
+    /*--- For dynamic meshes, store the grid coordinates and grid velocities
+     for each node. If we are restarting the solution from a previously
+     computed static calculation (no grid movement), the grid velocities
+     are set to 0. This is useful for FSI computations ---*/
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[iZone]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    
-    getline (solution_file, text_line);
-    
-    istringstream point_line(text_line);
+    if (grid_movement) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
-    
-    MI = Global2Local.find(iPoint_Global);
-    if (MI != Global2Local.end()) {
-      
-      iPoint_Local = Global2Local[iPoint_Global];
-      
-      /*--- The PointID is not stored --*/
-      
-      point_line >> index;
-      
-      /*--- Store the solution (starting with node coordinates) --*/
-      
-      for (iField = 0; iField < nVar; iField++)
-        point_line >> Solution[iField];
-      
-      node[iPoint_Local]->SetSolution(Solution);
-     
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
-      
-      if (grid_movement) {
-        
-        /*--- First, remove any variables for the turbulence model that
-         appear in the restart file before the grid velocities. ---*/
-        
-        if (turb_model == SA || turb_model == SA_NEG) {
-          point_line >> dull_val;
-        } else if (turb_model == SST) {
-          point_line >> dull_val >> dull_val;
-        }
-        
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
-        
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
-          if (nDim == 2) point_line >> GridVel[0] >> GridVel[1];
-          else point_line >> GridVel[0] >> GridVel[1] >> GridVel[2];
-        }
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[iZone]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-          geometry[iZone]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
-        }
-        
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart && (GridVel_Index+nDim <= nVar)) {
+        for (iDim = 0; iDim < nDim; iDim++)
+          GridVel[iDim] = Solution[GridVel_Index+iDim];
       }
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[iZone]->node[iPoint]->SetCoord(iDim, Solution[iDim]);
+        geometry[iZone]->node[iPoint]->SetGridVel(iDim, GridVel[iDim]);
+      }
+
     }
-    
-  }
 
-  /*--- Close the restart file ---*/
+  }
 
-  solution_file.close();
-  
-  /*--- Free memory needed for the transformation ---*/
+  /*--- Free memory needed for the restart data ---*/
   
   delete [] Solution;
+  delete [] Restart_Data; Restart_Data = NULL;
   
   /*--- MPI solution ---*/
   
@@ -2457,8 +2572,6 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
 
   }
   
-  delete [] Coord;
-  
 }
 
 void CBaselineSolver::LoadRestart_FSI(CGeometry *geometry, CSolver ***solver, CConfig *config, int val_iter) {
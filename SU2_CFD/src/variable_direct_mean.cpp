@@ -47,6 +47,8 @@ CEulerVariable::CEulerVariable(void) : CVariable() {
     Limiter_Primitive = NULL;
     Limiter_Secondary = NULL;
   
+  Contiguous_Primitive = false;
+  
   WindGust    = NULL;
   WindGustDer = NULL;
 
@@ -82,6 +84,8 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   Limiter_Primitive = NULL;
   Limiter_Secondary = NULL;
   
+  Contiguous_Primitive = false;
+  
   WindGust    = NULL;
   WindGustDer = NULL;
   
@@ -234,6 +238,8 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   Limiter_Primitive = NULL;
   Limiter_Secondary = NULL;
   
+  Contiguous_Primitive = false;
+  
   WindGust    = NULL;
   WindGustDer = NULL;
   
@@ -353,17 +359,21 @@ CEulerVariable::~CEulerVariable(void) {
     unsigned short iVar;
 
   if (HB_Source         != NULL) delete [] HB_Source;
-  if (Primitive         != NULL) delete [] Primitive;
   if (Secondary         != NULL) delete [] Secondary;
-  if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
   if (Limiter_Secondary != NULL) delete [] Limiter_Secondary;
   if (WindGust          != NULL) delete [] WindGust;
   if (WindGustDer       != NULL) delete [] WindGustDer;
 
-  if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
-    delete [] Gradient_Primitive;
+  /*--- The contiguous blocks are deleted by the solver ---*/
+
+  if (!Contiguous_Primitive) {
+    if (Primitive         != NULL) delete [] Primitive;
+    if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
+    if (Gradient_Primitive != NULL) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
+      delete [] Gradient_Primitive;
+    }
   }
   if (Gradient_Secondary != NULL) {
     for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
@@ -375,6 +385,37 @@ CEulerVariable::~CEulerVariable(void) {
   
 }
 
+void CEulerVariable::SetContiguous_Primitive(su2double *val_primitive, su2double **val_gradient, su2double *val_limiter) {
+  unsigned short iVar, iDim;
+  
+  /*--- Copy the current values to the blocks of the solver and release the
+   arrays of the point. The rows of val_gradient already point to the block. ---*/
+  
+  for (iVar = 0; iVar < nPrimVar; iVar++)
+    val_primitive[iVar] = Primitive[iVar];
+  
+  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+    val_limiter[iVar] = Limiter_Primitive[iVar];
+    for (iDim = 0; iDim < nDim; iDim++)
+      val_gradient[iVar][iDim] = Gradient_Primitive[iVar][iDim];
+  }
+  
+  if (!Contiguous_Primitive) {
+    delete [] Primitive;
+    delete [] Limiter_Primitive;
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      delete [] Gradient_Primitive[iVar];
+    delete [] Gradient_Primitive;
+  }
+  
+  Primitive          = val_primitive;
+  Gradient_Primitive = val_gradient;
+  Limiter_Primitive  = val_limiter;
+  
+  Contiguous_Primitive = true;
+  
+}
+
 void CEulerVariable::SetGradient_PrimitiveZero(unsigned short val_primvar) {
     unsigned short iVar, iDim;
   
@@ -51,6 +51,7 @@ CVariable::CVariable(void) {
   Res_TruncError = NULL;
   Residual_Old = NULL;
   Residual_Sum = NULL;
+  Contiguous_Solution = false;
   
 }
 
@@ -70,6 +71,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
   Res_TruncError = NULL;
   Residual_Old = NULL;
   Residual_Sum = NULL;
+  Contiguous_Solution = false;
   
   /*--- Initialize the number of solution variables. This version
    of the constructor will be used primarily for converting the
@@ -103,6 +105,7 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
   Res_TruncError = NULL;
   Residual_Old = NULL;
   Residual_Sum = NULL;
+  Contiguous_Solution = false;
   
   /*--- Initializate the number of dimension and number of variables ---*/
   nDim = val_nDim;
@@ -136,11 +139,15 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 CVariable::~CVariable(void) {
   unsigned short iVar;
 
-  if (Solution            != NULL) delete [] Solution;
-  if (Solution_Old        != NULL) delete [] Solution_Old;
+  /*--- The contiguous blocks are deleted by the solver ---*/
+  
+  if (!Contiguous_Solution) {
+    if (Solution          != NULL) delete [] Solution;
+    if (Solution_Old      != NULL) delete [] Solution_Old;
+    if (Limiter           != NULL) delete [] Limiter;
+  }
   if (Solution_time_n     != NULL) delete [] Solution_time_n;
   if (Solution_time_n1    != NULL) delete [] Solution_time_n1;
-  if (Limiter             != NULL) delete [] Limiter;
   if (Solution_Max        != NULL) delete [] Solution_Max;
   if (Solution_Min        != NULL) delete [] Solution_Min;
   if (Grad_AuxVar         != NULL) delete [] Grad_AuxVar;
@@ -157,6 +164,33 @@ CVariable::~CVariable(void) {
 
 }
 
+void CVariable::SetContiguous_Solution(su2double *val_solution, su2double *val_solution_old, su2double *val_limiter) {
+  
+  unsigned short iVar;
+  
+  /*--- Copy the current values to the blocks of the solver and release the
+   arrays of the point, the accessors work unchanged on the new storage ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    val_solution[iVar]     = Solution[iVar];
+    val_solution_old[iVar] = Solution_Old[iVar];
+    val_limiter[iVar]      = Limiter[iVar];
+  }
+  
+  if (!Contiguous_Solution) {
+    delete [] Solution;
+    delete [] Solution_Old;
+    delete [] Limiter;
+  }
+  
+  Solution     = val_solution;
+  Solution_Old = val_solution_old;
+  Limiter      = val_limiter;
+  
+  Contiguous_Solution = true;
+  
+}
+
 void CVariable::AddUnd_Lapl(su2double *val_und_lapl) {
   for (unsigned short iVar = 0; iVar < nVar; iVar++)
     Undivided_Laplacian[iVar] += val_und_lapl[iVar];